@@ -3,6 +3,13 @@
 #include "Config.hpp"
 #include "ExitCodes.hpp"
 
+struct FramePacket;
+
+namespace Input
+{
+    class State;
+}
+
 class Application
 {
 public:
@@ -23,11 +30,19 @@ public:
         return {};
     };
 
-    virtual void OnUpdate(float deltaTime)
+    // Input state is a snapshot of all input events collected since previous update.
+    virtual void OnUpdate(float deltaTime, const Input::State& input)
+    {
+    };
+
+    // Called on main thread after update to write render data into frame packet.
+    virtual void OnPrepareFrame(FramePacket& packet)
     {
     };
 
-    virtual void OnDraw(float alphaTime)
+    // Called on render thread when enabled, so it must only read from frame packet
+    // and must not access state that main thread modifies during update.
+    virtual void OnDraw(const FramePacket& packet)
     {
     };
 };
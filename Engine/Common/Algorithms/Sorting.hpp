@@ -24,3 +24,61 @@ void InsertionSort(Type* begin, Type* end)
         ++i;
     }
 }
+
+// Stable least significant digit radix sort by unsigned 64-bit key, which runs in linear
+// time and suits large arrays of packed sort keys. Scratch buffer must hold the same number
+// of elements, and passes over bytes that are equal for all keys are skipped entirely.
+template<typename Type, typename KeyFunction>
+void RadixSort(Type* begin, Type* end, Type* scratch, const KeyFunction& getKey)
+{
+    ASSERT(begin && end);
+    ASSERT(begin <= end);
+    ASSERT(scratch || begin == end);
+
+    const u64 length = end - begin;
+    if(length < 2)
+        return;
+
+    u64 counts[8][256] = {};
+    for(u64 i = 0; i < length; ++i)
+    {
+        const u64 key = getKey(begin[i]);
+        for(u32 pass = 0; pass < 8; ++pass)
+        {
+            ++counts[pass][(key >> (pass * 8)) & 0xFF];
+        }
+    }
+
+    Type* source = begin;
+    Type* destination = scratch;
+    for(u32 pass = 0; pass < 8; ++pass)
+    {
+        u64* passCounts = counts[pass];
+        if(passCounts[(getKey(source[0]) >> (pass * 8)) & 0xFF] == length)
+            continue;
+
+        u64 offset = 0;
+        for(u32 digit = 0; digit < 256; ++digit)
+        {
+            const u64 count = passCounts[digit];
+            passCounts[digit] = offset;
+            offset += count;
+        }
+
+        for(u64 i = 0; i < length; ++i)
+        {
+            const u64 digit = (getKey(source[i]) >> (pass * 8)) & 0xFF;
+            destination[passCounts[digit]++] = Move(source[i]);
+        }
+
+        std::swap(source, destination);
+    }
+
+    if(source != begin)
+    {
+        for(u64 i = 0; i < length; ++i)
+        {
+            begin[i] = Move(source[i]);
+        }
+    }
+}
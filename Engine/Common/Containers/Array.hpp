@@ -126,8 +126,125 @@ public:
         return Add(Forward<Argument>(element));
     }
 
-    // #todo: Add remove function, with parameter for either moving last element into gap (default) or shifting all elements.
- 
+    template<typename... Arguments>
+    Type& Insert(const u64 index, Arguments&&... arguments)
+    {
+        ASSERT(index <= m_size, "Out of bounds insert with %llu index and %llu size", index, m_size);
+
+        const u64 newSize = m_size + 1;
+        Reserve(newSize, false);
+
+        Type* data = m_allocation.GetPointer();
+        Memory::RelocateRange(data + index + 1, data + index, m_size - index);
+        Memory::Construct(data + index, Forward<Arguments>(arguments)...);
+
+        m_size = newSize;
+        return data[index];
+    }
+
+    void InsertRange(const u64 index, const Type* elements, const u64 count)
+    {
+        ASSERT(index <= m_size, "Out of bounds insert with %llu index and %llu size", index, m_size);
+        ASSERT_SLOW(elements + count <= GetBeginPtr() || elements >= GetEndPtr(), "Cannot insert range from itself");
+
+        if(count == 0)
+            return;
+
+        const u64 newSize = m_size + count;
+        Reserve(newSize, false);
+
+        Type* data = m_allocation.GetPointer();
+        Memory::RelocateRange(data + index + count, data + index, m_size - index);
+        Memory::CopyConstructRange(data + index, elements, count);
+
+        m_size = newSize;
+    }
+
+    void AppendRange(const Type* elements, const u64 count)
+    {
+        ASSERT_SLOW(elements + count <= GetBeginPtr() || elements >= GetEndPtr(), "Cannot append range from itself");
+
+        if(count == 0)
+            return;
+
+        const u64 newSize = m_size + count;
+        Reserve(newSize, false);
+
+        Memory::CopyConstructRange(m_allocation.GetPointer() + m_size, elements, count);
+        m_size = newSize;
+    }
+
+    template<typename OtherAllocator>
+    void AppendRange(const Array<Type, OtherAllocator>& other)
+    {
+        AppendRange(other.GetData(), other.GetSize());
+    }
+
+    Type* AddUninitialized(const u64 count)
+    {
+        // Elements are left uninitialized for bulk writes, so they must not require construction.
+        static_assert(std::is_trivially_copyable_v<Type>, "Uninitialized elements must be trivially copyable");
+
+        const u64 newSize = m_size + count;
+        Reserve(newSize, false);
+
+        Type* newElements = m_allocation.GetPointer() + m_size;
+        m_size = newSize;
+        return newElements;
+    }
+
+    void RemoveAt(const u64 index, const u64 count = 1)
+    {
+        // Shifts all following elements to fill the gap, preserving order.
+        ASSERT(index + count <= m_size, "Out of bounds remove with %llu index, %llu count and %llu size", index, count, m_size);
+
+        Type* data = m_allocation.GetPointer();
+        Memory::DestructRange(data + index, data + index + count);
+        Memory::RelocateRange(data + index, data + index + count, m_size - index - count);
+        m_size -= count;
+    }
+
+    void RemoveAtSwap(const u64 index)
+    {
+        // Moves last element into the gap, which is faster but does not preserve order.
+        ASSERT(index < m_size, "Out of bounds remove with %llu index and %llu size", index, m_size);
+
+        Type* data = m_allocation.GetPointer();
+        const u64 lastIndex = m_size - 1;
+        Memory::Destruct(data + index);
+        Memory::RelocateRange(data + index, data + lastIndex, index != lastIndex ? 1 : 0);
+        m_size = lastIndex;
+    }
+
+    template<typename Predicate>
+    u64 RemoveIf(const Predicate& predicate)
+    {
+        // Removes matching elements in a single pass while preserving order.
+        // Runs of kept elements are relocated together to minimize moves.
+        Type* data = m_allocation.GetPointer();
+        u64 writeIndex = 0;
+        u64 runIndex = 0;
+
+        for(u64 i = 0; i < m_size; ++i)
+        {
+            if(predicate(std::as_const(data[i])))
+            {
+                Memory::RelocateRange(data + writeIndex, data + runIndex, i - runIndex);
+                writeIndex += i - runIndex;
+                runIndex = i + 1;
+
+                Memory::Destruct(data + i);
+            }
+        }
+
+        Memory::RelocateRange(data + writeIndex, data + runIndex, m_size - runIndex);
+        writeIndex += m_size - runIndex;
+
+        const u64 removedCount = m_size - writeIndex;
+        m_size = writeIndex;
+        return removedCount;
+    }
+
     void Clear()
     {
         if(m_size > 0)
@@ -314,30 +431,38 @@ private:
     }
 };
 
-template<typename Type>
-Type* begin(Array<Type>& array)
+template<typename Type, typename Allocator>
+Type* begin(Array<Type, Allocator>& array)
 {
     return array.GetBeginPtr();
 }
 
-template<typename Type>
-Type* end(Array<Type>& array)
+template<typename Type, typename Allocator>
+Type* end(Array<Type, Allocator>& array)
 {
     return array.GetEndPtr();
 }
 
-template<typename Type>
-const Type* begin(const Array<Type>& array)
+template<typename Type, typename Allocator>
+const Type* begin(const Array<Type, Allocator>& array)
 {
     return array.GetBeginPtr();
 }
 
-template<typename Type>
-const Type* end(const Array<Type>& array)
+template<typename Type, typename Allocator>
+const Type* end(const Array<Type, Allocator>& array)
 {
     return array.GetEndPtr();
 }
 
+namespace Memory
+{
+    // Inline allocator stores elements in place, so they must also be relocatable.
+    template<typename Type, typename Allocator>
+    constexpr bool IsTriviallyRelocatable<Array<Type, Allocator>> =
+        std::is_same_v<Allocator, Allocators::Default> || IsTriviallyRelocatable<Type>;
+}
+
 static_assert(sizeof(Array<u8>) == 24);
 static_assert(sizeof(Array<u32>) == 24);
 static_assert(sizeof(Array<u64>) == 24);
@@ -0,0 +1,71 @@
+#include "Shared.hpp"
+#include "ImmutableString.hpp"
+#include "Common/Utility/Hash.hpp"
+
+ImmutableString::ImmutableString(const char* text)
+    : ImmutableString(StringView(text))
+{
+}
+
+ImmutableString::ImmutableString(const StringView& text)
+{
+    // Empty strings share static empty text without allocating.
+    const u64 length = text.GetLength();
+    if(length == 0)
+        return;
+
+    void* allocation = Memory::Allocators::Default::Allocate(sizeof(Header) + length + 1, alignof(Header));
+    m_header = static_cast<Header*>(allocation);
+    Memory::Construct(m_header);
+    m_header->length = length;
+
+    char* data = m_header->GetData();
+    std::memcpy(data, text.GetData(), length);
+    data[length] = '\0';
+}
+
+u64 ImmutableString::GetHash() const
+{
+    if(m_header == nullptr)
+        return Hash::Fnv1a64("", 0);
+
+    // Zero marks hash that has not been computed yet. Threads computing it at the same time store
+    // the same value, so no ordering is needed. Strings that hash to zero are rehashed every time.
+    u64 hash = m_header->hash.load(std::memory_order_relaxed);
+    if(hash == 0)
+    {
+        hash = Hash::Fnv1a64(m_header->GetData(), m_header->length);
+        m_header->hash.store(hash, std::memory_order_relaxed);
+    }
+
+    return hash;
+}
+
+bool ImmutableString::operator==(const ImmutableString& other) const
+{
+    if(m_header == other.m_header)
+        return true;
+
+    if(GetLength() != other.GetLength())
+        return false;
+
+    // Cached hashes can rule out most strings of the same length without comparing characters.
+    const u64 hash = m_header->hash.load(std::memory_order_relaxed);
+    const u64 otherHash = other.m_header->hash.load(std::memory_order_relaxed);
+    if(hash != 0 && otherHash != 0 && hash != otherHash)
+        return false;
+
+    return std::memcmp(GetData(), other.GetData(), GetLength()) == 0;
+}
+
+void ImmutableString::Release()
+{
+    if(m_header && m_header->refCount.Decrement())
+    {
+        const u64 size = sizeof(Header) + m_header->length + 1;
+        Memory::Destruct(m_header);
+        Memory::Allocators::Default::Deallocate(m_header, size, alignof(Header));
+    }
+
+    m_header = nullptr;
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "StringShared.hpp"
+#include "StringView.hpp"
+#include "Common/Utility/RefCount.hpp"
+
+// String that cannot be modified, so its characters can be shared by all copies instead of being
+// copied like with String. Characters are stored in a single allocation together with reference
+// count and hash, which is computed on first use and then cached. Copies can be made and released
+// from any thread. Suited for names and paths that are stored once and passed around many times.
+class ImmutableString final : public StringShared<ImmutableString, char>
+{
+    struct Header
+    {
+        RefCount<true> refCount{1};
+        mutable std::atomic<u64> hash{0};
+        u64 length = 0;
+
+        char* GetData()
+        {
+            return reinterpret_cast<char*>(this + 1);
+        }
+
+        const char* GetData() const
+        {
+            return reinterpret_cast<const char*>(this + 1);
+        }
+    };
+
+    Header* m_header = nullptr;
+
+public:
+    ImmutableString() = default;
+    ImmutableString(const char* text);
+    ImmutableString(const StringView& text);
+
+    // Explicit, so strings are compared with each other as views instead of being converted.
+    template<typename Allocator>
+    explicit ImmutableString(const StringBase<char, Allocator>& string)
+        : ImmutableString(StringView(string))
+    {
+    }
+
+    ImmutableString(const ImmutableString& other)
+        : m_header(other.m_header)
+    {
+        if(m_header)
+        {
+            m_header->refCount.Increment();
+        }
+    }
+
+    ImmutableString(ImmutableString&& other) noexcept
+        : m_header(other.m_header)
+    {
+        other.m_header = nullptr;
+    }
+
+    ~ImmutableString()
+    {
+        Release();
+    }
+
+    ImmutableString& operator=(const ImmutableString& other)
+    {
+        // New reference is added first, in case both share the same characters.
+        ImmutableString(other).Swap(*this);
+        return *this;
+    }
+
+    ImmutableString& operator=(ImmutableString&& other) noexcept
+    {
+        ImmutableString(Move(other)).Swap(*this);
+        return *this;
+    }
+
+    void Swap(ImmutableString& other)
+    {
+        Header* header = m_header;
+        m_header = other.m_header;
+        other.m_header = header;
+    }
+
+    const char* GetData() const
+    {
+        return m_header ? m_header->GetData() : "";
+    }
+
+    u64 GetLength() const
+    {
+        return m_header ? m_header->length : 0;
+    }
+
+    bool IsNullTerminated() const
+    {
+        return true;
+    }
+
+    // Same as Hash::Fnv1a64() of characters.
+    u64 GetHash() const;
+
+    // Number of strings sharing the same characters, which is zero for empty string.
+    u32 GetRefCount() const
+    {
+        return m_header ? m_header->refCount.Get() : 0;
+    }
+
+    using StringShared::operator==;
+    using StringShared::operator!=;
+
+    bool operator==(const ImmutableString& other) const;
+
+    bool operator!=(const ImmutableString& other) const
+    {
+        return !(*this == other);
+    }
+
+    operator StringView() const
+    {
+        return { GetData(), GetLength() };
+    }
+
+private:
+    void Release();
+};
+
+namespace Memory
+{
+    template<>
+    constexpr bool IsTriviallyRelocatable<ImmutableString> = true;
+}
+
+static_assert(sizeof(ImmutableString) == 8);
@@ -0,0 +1,268 @@
+#pragma once
+
+#include "Memory/Memory.hpp"
+#include "Memory/Allocators/Default.hpp"
+#include "Memory/Allocators/Inline.hpp"
+
+// Bounded lock-free queue for any number of producer and consumer threads.
+// Each cell stores a sequence number that tells which lap of the ring it is ready for,
+// so threads only contend on a single compare-exchange of enqueue or dequeue position
+// and never wait on each other while constructing or moving out elements.
+// Based on bounded MPMC queue design by Dmitry Vyukov.
+template<typename Type, typename Allocator = Memory::Allocators::Default>
+class MpmcRingQueue final : NonCopyable
+{
+    struct Cell
+    {
+        std::atomic<u64> sequence;
+        Memory::ObjectStorage<Type> storage;
+
+        explicit Cell(const u64 index)
+            : sequence(index)
+        {
+        }
+
+        Type* GetElement()
+        {
+            return reinterpret_cast<Type*>(&storage);
+        }
+    };
+
+    using Allocation = typename Allocator::template TypedAllocation<Memory::ObjectStorage<Cell>>;
+    Allocation m_allocation;
+    u64 m_mask = 0;
+
+    alignas(Memory::CacheLineSize) std::atomic<u64> m_enqueuePosition = 0;
+    alignas(Memory::CacheLineSize) std::atomic<u64> m_dequeuePosition = 0;
+
+public:
+    // Uses initial storage of the allocator as capacity, which is fixed at compile time for inline allocator.
+    MpmcRingQueue()
+    {
+        const u64 capacity = m_allocation.GetCapacity();
+        ASSERT(capacity >= 2 && IsPow2(capacity), "Allocator must provide initial power of two capacity");
+        ConstructCells(capacity);
+    }
+
+    explicit MpmcRingQueue(const u64 capacity)
+    {
+        // Sequence numbers of single cell queue cannot tell full and empty states apart.
+        const u64 minimumCapacity = std::max<u64>(capacity, 2);
+        const u64 roundedCapacity = IsPow2(minimumCapacity) ? minimumCapacity : NextPow2(minimumCapacity);
+        m_allocation.Resize(roundedCapacity, 0);
+        ASSERT_SLOW(m_allocation.GetCapacity() >= roundedCapacity);
+        ConstructCells(roundedCapacity);
+    }
+
+    ~MpmcRingQueue()
+    {
+        // All threads must have stopped using the queue at this point.
+        const u64 enqueuePosition = m_enqueuePosition.load(std::memory_order_acquire);
+        for(u64 position = m_dequeuePosition.load(std::memory_order_acquire); position != enqueuePosition; ++position)
+        {
+            GetCell(position).GetElement()->~Type();
+        }
+
+        for(u64 i = 0; i <= m_mask; ++i)
+        {
+            GetCell(i).~Cell();
+        }
+    }
+
+    // Returns false without constructing element if queue is full.
+    template<typename... Arguments>
+    bool Push(Arguments&&... arguments)
+    {
+        u64 position = m_enqueuePosition.load(std::memory_order_relaxed);
+        Cell* cell;
+        while(true)
+        {
+            cell = &GetCell(position);
+            const u64 sequence = cell->sequence.load(std::memory_order_acquire);
+            const i64 difference = static_cast<i64>(sequence - position);
+            if(difference == 0)
+            {
+                if(m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if(difference < 0)
+            {
+                // Cell still holds element from previous lap.
+                return false;
+            }
+            else
+            {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        Memory::Construct(cell->GetElement(), Forward<Arguments>(arguments)...);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Claims a run of consecutive free cells with one compare-exchange
+    // and copies as many elements into them as fit.
+    u64 PushBatch(const Type* elements, const u64 count)
+    {
+        ASSERT(elements != nullptr || count == 0);
+        if(count == 0)
+            return 0;
+
+        u64 position = m_enqueuePosition.load(std::memory_order_relaxed);
+        u64 claimCount;
+        while(true)
+        {
+            claimCount = CountCells(position, count, 0);
+            if(claimCount == 0)
+            {
+                const i64 difference = static_cast<i64>(GetCell(position).sequence.load(std::memory_order_acquire) - position);
+                if(difference < 0)
+                    return 0;
+
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if(m_enqueuePosition.compare_exchange_weak(position, position + claimCount, std::memory_order_relaxed))
+                break;
+        }
+
+        for(u64 i = 0; i < claimCount; ++i)
+        {
+            Cell& cell = GetCell(position + i);
+            Memory::Construct(cell.GetElement(), elements[i]);
+            cell.sequence.store(position + i + 1, std::memory_order_release);
+        }
+
+        return claimCount;
+    }
+
+    // Returns false if queue is empty.
+    bool Pop(Type& element)
+    {
+        u64 position = m_dequeuePosition.load(std::memory_order_relaxed);
+        Cell* cell;
+        while(true)
+        {
+            cell = &GetCell(position);
+            const u64 sequence = cell->sequence.load(std::memory_order_acquire);
+            const i64 difference = static_cast<i64>(sequence - (position + 1));
+            if(difference == 0)
+            {
+                if(m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if(difference < 0)
+            {
+                // Cell has not been written for this lap yet.
+                return false;
+            }
+            else
+            {
+                position = m_dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        Type* stored = cell->GetElement();
+        element = Move(*stored);
+        stored->~Type();
+
+        cell->sequence.store(position + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Claims a run of consecutive ready cells with one compare-exchange
+    // and moves up to count elements out of them.
+    u64 PopBatch(Type* elements, const u64 count)
+    {
+        ASSERT(elements != nullptr || count == 0);
+        if(count == 0)
+            return 0;
+
+        u64 position = m_dequeuePosition.load(std::memory_order_relaxed);
+        u64 claimCount;
+        while(true)
+        {
+            claimCount = CountCells(position, count, 1);
+            if(claimCount == 0)
+            {
+                const i64 difference = static_cast<i64>(GetCell(position).sequence.load(std::memory_order_acquire) - (position + 1));
+                if(difference < 0)
+                    return 0;
+
+                position = m_dequeuePosition.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if(m_dequeuePosition.compare_exchange_weak(position, position + claimCount, std::memory_order_relaxed))
+                break;
+        }
+
+        for(u64 i = 0; i < claimCount; ++i)
+        {
+            Cell& cell = GetCell(position + i);
+            Type* stored = cell.GetElement();
+            elements[i] = Move(*stored);
+            stored->~Type();
+
+            cell.sequence.store(position + i + m_mask + 1, std::memory_order_release);
+        }
+
+        return claimCount;
+    }
+
+    u64 GetCapacity() const
+    {
+        return m_mask + 1;
+    }
+
+    // Only approximate while other threads are concurrently using the queue.
+    u64 GetSize() const
+    {
+        const u64 dequeuePosition = m_dequeuePosition.load(std::memory_order_acquire);
+        const u64 enqueuePosition = m_enqueuePosition.load(std::memory_order_acquire);
+        return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+    }
+
+    bool IsEmpty() const
+    {
+        return GetSize() == 0;
+    }
+
+private:
+    void ConstructCells(const u64 capacity)
+    {
+        m_mask = capacity - 1;
+        for(u64 i = 0; i < capacity; ++i)
+        {
+            Memory::Construct(&GetCell(i), i);
+        }
+    }
+
+    Cell& GetCell(const u64 position)
+    {
+        return *reinterpret_cast<Cell*>(m_allocation.GetPointer() + (position & m_mask));
+    }
+
+    // Counts consecutive cells starting at position whose sequence matches
+    // their position plus offset, which is 0 for free and 1 for ready cells.
+    u64 CountCells(const u64 position, const u64 count, const u64 offset)
+    {
+        const u64 maxCount = std::min(count, GetCapacity());
+        u64 cellCount = 0;
+        while(cellCount < maxCount)
+        {
+            const u64 cellPosition = position + cellCount;
+            if(GetCell(cellPosition).sequence.load(std::memory_order_acquire) != cellPosition + offset)
+                break;
+
+            ++cellCount;
+        }
+
+        return cellCount;
+    }
+};
+
+template<typename Type, u64 Capacity>
+using InlineMpmcRingQueue = MpmcRingQueue<Type, Memory::Allocators::Inline<Capacity>>;
@@ -0,0 +1,73 @@
+#pragma once
+
+// Non-owning view of contiguous elements, such as part of an array or serialized buffer.
+template<typename Type>
+class Span final
+{
+    Type* m_data = nullptr;
+    u64 m_size = 0;
+
+public:
+    using ElementType = Type;
+
+    Span() = default;
+
+    Span(Type* data, const u64 size)
+        : m_data(data)
+        , m_size(size)
+    {
+        ASSERT(m_data || m_size == 0);
+    }
+
+    template<typename Allocator>
+    Span(Array<std::remove_const_t<Type>, Allocator>& array)
+        : Span(array.GetData(), array.GetSize())
+    {}
+
+    template<typename Allocator>
+    Span(const Array<std::remove_const_t<Type>, Allocator>& array) requires std::is_const_v<Type>
+        : Span(array.GetData(), array.GetSize())
+    {}
+
+    Type& operator[](const u64 index) const
+    {
+        ASSERT(index < m_size, "Out of bounds access with %llu index and %llu size", index, m_size);
+        return m_data[index];
+    }
+
+    Type* GetData() const
+    {
+        return m_data;
+    }
+
+    u64 GetSize() const
+    {
+        return m_size;
+    }
+
+    u64 GetSizeBytes() const
+    {
+        return m_size * sizeof(Type);
+    }
+
+    bool IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    Type* begin() const
+    {
+        return m_data;
+    }
+
+    Type* end() const
+    {
+        return m_data + m_size;
+    }
+};
+
+namespace Memory
+{
+    template<typename Type>
+    constexpr bool IsTriviallyRelocatable<Span<Type>> = true;
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "Memory/Memory.hpp"
+#include "Memory/Allocators/Default.hpp"
+#include "Memory/Allocators/Inline.hpp"
+
+// Bounded lock-free queue for exactly one producer thread and one consumer thread.
+// Capacity is rounded up to power of two, so indices can wrap with a mask.
+// Producer and consumer indices are kept on separate cache lines, and each side
+// caches the last seen index of the other side to avoid touching its cache line
+// until the cached value runs out.
+template<typename Type, typename Allocator = Memory::Allocators::Default>
+class SpscRingQueue final : NonCopyable
+{
+    using Element = Memory::ObjectStorage<Type>;
+    using Allocation = typename Allocator::template TypedAllocation<Element>;
+    Allocation m_allocation;
+    u64 m_mask = 0;
+
+    // Read by producer and written by consumer.
+    alignas(Memory::CacheLineSize) std::atomic<u64> m_head = 0;
+    u64 m_cachedTail = 0;
+
+    // Read by consumer and written by producer.
+    alignas(Memory::CacheLineSize) std::atomic<u64> m_tail = 0;
+    u64 m_cachedHead = 0;
+
+public:
+    // Uses initial storage of the allocator as capacity, which is fixed at compile time for inline allocator.
+    SpscRingQueue()
+    {
+        const u64 capacity = m_allocation.GetCapacity();
+        ASSERT(capacity > 0 && IsPow2(capacity), "Allocator must provide initial power of two capacity");
+        m_mask = capacity - 1;
+    }
+
+    explicit SpscRingQueue(const u64 capacity)
+    {
+        ASSERT(capacity > 0);
+        const u64 roundedCapacity = IsPow2(capacity) ? capacity : NextPow2(capacity);
+        m_allocation.Resize(roundedCapacity, 0);
+        ASSERT_SLOW(m_allocation.GetCapacity() >= roundedCapacity);
+        m_mask = roundedCapacity - 1;
+    }
+
+    ~SpscRingQueue()
+    {
+        // Both threads must have stopped using the queue at this point.
+        const u64 tail = m_tail.load(std::memory_order_acquire);
+        for(u64 head = m_head.load(std::memory_order_relaxed); head != tail; ++head)
+        {
+            GetElement(head)->~Type();
+        }
+    }
+
+    // Producer only. Returns false without constructing element if queue is full.
+    template<typename... Arguments>
+    bool Push(Arguments&&... arguments)
+    {
+        const u64 tail = m_tail.load(std::memory_order_relaxed);
+        if(tail - m_cachedHead > m_mask)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if(tail - m_cachedHead > m_mask)
+                return false;
+        }
+
+        Memory::Construct(GetElement(tail), Forward<Arguments>(arguments)...);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Producer only. Copies as many elements as fit and publishes them at once.
+    u64 PushBatch(const Type* elements, const u64 count)
+    {
+        ASSERT(elements != nullptr || count == 0);
+
+        const u64 tail = m_tail.load(std::memory_order_relaxed);
+        if(GetCapacity() - (tail - m_cachedHead) < count)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+        }
+
+        const u64 pushCount = std::min(count, GetCapacity() - (tail - m_cachedHead));
+        for(u64 i = 0; i < pushCount; ++i)
+        {
+            Memory::Construct(GetElement(tail + i), elements[i]);
+        }
+
+        if(pushCount > 0)
+        {
+            m_tail.store(tail + pushCount, std::memory_order_release);
+        }
+
+        return pushCount;
+    }
+
+    // Consumer only. Returns false if queue is empty.
+    bool Pop(Type& element)
+    {
+        const u64 head = m_head.load(std::memory_order_relaxed);
+        if(head == m_cachedTail)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if(head == m_cachedTail)
+                return false;
+        }
+
+        Type* stored = GetElement(head);
+        element = Move(*stored);
+        stored->~Type();
+
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only. Moves up to count elements out and releases their slots at once.
+    u64 PopBatch(Type* elements, const u64 count)
+    {
+        ASSERT(elements != nullptr || count == 0);
+
+        const u64 head = m_head.load(std::memory_order_relaxed);
+        if(m_cachedTail - head < count)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+        }
+
+        const u64 popCount = std::min(count, m_cachedTail - head);
+        for(u64 i = 0; i < popCount; ++i)
+        {
+            Type* stored = GetElement(head + i);
+            elements[i] = Move(*stored);
+            stored->~Type();
+        }
+
+        if(popCount > 0)
+        {
+            m_head.store(head + popCount, std::memory_order_release);
+        }
+
+        return popCount;
+    }
+
+    u64 GetCapacity() const
+    {
+        return m_mask + 1;
+    }
+
+    // Only approximate while other thread is concurrently using the queue.
+    u64 GetSize() const
+    {
+        const u64 head = m_head.load(std::memory_order_acquire);
+        const u64 tail = m_tail.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    bool IsEmpty() const
+    {
+        return GetSize() == 0;
+    }
+
+private:
+    Type* GetElement(const u64 index)
+    {
+        return reinterpret_cast<Type*>(m_allocation.GetPointer() + (index & m_mask));
+    }
+};
+
+template<typename Type, u64 Capacity>
+using InlineSpscRingQueue = SpscRingQueue<Type, Memory::Allocators::Inline<Capacity>>;
@@ -18,8 +18,6 @@ class StringBase : public StringShared<StringBase<CharType, Allocator>, CharType
     Allocation m_allocation;
     u64 m_length = 0;
 
-    // #bug: Fix all usages of std::strlen() which will work only with 1 byte char type.
-
 public:
     static constexpr u64 CharSize = sizeof(CharType);
     static constexpr u64 NullCount = 1;
@@ -33,7 +31,7 @@ public:
 
     StringBase(const CharType* text)
     {
-        ConstructFromText(text, std::strlen(text));
+        ConstructFromText(text, GetTextLength(text));
     }
 
     StringBase(const CharType* text, const u64 length)
@@ -65,7 +63,7 @@ public:
 
     StringBase& operator=(const CharType* text)
     {
-        ConstructFromText(text, std::strlen(text));
+        ConstructFromText(text, GetTextLength(text));
         return *this;
     }
 
@@ -155,6 +153,23 @@ public:
         m_length = 0;
     }
 
+    // Extends length over characters that are written directly into returned memory. Characters can
+    // also be written before the call into capacity reserved beforehand, when their count is not known.
+    CharType* AddUninitialized(const u64 length)
+    {
+        const u64 oldLength = m_length;
+        const u64 newLength = m_length + length;
+
+        Reserve(newLength, false);
+        if(CharType* data = m_allocation.GetPointer())
+        {
+            data[newLength] = NullChar;
+        }
+
+        m_length = newLength;
+        return GetData() + oldLength;
+    }
+
     CharType* GetData()
     {
         if(CharType* data = m_allocation.GetPointer())
@@ -226,7 +241,7 @@ public:
     StringBase operator+(const CharType* other) const
     {
         ASSERT(other);
-        const u64 otherLength = std::strlen(other);
+        const u64 otherLength = GetTextLength(other);
         const u64 length = m_length + otherLength;
 
         StringBase result;
@@ -258,11 +273,26 @@ public:
         m_length = newLength;
     }
 
+    void operator+=(const StringViewBase<CharType>& other)
+    {
+        const u64 oldLength = m_length;
+        const u64 newLength = m_length + other.GetLength();
+
+        Reserve(newLength, false);
+        if(CharType* data = m_allocation.GetPointer())
+        {
+            std::memcpy(data + oldLength, other.GetData(), other.GetLength() * sizeof(CharType));
+            data[newLength] = NullChar;
+        }
+
+        m_length = newLength;
+    }
+
     void operator+=(const CharType* other)
     {
         ASSERT(other);
         const u64 oldLength = m_length;
-        const u64 otherLength = std::strlen(other);
+        const u64 otherLength = GetTextLength(other);
         const u64 newLength = m_length + otherLength;
 
         Reserve(newLength, false);
@@ -363,6 +393,12 @@ private:
     }
 };
 
+namespace Memory
+{
+    template<typename CharType, typename Allocator>
+    constexpr bool IsTriviallyRelocatable<StringBase<CharType, Allocator>> = true;
+}
+
 using DefaultStringAllocator = Memory::Allocators::Inline<16>;
 using String = StringBase<char, DefaultStringAllocator>;
 static_assert(sizeof(String) == 32);
@@ -373,3 +409,6 @@ static_assert(sizeof(InlineString<16>) == 32);
 
 using HeapString = StringBase<char, Memory::Allocators::Default>;
 static_assert(sizeof(HeapString) == 24);
+
+using String16 = StringBase<char16_t, DefaultStringAllocator>;
+using String32 = StringBase<char32_t, DefaultStringAllocator>;
@@ -0,0 +1,95 @@
+#include "Shared.hpp"
+#include "StringBuilder.hpp"
+
+StringBuilder::~StringBuilder()
+{
+    Clear();
+}
+
+StringBuilder::StringBuilder(StringBuilder&& other) noexcept
+{
+    *this = Move(other);
+}
+
+StringBuilder& StringBuilder::operator=(StringBuilder&& other) noexcept
+{
+    ASSERT_SLOW(this != &other);
+    Clear();
+
+    m_head = other.m_head;
+    m_tail = other.m_tail;
+    m_length = other.m_length;
+    m_chunkCount = other.m_chunkCount;
+
+    other.m_head = nullptr;
+    other.m_tail = nullptr;
+    other.m_length = 0;
+    other.m_chunkCount = 0;
+    return *this;
+}
+
+void StringBuilder::AppendText(const StringView& text)
+{
+    // Text is split between remaining space of last chunk and a new one.
+    const char* source = text.GetData();
+    u64 remaining = text.GetLength();
+
+    if(m_tail != nullptr)
+    {
+        const u64 copySize = std::min(remaining, m_tail->capacity - m_tail->length);
+        std::memcpy(m_tail->GetData() + m_tail->length, source, copySize);
+        m_tail->length += copySize;
+        source += copySize;
+        remaining -= copySize;
+    }
+
+    if(remaining > 0)
+    {
+        std::memcpy(AddChunk(remaining), source, remaining);
+        m_tail->length += remaining;
+    }
+
+    m_length += text.GetLength();
+}
+
+void StringBuilder::Clear()
+{
+    Chunk* chunk = m_head;
+    while(chunk != nullptr)
+    {
+        Chunk* next = chunk->next;
+        Memory::Allocators::Default::Deallocate(chunk, sizeof(Chunk) + chunk->capacity, alignof(Chunk));
+        chunk = next;
+    }
+
+    m_head = nullptr;
+    m_tail = nullptr;
+    m_length = 0;
+    m_chunkCount = 0;
+}
+
+char* StringBuilder::AddChunk(const u64 minimumCapacity)
+{
+    // Chunks grow geometrically up to a limit, so memory overhead remains
+    // proportional to content, while large appends get chunk of their own.
+    const u64 nextCapacity = m_tail != nullptr ? std::min(m_tail->capacity * 2, MaxChunkCapacity) : MinChunkCapacity;
+    const u64 capacity = std::max(nextCapacity, minimumCapacity);
+
+    void* allocation = Memory::Allocators::Default::Allocate(sizeof(Chunk) + capacity, alignof(Chunk));
+    Chunk* chunk = static_cast<Chunk*>(allocation);
+    Memory::Construct(chunk);
+    chunk->capacity = capacity;
+
+    if(m_tail != nullptr)
+    {
+        m_tail->next = chunk;
+    }
+    else
+    {
+        m_head = chunk;
+    }
+
+    m_tail = chunk;
+    ++m_chunkCount;
+    return chunk->GetData();
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "String.hpp"
+#include "StringView.hpp"
+
+// Builder that appends text into a chain of chunks instead of a single
+// contiguous buffer, so previously appended text is never copied again
+// when more space is needed. Chunks can be concatenated into a string
+// once with Build() or written out directly without concatenation.
+class StringBuilder final : NonCopyable
+{
+    struct Chunk
+    {
+        Chunk* next = nullptr;
+        u64 length = 0;
+        u64 capacity = 0;
+
+        char* GetData()
+        {
+            return reinterpret_cast<char*>(this + 1);
+        }
+
+        const char* GetData() const
+        {
+            return reinterpret_cast<const char*>(this + 1);
+        }
+    };
+
+    Chunk* m_head = nullptr;
+    Chunk* m_tail = nullptr;
+    u64 m_length = 0;
+    u64 m_chunkCount = 0;
+
+public:
+    static constexpr u64 MinChunkCapacity = 256;
+    static constexpr u64 MaxChunkCapacity = 64 * 1024;
+
+    StringBuilder() = default;
+    ~StringBuilder();
+
+    StringBuilder(StringBuilder&& other) noexcept;
+    StringBuilder& operator=(StringBuilder&& other) noexcept;
+
+    void AppendText(const StringView& text);
+
+    template<typename... Arguments>
+    void Append(const char* format, Arguments&&... arguments)
+    {
+        ASSERT(format);
+
+        // Format directly into remaining space of last chunk and
+        // format again into a new chunk only when it does not fit.
+        char* destination = m_tail ? m_tail->GetData() + m_tail->length : nullptr;
+        const u64 available = m_tail ? m_tail->capacity - m_tail->length : 0;
+        const int result = std::snprintf(destination, available, format, Forward<Arguments>(arguments)...);
+        ASSERT(result >= 0, "Failed to format string");
+
+        // Formatting requires space for null terminator, which is not included in chunk length.
+        const u64 length = static_cast<u64>(result);
+        if(length >= available)
+        {
+            destination = AddChunk(length + 1);
+            std::snprintf(destination, length + 1, format, Forward<Arguments>(arguments)...);
+        }
+
+        m_tail->length += length;
+        m_length += length;
+    }
+
+    template<typename Allocator = DefaultStringAllocator>
+    StringBase<char, Allocator> Build() const
+    {
+        StringBase<char, Allocator> result;
+        result.Reserve(m_length);
+
+        ForEachChunk([&result](const StringView& chunk)
+        {
+            result += chunk;
+        });
+
+        return result;
+    }
+
+    template<typename Function>
+    void ForEachChunk(Function&& function) const
+    {
+        for(const Chunk* chunk = m_head; chunk != nullptr; chunk = chunk->next)
+        {
+            if(chunk->length != 0)
+            {
+                function(StringView(chunk->GetData(), chunk->length));
+            }
+        }
+    }
+
+    void Clear();
+
+    u64 GetLength() const
+    {
+        return m_length;
+    }
+
+    u64 GetChunkCount() const
+    {
+        return m_chunkCount;
+    }
+
+    bool IsEmpty() const
+    {
+        return m_length == 0;
+    }
+
+private:
+    char* AddChunk(u64 minimumCapacity);
+};
@@ -3,6 +3,26 @@
 template<typename CharType>
 class StringViewBase;
 
+// Counts characters before null terminator, for any character type unlike std::strlen().
+template<typename CharType>
+u64 GetTextLength(const CharType* text)
+{
+    if constexpr(sizeof(CharType) == 1)
+    {
+        return std::strlen(reinterpret_cast<const char*>(text));
+    }
+    else
+    {
+        const CharType* end = text;
+        while(*end != CharType())
+        {
+            ++end;
+        }
+
+        return end - text;
+    }
+}
+
 template<typename StringType, typename CharType>
 class StringShared
 {
@@ -31,12 +51,29 @@ public:
 
     Optional<u64> FindIndex(const StringViewBase<CharType>& other) const
     {
-        // #bug: memmem() will work only with char type of 1 byte.
-        const void* result = memmem(GetData(), GetLength(), other.GetData(), other.GetLength());
-        if(result == nullptr)
-            return {};
+        if constexpr(sizeof(CharType) == 1)
+        {
+            const void* result = memmem(GetData(), GetLength(), other.GetData(), other.GetLength());
+            if(result == nullptr)
+                return {};
+
+            return static_cast<const CharType*>(result) - GetData();
+        }
+        else
+        {
+            // Bytes of wider characters could match across character boundaries with memmem().
+            if(other.GetLength() > GetLength())
+                return {};
+
+            const u64 lastIndex = GetLength() - other.GetLength();
+            for(u64 index = 0; index <= lastIndex; ++index)
+            {
+                if(std::memcmp(GetData() + index, other.GetData(), other.GetLength() * sizeof(CharType)) == 0)
+                    return index;
+            }
 
-        return static_cast<const CharType*>(result) - GetData();
+            return {};
+        }
     }
 
     bool StartsWith(const StringViewBase<CharType>& other) const
@@ -44,7 +81,7 @@ public:
         if(other.GetLength() > GetLength())
             return false;
 
-        return std::memcmp(GetData(), other.GetData(), other.GetLength()) == 0;
+        return std::memcmp(GetData(), other.GetData(), other.GetLength() * sizeof(CharType)) == 0;
     }
 
     bool EndsWith(const StringViewBase<CharType>& other) const
@@ -53,7 +90,7 @@ public:
             return false;
 
         const u64 offset = GetLength() - other.GetLength();
-        return std::memcmp(GetData() + offset, other.GetData(), other.GetLength()) == 0;
+        return std::memcmp(GetData() + offset, other.GetData(), other.GetLength() * sizeof(CharType)) == 0;
     }
 
     StringViewBase<CharType> SubString(u64 start, u64 end) const
@@ -104,7 +141,7 @@ public:
 
     bool operator==(const CharType* other) const
     {
-        if(GetLength() != std::strlen(other))
+        if(GetLength() != GetTextLength(other))
             return false;
 
         return std::memcmp(GetData(), other, GetLength() * sizeof(CharType)) == 0;
@@ -112,10 +149,7 @@ public:
 
     bool operator!=(const CharType* other) const
     {
-        if(GetLength() == std::strlen(other))
-            return false;
-
-        return std::memcmp(GetData(), other, GetLength() * sizeof(CharType)) != 0;
+        return !(*this == other);
     }
 
     bool operator==(const StringViewBase<CharType>& other) const
@@ -128,10 +162,7 @@ public:
 
     bool operator!=(const StringViewBase<CharType>& other) const
     {
-        if(GetLength() == other.GetLength())
-            return false;
-
-        return std::memcmp(GetData(), other.GetData(), GetLength() * sizeof(CharType)) != 0;
+        return !(*this == other);
     }
 
     const CharType* operator*() const
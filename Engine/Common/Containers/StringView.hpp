@@ -9,7 +9,10 @@ template<typename CharType>
 class StringViewBase : public StringShared<StringViewBase<CharType>, CharType>
 {
     static_assert(std::is_trivial_v<CharType>);
-    const CharType* m_data = "";
+    static constexpr CharType NullChar = '\0';
+    static constexpr CharType EmptyString[1] = { NullChar };
+
+    const CharType* m_data = EmptyString;
     u64 m_length = 0;
 
 public:
@@ -30,7 +33,7 @@ public:
         ASSERT(this != &other);
 
         m_data = other.m_data;
-        other.m_data = "";
+        other.m_data = EmptyString;
 
         m_length = other.m_length;
         other.m_length = 0;
@@ -40,7 +43,7 @@ public:
 
     StringViewBase(const CharType* data)
         : m_data(data)
-        , m_length(std::strlen(data))
+        , m_length(GetTextLength(data))
     {
     }
 
@@ -70,7 +73,7 @@ public:
 
     bool IsNullTerminated() const
     {
-        return m_data[m_length] == String::NullChar;
+        return m_data[m_length] == NullChar;
     }
 
     template<typename Allocator = DefaultStringAllocator>
@@ -95,8 +98,17 @@ public:
     }
 };
 
+namespace Memory
+{
+    template<typename CharType>
+    constexpr bool IsTriviallyRelocatable<StringViewBase<CharType>> = true;
+}
+
 using StringView = StringViewBase<char>;
 static_assert(sizeof(StringView) == 16);
 
+using StringView16 = StringViewBase<char16_t>;
+using StringView32 = StringViewBase<char32_t>;
+
 // Used along with argument %.*s for printf().
 #define STRING_VIEW_PRINTF_ARG(view) static_cast<int>(view.GetLength()), view.GetBeginPtr()
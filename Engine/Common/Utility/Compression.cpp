@@ -0,0 +1,215 @@
+#include "Shared.hpp"
+#include "Common/Utility/Compression.hpp"
+
+namespace
+{
+    // Sequence is a token, optional literal length bytes, literals, match offset and optional
+    // match length bytes. Both lengths are stored in four bits of token, and values that do not
+    // fit are continued in following bytes that are summed up until one below 255 is found.
+    constexpr u64 MinMatchLength = 4;
+    constexpr u64 MaxMatchOffset = 65535;
+    constexpr u64 LastLiteralCount = 5; // Trailing bytes that must always be literals
+    constexpr u64 MatchSearchLimit = 12; // Last match must start this far from the end
+    constexpr u64 TokenLengthMask = 15;
+
+    constexpr u32 HashTableBits = 12;
+    constexpr u32 HashTableSize = 1u << HashTableBits;
+
+    u32 ReadU32(const u8* data)
+    {
+        u32 value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    u32 HashSequence(const u32 sequence)
+    {
+        return (sequence * 2654435761u) >> (32 - HashTableBits);
+    }
+
+    bool WriteLength(u64 length, u8*& output, const u8* outputEnd)
+    {
+        while(length >= 255)
+        {
+            if(output == outputEnd)
+                return false;
+
+            *output++ = 255;
+            length -= 255;
+        }
+
+        if(output == outputEnd)
+            return false;
+
+        *output++ = static_cast<u8>(length);
+        return true;
+    }
+
+    bool WriteSequence(const u8* literals, const u64 literalCount, const u64 offset,
+        const u64 matchLength, u8*& output, const u8* outputEnd)
+    {
+        if(output == outputEnd)
+            return false;
+
+        const u64 matchCode = matchLength != 0 ? matchLength - MinMatchLength : 0;
+        u8* token = output++;
+        *token = static_cast<u8>((std::min(literalCount, TokenLengthMask) << 4) | std::min(matchCode, TokenLengthMask));
+
+        if(literalCount >= TokenLengthMask && !WriteLength(literalCount - TokenLengthMask, output, outputEnd))
+            return false;
+
+        if(static_cast<u64>(outputEnd - output) < literalCount)
+            return false;
+
+        std::memcpy(output, literals, literalCount);
+        output += literalCount;
+
+        // Last sequence is made of literals alone.
+        if(matchLength == 0)
+            return true;
+
+        if(outputEnd - output < 2)
+            return false;
+
+        *output++ = static_cast<u8>(offset & 0xFF);
+        *output++ = static_cast<u8>(offset >> 8);
+
+        if(matchCode >= TokenLengthMask && !WriteLength(matchCode - TokenLengthMask, output, outputEnd))
+            return false;
+
+        return true;
+    }
+
+    bool ReadLength(u64& length, const u8*& input, const u8* inputEnd)
+    {
+        u8 byte;
+        do
+        {
+            if(input == inputEnd)
+                return false;
+
+            byte = *input++;
+            length += byte;
+        }
+        while(byte == 255);
+
+        return true;
+    }
+}
+
+u64 Compression::Compress(const u8* source, const u64 sourceSize, u8* destination, const u64 destinationCapacity)
+{
+    ASSERT(source || sourceSize == 0);
+    ASSERT(destination || destinationCapacity == 0);
+
+    u8* output = destination;
+    const u8* outputEnd = destination + destinationCapacity;
+    const u8* literals = source;
+
+    if(sourceSize > MatchSearchLimit)
+    {
+        // Positions are offset by one, so zero marks empty slot.
+        u32 hashTable[HashTableSize] = {};
+
+        const u8* input = source;
+        const u8* searchEnd = source + sourceSize - MatchSearchLimit;
+        const u8* matchEnd = source + sourceSize - LastLiteralCount;
+
+        while(input < searchEnd)
+        {
+            const u32 sequence = ReadU32(input);
+            const u32 hash = HashSequence(sequence);
+            const u64 position = input - source;
+            const u32 candidate = hashTable[hash];
+            hashTable[hash] = static_cast<u32>(position + 1);
+
+            if(candidate == 0 || position - (candidate - 1) > MaxMatchOffset || ReadU32(source + candidate - 1) != sequence)
+            {
+                ++input;
+                continue;
+            }
+
+            const u8* match = source + candidate - 1;
+            u64 matchLength = MinMatchLength;
+            while(input + matchLength < matchEnd && input[matchLength] == match[matchLength])
+            {
+                ++matchLength;
+            }
+
+            if(!WriteSequence(literals, input - literals, input - match, matchLength, output, outputEnd))
+                return 0;
+
+            input += matchLength;
+            literals = input;
+        }
+    }
+
+    if(!WriteSequence(literals, source + sourceSize - literals, 0, 0, output, outputEnd))
+        return 0;
+
+    return output - destination;
+}
+
+bool Compression::Decompress(const u8* source, const u64 sourceSize, u8* destination, const u64 destinationSize)
+{
+    ASSERT(source || sourceSize == 0);
+    ASSERT(destination || destinationSize == 0);
+
+    const u8* input = source;
+    const u8* inputEnd = source + sourceSize;
+    u8* output = destination;
+    const u8* outputEnd = destination + destinationSize;
+
+    while(input != inputEnd)
+    {
+        const u8 token = *input++;
+
+        u64 literalCount = token >> 4;
+        if(literalCount == TokenLengthMask && !ReadLength(literalCount, input, inputEnd))
+            return false;
+
+        if(static_cast<u64>(inputEnd - input) < literalCount || static_cast<u64>(outputEnd - output) < literalCount)
+            return false;
+
+        std::memcpy(output, input, literalCount);
+        input += literalCount;
+        output += literalCount;
+
+        if(input == inputEnd)
+            break;
+
+        if(inputEnd - input < 2)
+            return false;
+
+        const u64 offset = input[0] | (static_cast<u64>(input[1]) << 8);
+        input += 2;
+
+        if(offset == 0 || offset > static_cast<u64>(output - destination))
+            return false;
+
+        u64 matchLength = token & TokenLengthMask;
+        if(matchLength == TokenLengthMask && !ReadLength(matchLength, input, inputEnd))
+            return false;
+
+        matchLength += MinMatchLength;
+        if(static_cast<u64>(outputEnd - output) < matchLength)
+            return false;
+
+        // Match may overlap bytes it produces, repeating a short pattern.
+        const u8* match = output - offset;
+        if(offset >= matchLength)
+        {
+            std::memcpy(output, match, matchLength);
+            output += matchLength;
+        }
+        else
+        {
+            for(u64 i = 0; i < matchLength; ++i)
+            {
+                *output++ = *match++;
+            }
+        }
+    }
+
+    return output == outputEnd;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+// Fast lossless compression using LZ4 block format, so data can be produced or inspected with
+// standard LZ4 tools. Decompression runs at memory speed, which suits assets that are compressed
+// once offline and decompressed every time they are loaded. Compressor favors speed over ratio,
+// using a single hash table probe per position without searching for longer matches.
+namespace Compression
+{
+    // Returns maximum size of compressed data, reached when input is incompressible.
+    constexpr u64 GetCompressedBound(const u64 size)
+    {
+        return size + size / 255 + 16;
+    }
+
+    // Returns maximum size that compressed data can decompress into, as every byte
+    // of encoded match length adds at most 255 bytes of output.
+    constexpr u64 GetDecompressedBound(const u64 compressedSize)
+    {
+        return compressedSize * 255;
+    }
+
+    // Returns compressed size, or zero when compressed data does not fit into destination.
+    u64 Compress(const u8* source, u64 sourceSize, u8* destination, u64 destinationCapacity);
+
+    // Fails when compressed data is malformed or does not decompress into exactly destination size.
+    // Never reads or writes out of bounds of either buffer, even for corrupted input.
+    bool Decompress(const u8* source, u64 sourceSize, u8* destination, u64 destinationSize);
+}
@@ -313,4 +313,10 @@ private:
     }
 };
 
+namespace Memory
+{
+    template<typename ReturnType, typename... Arguments>
+    constexpr bool IsTriviallyRelocatable<Function<ReturnType(Arguments...)>> = true;
+}
+
 static_assert(sizeof(Function<void()>) == 16);
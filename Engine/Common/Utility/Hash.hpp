@@ -0,0 +1,19 @@
+#pragma once
+
+// Non-cryptographic hash functions that can also be evaluated at compile time.
+namespace Hash
+{
+    constexpr u64 Fnv1aOffsetBasis = 14695981039346656037ull;
+    constexpr u64 Fnv1aPrime = 1099511628211ull;
+
+    constexpr u64 Fnv1a64(const char* data, const u64 length, u64 hash = Fnv1aOffsetBasis)
+    {
+        for(u64 i = 0; i < length; ++i)
+        {
+            hash ^= static_cast<u8>(data[i]);
+            hash *= Fnv1aPrime;
+        }
+
+        return hash;
+    }
+}
@@ -0,0 +1,806 @@
+#include "Shared.hpp"
+#include "NumberConversion.hpp"
+#include "NumberConversionTables.hpp"
+
+#if defined(COMPILER_MSVC)
+    #include <intrin.h>
+#endif
+
+namespace
+{
+    using namespace NumberConversion::Tables;
+
+    struct UInt128
+    {
+        u64 low;
+        u64 high;
+    };
+
+    UInt128 MultiplyFull(const u64 a, const u64 b)
+    {
+    #if defined(COMPILER_MSVC)
+        UInt128 result;
+        result.low = _umul128(a, b, &result.high);
+        return result;
+    #else
+        const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        return { static_cast<u64>(product), static_cast<u64>(product >> 64) };
+    #endif
+    }
+
+    u64 MultiplyHigh(const u64 a, const u64 b)
+    {
+        return MultiplyFull(a, b).high;
+    }
+
+    constexpr char DigitPairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    bool IsDecimalDigit(const char character)
+    {
+        return static_cast<u8>(character - '0') < 10;
+    }
+
+    // Checks eight characters loaded as little endian integer at once, by testing that
+    // every byte is in 0x30-0x39 range both before and after adding 6 to each of them.
+    bool AreEightDigits(const u64 chars)
+    {
+        return ((chars & 0xF0F0F0F0F0F0F0F0) |
+            (((chars + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+    }
+
+    // Combines digits in pairs, then quads and finally all eight, with three multiplications.
+    u32 ParseEightDigits(u64 chars)
+    {
+        const u64 mask = 0x000000FF000000FF;
+        const u64 multiplier1 = 100 + (1000000ull << 32);
+        const u64 multiplier2 = 1 + (10000ull << 32);
+        chars -= 0x3030303030303030;
+        chars = (chars * 10) + (chars >> 8);
+        chars = (((chars & mask) * multiplier1) + (((chars >> 16) & mask) * multiplier2)) >> 32;
+        return static_cast<u32>(chars);
+    }
+
+    // Accumulates run of digits into value, which wraps around on overflow, and returns end of run.
+    const char* ParseDigits(const char* current, const char* end, u64& value)
+    {
+        while(end - current >= 8)
+        {
+            u64 chars;
+            std::memcpy(&chars, current, sizeof(chars));
+            if(!AreEightDigits(chars))
+                break;
+
+            value = value * 100000000 + ParseEightDigits(chars);
+            current += 8;
+        }
+
+        while(current != end && IsDecimalDigit(*current))
+        {
+            value = value * 10 + static_cast<u64>(*current - '0');
+            ++current;
+        }
+
+        return current;
+    }
+
+    bool ParseUnsignedDigits(const char* current, const char* end, const u64 maxValue, u64& result)
+    {
+        if(current == end)
+            return false;
+
+        while(current != end && *current == '0')
+            ++current;
+
+        // Up to 19 significant digits cannot overflow, so only following digits need checking.
+        const u64 safeCount = end - current < 19 ? end - current : 19;
+        u64 value = 0;
+        const char* parsed = ParseDigits(current, current + safeCount, value);
+        if(parsed != current + safeCount)
+            return false;
+
+        for(; parsed != end; ++parsed)
+        {
+            if(!IsDecimalDigit(*parsed))
+                return false;
+
+            const u64 digit = static_cast<u64>(*parsed - '0');
+            if(value > (maxValue - digit) / 10)
+                return false;
+
+            value = value * 10 + digit;
+        }
+
+        if(value > maxValue)
+            return false;
+
+        result = value;
+        return true;
+    }
+
+    struct DecimalNumber
+    {
+        u64 mantissa = 0;
+        i64 exponent = 0;
+        bool negative = false;
+        bool truncated = false; // Only first 19 significant digits are in mantissa
+    };
+
+    bool ParseDecimalNumber(const StringView& text, DecimalNumber& number)
+    {
+        const char* current = text.GetBeginPtr();
+        const char* end = text.GetEndPtr();
+
+        number.negative = current != end && *current == '-';
+        if(current != end && (*current == '-' || *current == '+'))
+        {
+            ++current;
+        }
+
+        u64 mantissa = 0;
+        const char* integerBegin = current;
+        current = ParseDigits(current, end, mantissa);
+        const char* integerEnd = current;
+
+        const char* fractionBegin = current;
+        const char* fractionEnd = current;
+        if(current != end && *current == '.')
+        {
+            fractionBegin = ++current;
+            current = ParseDigits(current, end, mantissa);
+            fractionEnd = current;
+        }
+
+        i64 digitCount = (integerEnd - integerBegin) + (fractionEnd - fractionBegin);
+        if(digitCount == 0)
+            return false;
+
+        i64 explicitExponent = 0;
+        if(current != end && (*current == 'e' || *current == 'E'))
+        {
+            ++current;
+            const bool negativeExponent = current != end && *current == '-';
+            if(current != end && (*current == '-' || *current == '+'))
+            {
+                ++current;
+            }
+
+            if(current == end || !IsDecimalDigit(*current))
+                return false;
+
+            for(; current != end && IsDecimalDigit(*current); ++current)
+            {
+                // Saturates far beyond range of any float, where result is already zero or infinity.
+                if(explicitExponent < 0x10000000)
+                {
+                    explicitExponent = explicitExponent * 10 + (*current - '0');
+                }
+            }
+
+            if(negativeExponent)
+            {
+                explicitExponent = -explicitExponent;
+            }
+        }
+
+        if(current != end)
+            return false;
+
+        i64 exponent = explicitExponent - (fractionEnd - fractionBegin);
+        if(digitCount > 19)
+        {
+            // Leading zeros are not significant, such as in 0.000123.
+            for(const char* digit = integerBegin; digit != fractionEnd && (*digit == '0' || *digit == '.'); ++digit)
+            {
+                if(*digit == '0')
+                {
+                    --digitCount;
+                }
+            }
+
+            if(digitCount > 19)
+            {
+                // Mantissa wrapped around, so parse again up to first 19 significant digits.
+                const u64 minNineteenDigits = 1000000000000000000;
+                number.truncated = true;
+                mantissa = 0;
+
+                const char* digit = integerBegin;
+                while(mantissa < minNineteenDigits && digit != integerEnd)
+                {
+                    mantissa = mantissa * 10 + static_cast<u64>(*digit++ - '0');
+                }
+
+                if(mantissa >= minNineteenDigits)
+                {
+                    exponent = (integerEnd - digit) + explicitExponent;
+                }
+                else
+                {
+                    digit = fractionBegin;
+                    while(mantissa < minNineteenDigits && digit != fractionEnd)
+                    {
+                        mantissa = mantissa * 10 + static_cast<u64>(*digit++ - '0');
+                    }
+
+                    exponent = (fractionBegin - digit) + explicitExponent;
+                }
+            }
+        }
+
+        number.mantissa = mantissa;
+        number.exponent = exponent;
+        return true;
+    }
+
+    struct Float64Format
+    {
+        using Type = f64;
+        using Bits = u64;
+
+        static constexpr i32 MantissaBits = 52;
+        static constexpr i32 MinimumExponent = -1023;
+        static constexpr i32 InfinitePower = 0x7FF;
+        static constexpr i64 SmallestPowerOfTen = -342;
+        static constexpr i64 LargestPowerOfTen = 308;
+        static constexpr i64 MinRoundToEvenPower = -4;
+        static constexpr i64 MaxRoundToEvenPower = 23;
+    };
+
+    struct Float32Format
+    {
+        using Type = f32;
+        using Bits = u32;
+
+        static constexpr i32 MantissaBits = 23;
+        static constexpr i32 MinimumExponent = -127;
+        static constexpr i32 InfinitePower = 0xFF;
+        static constexpr i64 SmallestPowerOfTen = -65;
+        static constexpr i64 LargestPowerOfTen = 38;
+        static constexpr i64 MinRoundToEvenPower = -17;
+        static constexpr i64 MaxRoundToEvenPower = 10;
+    };
+
+    struct BinaryFloat
+    {
+        u64 mantissa = 0;
+        i32 power2 = 0; // Biased exponent
+    };
+
+    // Multiplies by truncated 128-bit power of five, which is exact enough
+    // unless all bits below requested precision are set in upper half.
+    template<i32 Precision>
+    UInt128 MultiplyByPowerOfFive(const i64 q, const u64 w)
+    {
+        const u64 index = 2 * static_cast<u64>(q - SmallestPowerOfFive);
+        UInt128 product = MultiplyFull(w, PowersOfFive[index]);
+
+        constexpr u64 precisionMask = ~0ull >> Precision;
+        if((product.high & precisionMask) == precisionMask)
+        {
+            const UInt128 lowProduct = MultiplyFull(w, PowersOfFive[index + 1]);
+            product.low += lowProduct.high;
+            if(lowProduct.high > product.low)
+            {
+                ++product.high;
+            }
+        }
+
+        return product;
+    }
+
+    // Computes w * 10^q correctly rounded to nearest, with ties to even, using Eisel-Lemire algorithm.
+    // Power of ten is split into power of two applied to exponent and power of five from table.
+    template<typename Format>
+    BinaryFloat ComputeFloat(const i64 q, u64 w)
+    {
+        if(w == 0 || q < Format::SmallestPowerOfTen)
+            return {};
+
+        if(q > Format::LargestPowerOfTen)
+            return { 0, Format::InfinitePower };
+
+        const i32 leadingZeros = std::countl_zero(w);
+        w <<= leadingZeros;
+
+        const UInt128 product = MultiplyByPowerOfFive<Format::MantissaBits + 3>(q, w);
+        const i32 upperBit = static_cast<i32>(product.high >> 63);
+        const i32 shift = upperBit + 64 - Format::MantissaBits - 3;
+
+        // Binary exponent of 10^q is floor(q * log2(10)) + 63 for normalized table entries.
+        const i32 power2OfTen = ((217706 * static_cast<i32>(q)) >> 16) + 63;
+
+        BinaryFloat result;
+        result.mantissa = product.high >> shift;
+        result.power2 = power2OfTen + upperBit - leadingZeros - Format::MinimumExponent;
+        if(result.power2 <= 0)
+        {
+            // Subnormal value, which may still round up to the smallest normal one.
+            if(-result.power2 + 1 >= 64)
+                return {};
+
+            result.mantissa >>= -result.power2 + 1;
+            result.mantissa += result.mantissa & 1;
+            result.mantissa >>= 1;
+            result.power2 = result.mantissa < (1ull << Format::MantissaBits) ? 0 : 1;
+            return result;
+        }
+
+        // Rounds up by default, except for exact halfway values with even mantissa,
+        // which can only occur for powers of ten with exactly representable products.
+        if(product.low <= 1 && q >= Format::MinRoundToEvenPower && q <= Format::MaxRoundToEvenPower &&
+            (result.mantissa & 3) == 1 && (result.mantissa << shift) == product.high)
+        {
+            result.mantissa &= ~1ull;
+        }
+
+        result.mantissa += result.mantissa & 1;
+        result.mantissa >>= 1;
+        if(result.mantissa >= (2ull << Format::MantissaBits))
+        {
+            result.mantissa = 1ull << Format::MantissaBits;
+            ++result.power2;
+        }
+
+        result.mantissa &= ~(1ull << Format::MantissaBits);
+        if(result.power2 >= Format::InfinitePower)
+            return { 0, Format::InfinitePower };
+
+        return result;
+    }
+
+    template<typename Format>
+    bool IsFiniteBits(const typename Format::Bits bits)
+    {
+        // Checked on bits, as fast math assumes values are always finite.
+        return ((bits >> Format::MantissaBits) & Format::InfinitePower) != Format::InfinitePower;
+    }
+
+    template<typename Format>
+    Optional<typename Format::Type> ParseFloatText(const StringView& text)
+    {
+        using Type = typename Format::Type;
+        using Bits = typename Format::Bits;
+
+        DecimalNumber number;
+        if(!ParseDecimalNumber(text, number))
+            return {};
+
+        const BinaryFloat binary = ComputeFloat<Format>(number.exponent, number.mantissa);
+        if(number.truncated)
+        {
+            // Value lies between truncated mantissa and the next one, so it is known when both round
+            // to the same float. Otherwise fall back to standard library, which is rare in practice.
+            const BinaryFloat upper = ComputeFloat<Format>(number.exponent, number.mantissa + 1);
+            if(upper.mantissa != binary.mantissa || upper.power2 != binary.power2)
+            {
+                const InlineString<64> terminated(text);
+                Type value;
+                if constexpr(std::is_same_v<Type, f32>)
+                    value = std::strtof(*terminated, nullptr);
+                else
+                    value = std::strtod(*terminated, nullptr);
+
+                if(!IsFiniteBits<Format>(std::bit_cast<Bits>(value)))
+                    return {};
+
+                return value;
+            }
+        }
+
+        if(binary.power2 == Format::InfinitePower)
+            return {};
+
+        Bits bits = static_cast<Bits>(binary.mantissa) | (static_cast<Bits>(binary.power2) << Format::MantissaBits);
+        if(number.negative)
+        {
+            bits |= static_cast<Bits>(1) << (sizeof(Bits) * 8 - 1);
+        }
+
+        return std::bit_cast<Type>(bits);
+    }
+
+    u32 CountDecimalDigits(u64 value)
+    {
+        u32 count = 1;
+        while(true)
+        {
+            if(value < 10)
+                return count;
+            if(value < 100)
+                return count + 1;
+            if(value < 1000)
+                return count + 2;
+            if(value < 10000)
+                return count + 3;
+
+            value /= 10000;
+            count += 4;
+        }
+    }
+
+    // Writes exactly count digits of value backwards, two at a time.
+    void WriteDecimalDigits(char* buffer, u64 value, const u32 count)
+    {
+        char* current = buffer + count;
+        while(value >= 100)
+        {
+            const u64 pair = value % 100;
+            value /= 100;
+            current -= 2;
+            std::memcpy(current, DigitPairs + pair * 2, 2);
+        }
+
+        if(value >= 10)
+        {
+            current -= 2;
+            std::memcpy(current, DigitPairs + value * 2, 2);
+        }
+        else
+        {
+            *--current = static_cast<char>('0' + value);
+        }
+    }
+
+    // Writes significand * 10^exponent in fixed or scientific notation.
+    u64 WriteDecimalFloat(char* buffer, u64 significand, i32 exponent)
+    {
+        if(significand == 0)
+        {
+            buffer[0] = '0';
+            return 1;
+        }
+
+        while(significand % 10 == 0)
+        {
+            significand /= 10;
+            ++exponent;
+        }
+
+        const u32 digitCount = CountDecimalDigits(significand);
+        const i32 scientificExponent = exponent + static_cast<i32>(digitCount) - 1;
+
+        char* current = buffer;
+        if(scientificExponent >= -6 && scientificExponent <= 20)
+        {
+            if(exponent >= 0)
+            {
+                WriteDecimalDigits(current, significand, digitCount);
+                current += digitCount;
+                std::memset(current, '0', exponent);
+                current += exponent;
+            }
+            else if(scientificExponent >= 0)
+            {
+                // Digits are shifted to make room for decimal point.
+                const u32 integerCount = static_cast<u32>(scientificExponent) + 1;
+                WriteDecimalDigits(current, significand, digitCount);
+                std::memmove(current + integerCount + 1, current + integerCount, digitCount - integerCount);
+                current[integerCount] = '.';
+                current += digitCount + 1;
+            }
+            else
+            {
+                const u32 zeroCount = static_cast<u32>(-scientificExponent) - 1;
+                *current++ = '0';
+                *current++ = '.';
+                std::memset(current, '0', zeroCount);
+                current += zeroCount;
+                WriteDecimalDigits(current, significand, digitCount);
+                current += digitCount;
+            }
+        }
+        else
+        {
+            // First digit is moved in front of decimal point.
+            WriteDecimalDigits(current + 1, significand, digitCount);
+            current[0] = current[1];
+            if(digitCount > 1)
+            {
+                current[1] = '.';
+                current += digitCount + 1;
+            }
+            else
+            {
+                current += 1;
+            }
+
+            *current++ = 'e';
+            *current++ = scientificExponent < 0 ? '-' : '+';
+
+            const u64 exponentValue = static_cast<u64>(scientificExponent < 0 ? -scientificExponent : scientificExponent);
+            const u32 exponentDigitCount = CountDecimalDigits(exponentValue);
+            WriteDecimalDigits(current, exponentValue, exponentDigitCount);
+            current += exponentDigitCount;
+        }
+
+        return current - buffer;
+    }
+
+    struct DecimalFloat
+    {
+        u64 significand;
+        i32 exponent;
+    };
+
+    // Fixed point approximations of logarithms, exact for the ranges of exponents used below.
+    i32 FloorLog10Pow2(const i32 q)
+    {
+        return static_cast<i32>((q * 661971961083ll) >> 41);
+    }
+
+    i32 FloorLog10ThreeQuartersPow2(const i32 q)
+    {
+        return static_cast<i32>((q * 661971961083ll - 274743187321ll) >> 41);
+    }
+
+    i32 FloorLog2Pow10(const i32 e)
+    {
+        return static_cast<i32>((e * 913124641741ll) >> 38);
+    }
+
+    // Computes upper 64 bits of g * cp / 2^63, with lowest bit set when any discarded bit is set.
+    u64 RoundToOdd64(const u64 g1, const u64 g0, const u64 cp)
+    {
+        const u64 mask63 = (1ull << 63) - 1;
+        const u64 x1 = MultiplyHigh(g0, cp);
+        const u64 y0 = g1 * cp;
+        const u64 y1 = MultiplyHigh(g1, cp);
+        const u64 z = (y0 >> 1) + x1;
+        const u64 vbp = y1 + (z >> 63);
+        return vbp | (((z & mask63) + mask63) >> 63);
+    }
+
+    u32 RoundToOdd32(const u64 g, const u64 cp)
+    {
+        const u64 mask32 = (1ull << 32) - 1;
+        const u64 x1 = MultiplyHigh(g, cp);
+        const u64 vbp = x1 >> 31;
+        return static_cast<u32>(vbp | (((x1 & mask32) + mask32) >> 32));
+    }
+
+    // Finds the shortest decimal in rounding interval of c * 2^q using Schubfach algorithm, picking
+    // the one closest to value when there are two. Values u and w are candidates below and above
+    // value with one digit less, while s and t are ones with full length, see paper by Giulietti.
+    DecimalFloat ToDecimal64(const i32 q, const u64 c)
+    {
+        const u64 out = c & 1;
+        const u64 cb = c << 2;
+        const u64 cbr = cb + 2;
+        u64 cbl;
+        i32 k;
+        if(c != (1ull << 52) || q == -1074)
+        {
+            cbl = cb - 2;
+            k = FloorLog10Pow2(q);
+        }
+        else
+        {
+            // Interval below powers of two is half as wide.
+            cbl = cb - 1;
+            k = FloorLog10ThreeQuartersPow2(q);
+        }
+
+        const i32 h = q + FloorLog2Pow10(-k) + 2;
+        const u64 index = 2 * static_cast<u64>(k - SmallestPowerOfTen);
+        const u64 g1 = PowersOfTen[index];
+        const u64 g0 = PowersOfTen[index + 1];
+
+        const u64 vb = RoundToOdd64(g1, g0, cb << h);
+        const u64 vbl = RoundToOdd64(g1, g0, cbl << h);
+        const u64 vbr = RoundToOdd64(g1, g0, cbr << h);
+
+        const u64 s = vb >> 2;
+        if(s >= 10)
+        {
+            const u64 sp10 = 10 * MultiplyHigh(s, 115292150460684698ull << 4);
+            const u64 tp10 = sp10 + 10;
+            const bool upin = vbl + out <= sp10 << 2;
+            const bool wpin = (tp10 << 2) + out <= vbr;
+            if(upin != wpin)
+                return { upin ? sp10 : tp10, k };
+        }
+
+        const u64 t = s + 1;
+        const bool uin = vbl + out <= s << 2;
+        const bool win = (t << 2) + out <= vbr;
+        if(uin != win)
+            return { uin ? s : t, k };
+
+        const i64 cmp = static_cast<i64>(vb - ((s + t) << 1));
+        return { cmp < 0 || (cmp == 0 && (s & 1) == 0) ? s : t, k };
+    }
+
+    DecimalFloat ToDecimal32(const i32 q, const u32 c)
+    {
+        const u32 out = c & 1;
+        const u64 cb = static_cast<u64>(c) << 2;
+        const u64 cbr = cb + 2;
+        u64 cbl;
+        i32 k;
+        if(c != (1u << 23) || q == -149)
+        {
+            cbl = cb - 2;
+            k = FloorLog10Pow2(q);
+        }
+        else
+        {
+            cbl = cb - 1;
+            k = FloorLog10ThreeQuartersPow2(q);
+        }
+
+        const i32 h = q + FloorLog2Pow10(-k) + 33;
+        const u64 g = PowersOfTen[2 * static_cast<u64>(k - SmallestPowerOfTen)] + 1;
+
+        const u32 vb = RoundToOdd32(g, cb << h);
+        const u32 vbl = RoundToOdd32(g, cbl << h);
+        const u32 vbr = RoundToOdd32(g, cbr << h);
+
+        const u32 s = vb >> 2;
+        if(s >= 10)
+        {
+            const u32 sp10 = 10 * static_cast<u32>((s * 1717986919ull) >> 34);
+            const u32 tp10 = sp10 + 10;
+            const bool upin = vbl + out <= sp10 << 2;
+            const bool wpin = (tp10 << 2) + out <= vbr;
+            if(upin != wpin)
+                return { upin ? sp10 : tp10, k };
+        }
+
+        const u32 t = s + 1;
+        const bool uin = vbl + out <= s << 2;
+        const bool win = (t << 2) + out <= vbr;
+        if(uin != win)
+            return { uin ? s : t, k };
+
+        const i32 cmp = static_cast<i32>(vb - ((s + t) << 1));
+        return { cmp < 0 || (cmp == 0 && (s & 1) == 0) ? s : t, k };
+    }
+
+    u64 WriteNonFinite(char* buffer, const bool nan)
+    {
+        std::memcpy(buffer, nan ? "nan" : "inf", 3);
+        return 3;
+    }
+}
+
+Optional<i64> NumberConversion::ParseInt64(const StringView& text)
+{
+    const char* current = text.GetBeginPtr();
+    const char* end = text.GetEndPtr();
+
+    const bool negative = current != end && *current == '-';
+    if(current != end && (*current == '-' || *current == '+'))
+    {
+        ++current;
+    }
+
+    // Magnitude of minimum is one larger than maximum, and still fits unsigned.
+    const u64 maxMagnitude = negative ? 1ull << 63 : (1ull << 63) - 1;
+    u64 magnitude;
+    if(!ParseUnsignedDigits(current, end, maxMagnitude, magnitude))
+        return {};
+
+    return negative ? static_cast<i64>(0 - magnitude) : static_cast<i64>(magnitude);
+}
+
+Optional<u64> NumberConversion::ParseUInt64(const StringView& text)
+{
+    u64 value;
+    if(!ParseUnsignedDigits(text.GetBeginPtr(), text.GetEndPtr(), std::numeric_limits<u64>::max(), value))
+        return {};
+
+    return value;
+}
+
+Optional<f64> NumberConversion::ParseFloat64(const StringView& text)
+{
+    return ParseFloatText<Float64Format>(text);
+}
+
+Optional<f32> NumberConversion::ParseFloat32(const StringView& text)
+{
+    return ParseFloatText<Float32Format>(text);
+}
+
+u64 NumberConversion::ToCharsInt64(char* buffer, const i64 value)
+{
+    if(value < 0)
+    {
+        buffer[0] = '-';
+        return 1 + ToCharsUInt64(buffer + 1, 0 - static_cast<u64>(value));
+    }
+
+    return ToCharsUInt64(buffer, static_cast<u64>(value));
+}
+
+u64 NumberConversion::ToCharsUInt64(char* buffer, const u64 value)
+{
+    const u32 digitCount = CountDecimalDigits(value);
+    WriteDecimalDigits(buffer, value, digitCount);
+    return digitCount;
+}
+
+u64 NumberConversion::ToCharsFloat64(char* buffer, const f64 value)
+{
+    const u64 bits = std::bit_cast<u64>(value);
+    const u64 fraction = bits & ((1ull << 52) - 1);
+    const u32 biasedExponent = static_cast<u32>(bits >> 52) & 0x7FF;
+
+    char* current = buffer;
+    if(bits >> 63)
+    {
+        *current++ = '-';
+    }
+
+    if(biasedExponent == 0x7FF)
+        return (current - buffer) + WriteNonFinite(current, fraction != 0);
+
+    DecimalFloat decimal = { 0, 0 };
+    if(biasedExponent != 0)
+    {
+        // Integers below 2^53 are already shortest, apart from trailing zeros.
+        const i32 mq = 1075 - static_cast<i32>(biasedExponent);
+        const u64 c = (1ull << 52) | fraction;
+        if(mq > 0 && mq < 53 && ((c >> mq) << mq) == c)
+        {
+            decimal = { c >> mq, 0 };
+        }
+        else
+        {
+            decimal = ToDecimal64(-mq, c);
+        }
+    }
+    else if(fraction != 0)
+    {
+        decimal = ToDecimal64(-1074, fraction);
+    }
+
+    return (current - buffer) + WriteDecimalFloat(current, decimal.significand, decimal.exponent);
+}
+
+u64 NumberConversion::ToCharsFloat32(char* buffer, const f32 value)
+{
+    const u32 bits = std::bit_cast<u32>(value);
+    const u32 fraction = bits & ((1u << 23) - 1);
+    const u32 biasedExponent = (bits >> 23) & 0xFF;
+
+    char* current = buffer;
+    if(bits >> 31)
+    {
+        *current++ = '-';
+    }
+
+    if(biasedExponent == 0xFF)
+        return (current - buffer) + WriteNonFinite(current, fraction != 0);
+
+    DecimalFloat decimal = { 0, 0 };
+    if(biasedExponent != 0)
+    {
+        const i32 mq = 150 - static_cast<i32>(biasedExponent);
+        const u32 c = (1u << 23) | fraction;
+        if(mq > 0 && mq < 24 && ((c >> mq) << mq) == c)
+        {
+            decimal = { c >> mq, 0 };
+        }
+        else
+        {
+            decimal = ToDecimal32(-mq, c);
+        }
+    }
+    else if(fraction != 0)
+    {
+        decimal = ToDecimal32(-149, fraction);
+    }
+
+    return (current - buffer) + WriteDecimalFloat(current, decimal.significand, decimal.exponent);
+}
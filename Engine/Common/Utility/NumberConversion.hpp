@@ -0,0 +1,95 @@
+#pragma once
+
+// Conversion between numbers and their decimal text, independent of locale and without allocations.
+// Parsing accepts only whole text in plain decimal form with optional sign and fails on overflow,
+// instead of clamping like standard library. Digits are consumed eight at a time where possible and
+// floats are parsed with Eisel-Lemire algorithm using only integer arithmetic, so results are always
+// correctly rounded even with fast math enabled. Floats are formatted with Schubfach algorithm as the
+// shortest text that parses back to the same value, in fixed notation for decimal exponents between
+// -6 and 20 and in scientific notation otherwise, similar to how JavaScript prints numbers.
+namespace NumberConversion
+{
+    constexpr u64 MaxIntegerChars = 20; // -9223372036854775808 and 18446744073709551615
+    constexpr u64 MaxFloatChars = 32;
+
+    Optional<i64> ParseInt64(const StringView& text);
+    Optional<u64> ParseUInt64(const StringView& text);
+    Optional<f64> ParseFloat64(const StringView& text);
+    Optional<f32> ParseFloat32(const StringView& text);
+
+    template<typename Type = i64>
+    Optional<Type> ParseInt(const StringView& text)
+    {
+        static_assert(std::is_integral_v<Type> && std::is_signed_v<Type>);
+        const Optional<i64> value = ParseInt64(text);
+        if(!value)
+            return {};
+
+        if constexpr(sizeof(Type) < sizeof(i64))
+        {
+            if(*value < std::numeric_limits<Type>::min() || *value > std::numeric_limits<Type>::max())
+                return {};
+        }
+
+        return static_cast<Type>(*value);
+    }
+
+    template<typename Type = u64>
+    Optional<Type> ParseUInt(const StringView& text)
+    {
+        static_assert(std::is_integral_v<Type> && std::is_unsigned_v<Type> && !std::is_same_v<Type, bool>);
+        const Optional<u64> value = ParseUInt64(text);
+        if(!value)
+            return {};
+
+        if constexpr(sizeof(Type) < sizeof(u64))
+        {
+            if(*value > std::numeric_limits<Type>::max())
+                return {};
+        }
+
+        return static_cast<Type>(*value);
+    }
+
+    // Fails for values that overflow to infinity, while values too small for type round to zero.
+    template<typename Type = f64>
+    Optional<Type> ParseFloat(const StringView& text)
+    {
+        static_assert(std::is_same_v<Type, f32> || std::is_same_v<Type, f64>);
+        if constexpr(std::is_same_v<Type, f32>)
+            return ParseFloat32(text);
+        else
+            return ParseFloat64(text);
+    }
+
+    // Writes characters without null terminator and returns their count.
+    // Buffer must have space for maximum number of characters of value type.
+    u64 ToCharsInt64(char* buffer, i64 value);
+    u64 ToCharsUInt64(char* buffer, u64 value);
+    u64 ToCharsFloat64(char* buffer, f64 value);
+    u64 ToCharsFloat32(char* buffer, f32 value);
+
+    template<typename Type>
+    u64 ToChars(char* buffer, const Type value)
+    {
+        static_assert(std::is_arithmetic_v<Type> && !std::is_same_v<Type, bool>);
+        if constexpr(std::is_same_v<Type, f32>)
+            return ToCharsFloat32(buffer, value);
+        else if constexpr(std::is_same_v<Type, f64>)
+            return ToCharsFloat64(buffer, value);
+        else if constexpr(std::is_signed_v<Type>)
+            return ToCharsInt64(buffer, value);
+        else
+            return ToCharsUInt64(buffer, value);
+    }
+
+    // Appends characters written directly into spare capacity at the end of string.
+    template<typename Allocator, typename Type>
+    void ToChars(StringBase<char, Allocator>& string, const Type value)
+    {
+        constexpr u64 maxChars = std::is_floating_point_v<Type> ? MaxFloatChars : MaxIntegerChars;
+        string.Reserve(string.GetLength() + maxChars, false);
+        const u64 length = ToChars(string.GetData() + string.GetLength(), value);
+        string.AddUninitialized(length);
+    }
+}
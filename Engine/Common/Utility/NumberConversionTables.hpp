@@ -0,0 +1,19 @@
+#pragma once
+
+// Tables of 128-bit approximations of powers, shared by parsing and formatting of floating point numbers.
+namespace NumberConversion::Tables
+{
+    // Powers 5^q for q in [-342, 308] normalized to have highest of 128 bits set, as high and low halves.
+    // Positive powers are truncated and negative ones rounded up, as expected by Eisel-Lemire algorithm.
+    constexpr i32 SmallestPowerOfFive = -342;
+    constexpr i32 LargestPowerOfFive = 308;
+    constexpr u64 PowerOfFiveCount = LargestPowerOfFive - SmallestPowerOfFive + 1;
+    extern const u64 PowersOfFive[PowerOfFiveCount * 2];
+
+    // Values g = floor(beta) + 1 for k in [-324, 292], where 10^-k = beta 2^r and 2^125 <= beta < 2^126,
+    // as 63 high and 63 low bits. These bound powers of ten from above, as expected by Schubfach algorithm.
+    constexpr i32 SmallestPowerOfTen = -324;
+    constexpr i32 LargestPowerOfTen = 292;
+    constexpr u64 PowerOfTenCount = LargestPowerOfTen - SmallestPowerOfTen + 1;
+    extern const u64 PowersOfTen[PowerOfTenCount * 2];
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Memory/Memory.hpp"
+
 template<typename Type>
 class Optional final
 {
@@ -137,3 +139,9 @@ public:
         return m_hasValue;
     }
 };
+
+namespace Memory
+{
+    template<typename Type>
+    constexpr bool IsTriviallyRelocatable<Optional<Type>> = IsTriviallyRelocatable<Type>;
+}
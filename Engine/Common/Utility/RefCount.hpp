@@ -0,0 +1,291 @@
+#pragma once
+
+#include "Memory/Memory.hpp"
+#include "Memory/Allocators/Default.hpp"
+
+// Reference count of shared object. Atomic count can be shared between threads,
+// while local count avoids the cost of atomic operations for objects that never
+// leave the thread that created them.
+template<bool Atomic>
+class RefCount;
+
+template<>
+class RefCount<true> final
+{
+    std::atomic<u32> m_count;
+
+public:
+    explicit RefCount(const u32 count)
+        : m_count(count)
+    {}
+
+    void Increment()
+    {
+        // New reference can only be made from an existing one, so nothing needs to be ordered.
+        m_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Returns true when the last reference has been released. Writes made through other
+    // references are visible to the thread that destroys the object after that.
+    bool Decrement()
+    {
+        ASSERT_SLOW(m_count.load(std::memory_order_relaxed) > 0);
+        if(m_count.fetch_sub(1, std::memory_order_release) == 1)
+        {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return true;
+        }
+
+        return false;
+    }
+
+    // Used to lock weak references, which must not resurrect an object being destroyed.
+    bool IncrementIfNotZero()
+    {
+        u32 count = m_count.load(std::memory_order_relaxed);
+        while(count != 0)
+        {
+            if(m_count.compare_exchange_weak(count, count + 1, std::memory_order_relaxed))
+                return true;
+        }
+
+        return false;
+    }
+
+    u32 Get() const
+    {
+        return m_count.load(std::memory_order_relaxed);
+    }
+};
+
+template<>
+class RefCount<false> final
+{
+    u32 m_count;
+
+public:
+    explicit RefCount(const u32 count)
+        : m_count(count)
+    {}
+
+    void Increment()
+    {
+        ++m_count;
+    }
+
+    bool Decrement()
+    {
+        ASSERT_SLOW(m_count > 0);
+        return --m_count == 0;
+    }
+
+    bool IncrementIfNotZero()
+    {
+        if(m_count == 0)
+            return false;
+
+        ++m_count;
+        return true;
+    }
+
+    u32 Get() const
+    {
+        return m_count;
+    }
+};
+
+// Base for objects that keep their own reference count, so references to them are a single
+// pointer without any control block or separate allocation. Object is deleted with allocator
+// given as template argument once its last reference is released, so it must be created with
+// MakeRef() or Memory::New() using the same allocator. Derived type is used for deletion, and
+// types derived from it further must have virtual destructor like with Memory::Delete().
+template<typename Derived, typename Allocator = Memory::Allocators::Default, bool Atomic = true>
+class RefCounted
+{
+    mutable RefCount<Atomic> m_refCount{0};
+
+public:
+    using AllocatorType = Allocator;
+
+    void AddRef() const
+    {
+        m_refCount.Increment();
+    }
+
+    void Release() const
+    {
+        if(m_refCount.Decrement())
+        {
+            Memory::Delete<Derived, Allocator>(const_cast<Derived*>(static_cast<const Derived*>(this)));
+        }
+    }
+
+    u32 GetRefCount() const
+    {
+        return m_refCount.Get();
+    }
+
+protected:
+    RefCounted() = default;
+    ~RefCounted() = default;
+
+    // Copied object is a new object with references of its own.
+    RefCounted(const RefCounted&)
+        : m_refCount(0)
+    {}
+
+    RefCounted& operator=(const RefCounted&)
+    {
+        return *this;
+    }
+};
+
+// Reference to object with intrusive reference count, such as one derived from RefCounted.
+template<typename Type>
+class RefPtr final
+{
+    template<typename OtherType>
+    friend class RefPtr;
+
+    Type* m_pointer = nullptr;
+
+public:
+    RefPtr() = default;
+
+    RefPtr(std::nullptr_t)
+    {}
+
+    RefPtr(Type* pointer)
+        : m_pointer(pointer)
+    {
+        if(m_pointer)
+        {
+            m_pointer->AddRef();
+        }
+    }
+
+    RefPtr(const RefPtr& other)
+        : RefPtr(other.m_pointer)
+    {}
+
+    RefPtr(RefPtr&& other) noexcept
+        : m_pointer(other.m_pointer)
+    {
+        other.m_pointer = nullptr;
+    }
+
+    template<typename OtherType>
+    RefPtr(const RefPtr<OtherType>& other)
+        : RefPtr(static_cast<Type*>(other.m_pointer))
+    {}
+
+    template<typename OtherType>
+    RefPtr(RefPtr<OtherType>&& other) noexcept
+        : m_pointer(other.m_pointer)
+    {
+        static_assert(std::is_convertible_v<OtherType*, Type*>, "Incompatible types");
+        other.m_pointer = nullptr;
+    }
+
+    ~RefPtr()
+    {
+        Reset();
+    }
+
+    RefPtr& operator=(const RefPtr& other)
+    {
+        // New reference is added first, in case both refer to the same object.
+        RefPtr(other).Swap(*this);
+        return *this;
+    }
+
+    RefPtr& operator=(RefPtr&& other) noexcept
+    {
+        RefPtr(Move(other)).Swap(*this);
+        return *this;
+    }
+
+    RefPtr& operator=(std::nullptr_t)
+    {
+        Reset();
+        return *this;
+    }
+
+    explicit operator bool() const
+    {
+        return IsValid();
+    }
+
+    bool operator==(const RefPtr& other) const
+    {
+        return m_pointer == other.m_pointer;
+    }
+
+    bool operator!=(const RefPtr& other) const
+    {
+        return m_pointer != other.m_pointer;
+    }
+
+    bool operator==(const Type* pointer) const
+    {
+        return m_pointer == pointer;
+    }
+
+    bool operator!=(const Type* pointer) const
+    {
+        return m_pointer != pointer;
+    }
+
+    Type* operator->() const
+    {
+        ASSERT(IsValid());
+        return m_pointer;
+    }
+
+    Type& operator*() const
+    {
+        ASSERT(IsValid());
+        return *m_pointer;
+    }
+
+    Type* Get() const
+    {
+        return m_pointer;
+    }
+
+    void Reset()
+    {
+        if(m_pointer)
+        {
+            Type* pointer = m_pointer;
+            m_pointer = nullptr;
+            pointer->Release();
+        }
+    }
+
+    void Swap(RefPtr& other)
+    {
+        Type* pointer = m_pointer;
+        m_pointer = other.m_pointer;
+        other.m_pointer = pointer;
+    }
+
+    bool IsValid() const
+    {
+        return m_pointer != nullptr;
+    }
+};
+
+template<typename Type, typename... Arguments>
+RefPtr<Type> MakeRef(Arguments&&... arguments)
+{
+    return RefPtr<Type>(Memory::New<Type, typename Type::AllocatorType>(Forward<Arguments>(arguments)...));
+}
+
+namespace Memory
+{
+    template<typename Type>
+    constexpr bool IsTriviallyRelocatable<RefPtr<Type>> = true;
+}
+
+static_assert(sizeof(RefPtr<u8>) == sizeof(u8*));
@@ -0,0 +1,475 @@
+#pragma once
+
+#include "Common/Utility/RefCount.hpp"
+#include "Common/Utility/UniquePtr.hpp"
+
+// Control block shared by all strong and weak references to an object. Object is destroyed
+// when the last strong reference is released, while the block itself is kept alive until
+// the last weak reference is released too. All strong references together hold a single
+// weak reference, so releasing a strong reference only touches weak count once.
+template<bool Atomic>
+class SharedControlBlock : NonCopyable
+{
+public:
+    enum class Operation
+    {
+        DestroyObject,
+        DeallocateBlock,
+    };
+
+    // Single function for both operations keeps the block header as small as possible.
+    using ManageFunction = void(*)(SharedControlBlock* block, Operation operation);
+
+private:
+    RefCount<Atomic> m_strongCount{1};
+    RefCount<Atomic> m_weakCount{1};
+    ManageFunction m_manageFunction = nullptr;
+
+public:
+    explicit SharedControlBlock(const ManageFunction manageFunction)
+        : m_manageFunction(manageFunction)
+    {
+        ASSERT(m_manageFunction);
+    }
+
+    void AddStrongRef()
+    {
+        m_strongCount.Increment();
+    }
+
+    bool TryAddStrongRef()
+    {
+        return m_strongCount.IncrementIfNotZero();
+    }
+
+    void ReleaseStrongRef()
+    {
+        if(m_strongCount.Decrement())
+        {
+            m_manageFunction(this, Operation::DestroyObject);
+            ReleaseWeakRef();
+        }
+    }
+
+    void AddWeakRef()
+    {
+        m_weakCount.Increment();
+    }
+
+    void ReleaseWeakRef()
+    {
+        if(m_weakCount.Decrement())
+        {
+            m_manageFunction(this, Operation::DeallocateBlock);
+        }
+    }
+
+    u32 GetStrongRefCount() const
+    {
+        return m_strongCount.Get();
+    }
+
+protected:
+    ~SharedControlBlock() = default;
+};
+
+// Block created by MakeShared() that stores object right after its header in a single allocation.
+template<typename Type, typename Allocator, bool Atomic>
+class SharedObjectBlock final : public SharedControlBlock<Atomic>
+{
+    using Base = SharedControlBlock<Atomic>;
+    Memory::ObjectStorage<Type> m_storage;
+
+public:
+    template<typename... Arguments>
+    explicit SharedObjectBlock(Arguments&&... arguments)
+        : Base(&Manage)
+    {
+        Memory::Construct(GetObject(), Forward<Arguments>(arguments)...);
+    }
+
+    Type* GetObject()
+    {
+        return reinterpret_cast<Type*>(&m_storage);
+    }
+
+private:
+    static void Manage(Base* base, const typename Base::Operation operation)
+    {
+        SharedObjectBlock* block = static_cast<SharedObjectBlock*>(base);
+        if(operation == Base::Operation::DestroyObject)
+        {
+            Memory::Destruct(block->GetObject());
+        }
+        else
+        {
+            // Object has already been destroyed, so only the block itself is left.
+            block->~SharedObjectBlock();
+            Memory::Deallocate<SharedObjectBlock, Allocator>(block);
+        }
+    }
+};
+
+// Block that takes ownership of separately allocated object together with its deleter.
+template<typename Type, typename Deleter, bool Atomic>
+class SharedPointerBlock final : public SharedControlBlock<Atomic>
+{
+    using Base = SharedControlBlock<Atomic>;
+    Type* m_pointer;
+    Deleter m_deleter;
+
+public:
+    SharedPointerBlock(Type* pointer, Deleter&& deleter)
+        : Base(&Manage)
+        , m_pointer(pointer)
+        , m_deleter(Move(deleter))
+    {}
+
+private:
+    static void Manage(Base* base, const typename Base::Operation operation)
+    {
+        SharedPointerBlock* block = static_cast<SharedPointerBlock*>(base);
+        if(operation == Base::Operation::DestroyObject)
+        {
+            block->m_deleter(block->m_pointer);
+            block->m_pointer = nullptr;
+        }
+        else
+        {
+            Memory::Delete(block);
+        }
+    }
+};
+
+template<typename Type, bool Atomic>
+class WeakPtr;
+
+// Shared ownership of an object through a separate control block. Atomic reference counts
+// allow references to be copied and released from any thread, while the object itself
+// still needs its own synchronization. Local references use plain counts instead and
+// must never be shared between threads.
+template<typename Type, bool Atomic = true>
+class SharedPtr final
+{
+    template<typename OtherType, bool OtherAtomic>
+    friend class SharedPtr;
+
+    template<typename OtherType, bool OtherAtomic>
+    friend class WeakPtr;
+
+    template<typename OtherType, typename Allocator, bool OtherAtomic, typename... Arguments>
+    friend SharedPtr<OtherType, OtherAtomic> AllocateShared(Arguments&&... arguments);
+
+    using ControlBlock = SharedControlBlock<Atomic>;
+
+    Type* m_pointer = nullptr;
+    ControlBlock* m_block = nullptr;
+
+public:
+    SharedPtr() = default;
+
+    SharedPtr(std::nullptr_t)
+    {}
+
+    // Takes ownership of object with its deleter, which needs additional control block allocation.
+    template<typename OtherType, typename Deleter>
+    SharedPtr(UniquePtr<OtherType, Deleter>&& unique)
+    {
+        static_assert(std::is_convertible_v<OtherType*, Type*>, "Incompatible types");
+        if(!unique)
+            return;
+
+        using DeleterType = std::remove_reference_t<decltype(unique.GetDeleter())>;
+        using BlockType = SharedPointerBlock<OtherType, DeleterType, Atomic>;
+        DeleterType deleter = Move(unique.GetDeleter());
+        OtherType* pointer = unique.Detach();
+
+        m_pointer = pointer;
+        m_block = Memory::New<BlockType>(pointer, Move(deleter));
+    }
+
+    SharedPtr(const SharedPtr& other)
+        : m_pointer(other.m_pointer)
+        , m_block(other.m_block)
+    {
+        if(m_block)
+        {
+            m_block->AddStrongRef();
+        }
+    }
+
+    SharedPtr(SharedPtr&& other) noexcept
+        : m_pointer(other.m_pointer)
+        , m_block(other.m_block)
+    {
+        other.m_pointer = nullptr;
+        other.m_block = nullptr;
+    }
+
+    template<typename OtherType>
+    SharedPtr(const SharedPtr<OtherType, Atomic>& other)
+        : m_pointer(other.m_pointer)
+        , m_block(other.m_block)
+    {
+        static_assert(std::is_convertible_v<OtherType*, Type*>, "Incompatible types");
+        if(m_block)
+        {
+            m_block->AddStrongRef();
+        }
+    }
+
+    template<typename OtherType>
+    SharedPtr(SharedPtr<OtherType, Atomic>&& other) noexcept
+        : m_pointer(other.m_pointer)
+        , m_block(other.m_block)
+    {
+        static_assert(std::is_convertible_v<OtherType*, Type*>, "Incompatible types");
+        other.m_pointer = nullptr;
+        other.m_block = nullptr;
+    }
+
+    ~SharedPtr()
+    {
+        Reset();
+    }
+
+    SharedPtr& operator=(const SharedPtr& other)
+    {
+        SharedPtr(other).Swap(*this);
+        return *this;
+    }
+
+    SharedPtr& operator=(SharedPtr&& other) noexcept
+    {
+        SharedPtr(Move(other)).Swap(*this);
+        return *this;
+    }
+
+    SharedPtr& operator=(std::nullptr_t)
+    {
+        Reset();
+        return *this;
+    }
+
+    explicit operator bool() const
+    {
+        return IsValid();
+    }
+
+    bool operator==(const SharedPtr& other) const
+    {
+        return m_pointer == other.m_pointer;
+    }
+
+    bool operator!=(const SharedPtr& other) const
+    {
+        return m_pointer != other.m_pointer;
+    }
+
+    bool operator==(const Type* pointer) const
+    {
+        return m_pointer == pointer;
+    }
+
+    bool operator!=(const Type* pointer) const
+    {
+        return m_pointer != pointer;
+    }
+
+    Type* operator->() const
+    {
+        ASSERT(IsValid());
+        return m_pointer;
+    }
+
+    Type& operator*() const
+    {
+        ASSERT(IsValid());
+        return *m_pointer;
+    }
+
+    Type* Get() const
+    {
+        return m_pointer;
+    }
+
+    // Only approximate while other threads are concurrently using atomic references.
+    u32 GetRefCount() const
+    {
+        return m_block ? m_block->GetStrongRefCount() : 0;
+    }
+
+    void Reset()
+    {
+        if(m_block)
+        {
+            ControlBlock* block = m_block;
+            m_pointer = nullptr;
+            m_block = nullptr;
+            block->ReleaseStrongRef();
+        }
+    }
+
+    void Swap(SharedPtr& other)
+    {
+        Type* pointer = m_pointer;
+        m_pointer = other.m_pointer;
+        other.m_pointer = pointer;
+
+        ControlBlock* block = m_block;
+        m_block = other.m_block;
+        other.m_block = block;
+    }
+
+    bool IsValid() const
+    {
+        return m_pointer != nullptr;
+    }
+
+private:
+    SharedPtr(Type* pointer, ControlBlock* block)
+        : m_pointer(pointer)
+        , m_block(block)
+    {}
+};
+
+// Non-owning reference that does not keep object alive, but can be locked into
+// a strong reference for as long as any other strong reference to it exists.
+template<typename Type, bool Atomic = true>
+class WeakPtr final
+{
+    template<typename OtherType, bool OtherAtomic>
+    friend class WeakPtr;
+
+    using ControlBlock = SharedControlBlock<Atomic>;
+
+    Type* m_pointer = nullptr;
+    ControlBlock* m_block = nullptr;
+
+public:
+    WeakPtr() = default;
+
+    template<typename OtherType>
+    WeakPtr(const SharedPtr<OtherType, Atomic>& shared)
+        : m_pointer(shared.m_pointer)
+        , m_block(shared.m_block)
+    {
+        static_assert(std::is_convertible_v<OtherType*, Type*>, "Incompatible types");
+        if(m_block)
+        {
+            m_block->AddWeakRef();
+        }
+    }
+
+    WeakPtr(const WeakPtr& other)
+        : m_pointer(other.m_pointer)
+        , m_block(other.m_block)
+    {
+        if(m_block)
+        {
+            m_block->AddWeakRef();
+        }
+    }
+
+    WeakPtr(WeakPtr&& other) noexcept
+        : m_pointer(other.m_pointer)
+        , m_block(other.m_block)
+    {
+        other.m_pointer = nullptr;
+        other.m_block = nullptr;
+    }
+
+    ~WeakPtr()
+    {
+        Reset();
+    }
+
+    WeakPtr& operator=(const WeakPtr& other)
+    {
+        WeakPtr(other).Swap(*this);
+        return *this;
+    }
+
+    WeakPtr& operator=(WeakPtr&& other) noexcept
+    {
+        WeakPtr(Move(other)).Swap(*this);
+        return *this;
+    }
+
+    // Returns empty reference if object has already been destroyed.
+    SharedPtr<Type, Atomic> Lock() const
+    {
+        if(m_block && m_block->TryAddStrongRef())
+            return SharedPtr<Type, Atomic>(m_pointer, m_block);
+
+        return {};
+    }
+
+    void Reset()
+    {
+        if(m_block)
+        {
+            ControlBlock* block = m_block;
+            m_pointer = nullptr;
+            m_block = nullptr;
+            block->ReleaseWeakRef();
+        }
+    }
+
+    void Swap(WeakPtr& other)
+    {
+        Type* pointer = m_pointer;
+        m_pointer = other.m_pointer;
+        other.m_pointer = pointer;
+
+        ControlBlock* block = m_block;
+        m_block = other.m_block;
+        other.m_block = block;
+    }
+
+    // Object may still be destroyed right after this returns false, unless locked.
+    bool IsExpired() const
+    {
+        return m_block == nullptr || m_block->GetStrongRefCount() == 0;
+    }
+};
+
+template<typename Type>
+using LocalSharedPtr = SharedPtr<Type, false>;
+
+template<typename Type>
+using LocalWeakPtr = WeakPtr<Type, false>;
+
+// Allocates control block and object together with a single allocation from given allocator.
+// Memory of the object is only released once all weak references are gone too.
+template<typename Type, typename Allocator, bool Atomic, typename... Arguments>
+SharedPtr<Type, Atomic> AllocateShared(Arguments&&... arguments)
+{
+    using BlockType = SharedObjectBlock<Type, Allocator, Atomic>;
+    BlockType* block = Memory::New<BlockType, Allocator>(Forward<Arguments>(arguments)...);
+    return SharedPtr<Type, Atomic>(block->GetObject(), block);
+}
+
+template<typename Type, typename Allocator = Memory::Allocators::Default, typename... Arguments>
+SharedPtr<Type> MakeShared(Arguments&&... arguments)
+{
+    return AllocateShared<Type, Allocator, true>(Forward<Arguments>(arguments)...);
+}
+
+template<typename Type, typename Allocator = Memory::Allocators::Default, typename... Arguments>
+LocalSharedPtr<Type> MakeLocalShared(Arguments&&... arguments)
+{
+    return AllocateShared<Type, Allocator, false>(Forward<Arguments>(arguments)...);
+}
+
+namespace Memory
+{
+    template<typename Type, bool Atomic>
+    constexpr bool IsTriviallyRelocatable<SharedPtr<Type, Atomic>> = true;
+
+    template<typename Type, bool Atomic>
+    constexpr bool IsTriviallyRelocatable<WeakPtr<Type, Atomic>> = true;
+}
+
+static_assert(sizeof(SharedPtr<u8>) == sizeof(u8*) * 2);
+static_assert(sizeof(WeakPtr<u8>) == sizeof(u8*) * 2);
@@ -0,0 +1,177 @@
+#include "Shared.hpp"
+#include "StringId.hpp"
+
+namespace
+{
+    struct StringIdEntry
+    {
+        u64 hash = 0;
+        u64 length = 0;
+        const char* data = nullptr;
+    };
+
+    // Open addressing index that is never modified in place when grown.
+    // New index is published instead and old one is retired but kept
+    // alive, as readers could still be probing it without locking.
+    struct StringIdIndex
+    {
+        std::atomic<const StringIdEntry*>* slots = nullptr;
+        u64 mask = 0;
+        StringIdIndex* retired = nullptr;
+    };
+
+    // Table storage lives until process exit and bypasses tracked allocators,
+    // so interned strings are never reported as leaks or counted by tests.
+    class StringIdTable final : NonCopyable
+    {
+        static constexpr u64 InitialCapacity = 1024;
+        static constexpr u64 ChunkSize = 64 * 1024;
+        static constexpr u32 Alignment = 64;
+
+        std::mutex m_mutex;
+        std::atomic<StringIdIndex*> m_index = nullptr;
+        u64 m_count = 0;
+
+        u8* m_chunkCursor = nullptr;
+        u64 m_chunkRemaining = 0;
+
+    public:
+        static StringIdTable& Get()
+        {
+            static StringIdTable table;
+            return table;
+        }
+
+        const StringIdEntry* Find(const u64 hash) const
+        {
+            const StringIdIndex* index = m_index.load(std::memory_order_acquire);
+            if(index == nullptr)
+                return nullptr;
+
+            for(u64 slot = hash & index->mask;; slot = (slot + 1) & index->mask)
+            {
+                const StringIdEntry* entry = index->slots[slot].load(std::memory_order_acquire);
+                if(entry == nullptr || entry->hash == hash)
+                    return entry;
+            }
+        }
+
+        void Intern(const u64 hash, const StringView& string)
+        {
+            ASSERT(hash != 0);
+            std::lock_guard lock(m_mutex);
+
+            if(const StringIdEntry* existing = Find(hash))
+            {
+                ASSERT_ALWAYS(StringView(existing->data, existing->length) == string,
+                    "String identifier hash collision between \"%s\" and \"%.*s\"",
+                    existing->data, STRING_VIEW_PRINTF_ARG(string));
+                return;
+            }
+
+            // Keep load factor at most one half, so probe sequences remain short.
+            StringIdIndex* index = m_index.load(std::memory_order_relaxed);
+            if(index == nullptr || (m_count + 1) * 2 > index->mask + 1)
+            {
+                index = GrowIndex(index);
+            }
+
+            auto* entry = static_cast<StringIdEntry*>(AllocateStorage(sizeof(StringIdEntry)));
+            char* data = static_cast<char*>(AllocateStorage(string.GetLength() + 1));
+            std::memcpy(data, string.GetData(), string.GetLength());
+            data[string.GetLength()] = '\0';
+
+            Memory::Construct(entry);
+            entry->hash = hash;
+            entry->length = string.GetLength();
+            entry->data = data;
+
+            InsertEntry(index, entry);
+            ++m_count;
+        }
+
+    private:
+        StringIdTable() = default;
+
+        StringIdIndex* GrowIndex(StringIdIndex* previous)
+        {
+            const u64 capacity = previous != nullptr ? (previous->mask + 1) * 2 : InitialCapacity;
+            const u64 slotsSize = Memory::AlignSize(capacity * sizeof(std::atomic<const StringIdEntry*>), Alignment);
+
+            auto* index = static_cast<StringIdIndex*>(AllocateStorage(sizeof(StringIdIndex)));
+            Memory::Construct(index);
+            index->slots = static_cast<std::atomic<const StringIdEntry*>*>(Memory::AlignedAlloc(slotsSize, Alignment));
+            index->mask = capacity - 1;
+            index->retired = previous;
+
+            for(u64 i = 0; i < capacity; ++i)
+            {
+                Memory::Construct(&index->slots[i], nullptr);
+            }
+
+            if(previous != nullptr)
+            {
+                for(u64 i = 0; i <= previous->mask; ++i)
+                {
+                    if(const StringIdEntry* entry = previous->slots[i].load(std::memory_order_relaxed))
+                    {
+                        InsertEntry(index, entry);
+                    }
+                }
+            }
+
+            m_index.store(index, std::memory_order_release);
+            return index;
+        }
+
+        static void InsertEntry(StringIdIndex* index, const StringIdEntry* entry)
+        {
+            u64 slot = entry->hash & index->mask;
+            while(index->slots[slot].load(std::memory_order_relaxed) != nullptr)
+            {
+                slot = (slot + 1) & index->mask;
+            }
+
+            index->slots[slot].store(entry, std::memory_order_release);
+        }
+
+        void* AllocateStorage(u64 size)
+        {
+            size = Memory::AlignSize(size, alignof(StringIdEntry));
+            if(size > m_chunkRemaining)
+            {
+                if(size > ChunkSize / 4)
+                    return Memory::AlignedAlloc(Memory::AlignSize(size, Alignment), Alignment);
+
+                m_chunkCursor = static_cast<u8*>(Memory::AlignedAlloc(ChunkSize, Alignment));
+                m_chunkRemaining = ChunkSize;
+            }
+
+            void* allocation = m_chunkCursor;
+            m_chunkCursor += size;
+            m_chunkRemaining -= size;
+            return allocation;
+        }
+    };
+}
+
+StringId::StringId(const StringView& string)
+    : StringId(Compute(string))
+{
+    if(IsValid())
+    {
+        StringIdTable::Get().Intern(m_hash, string);
+    }
+}
+
+StringView StringId::GetString() const
+{
+    if(!IsValid())
+        return {};
+
+    const StringIdEntry* entry = StringIdTable::Get().Find(m_hash);
+    if(entry == nullptr)
+        return {};
+
+    return { entry->data, entry->length };
+}
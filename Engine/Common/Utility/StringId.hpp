@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Hash.hpp"
+
+// Identifier of a string that is compared as a single integer.
+// Identifier is the string hash itself, so literals can be turned into
+// identifiers at compile time and match identifiers interned at runtime.
+// Interned strings are stored in a global table for the whole process
+// lifetime and can be resolved back from any thread without locking.
+class StringId final
+{
+    u64 m_hash = 0;
+
+public:
+    constexpr StringId() = default;
+
+    // Interns string, so identifier can be resolved back to it later.
+    explicit StringId(const StringView& string);
+
+    // Computes identifier without interning, which is enough for comparisons.
+    static constexpr StringId Compute(const char* data, const u64 length)
+    {
+        // Empty string maps to invalid identifier, which is never stored in the table.
+        StringId id;
+        if(length != 0)
+        {
+            const u64 hash = Hash::Fnv1a64(data, length);
+            id.m_hash = hash != 0 ? hash : 1;
+        }
+
+        return id;
+    }
+
+    static StringId Compute(const StringView& string)
+    {
+        return Compute(string.GetData(), string.GetLength());
+    }
+
+    // Returns empty view for identifiers that have never been interned.
+    StringView GetString() const;
+
+    constexpr u64 GetHash() const
+    {
+        return m_hash;
+    }
+
+    constexpr bool IsValid() const
+    {
+        return m_hash != 0;
+    }
+
+    constexpr bool operator==(const StringId& other) const
+    {
+        return m_hash == other.m_hash;
+    }
+
+    constexpr bool operator!=(const StringId& other) const
+    {
+        return m_hash != other.m_hash;
+    }
+
+    constexpr bool operator<(const StringId& other) const
+    {
+        return m_hash < other.m_hash;
+    }
+};
+
+static_assert(sizeof(StringId) == 8);
+
+consteval StringId operator""_sid(const char* text, const std::size_t length)
+{
+    return StringId::Compute(text, length);
+}
@@ -0,0 +1,422 @@
+#include "Shared.hpp"
+#include "Common/Utility/Unicode.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define UNICODE_SSE2 1
+#else
+    #define UNICODE_SSE2 0
+#endif
+
+namespace
+{
+    constexpr u64 AsciiBlockSize = 16;
+    constexpr u64 AsciiUnitBlockSize = 8;
+
+    // Returns count of leading ASCII bytes in block of sixteen that must be readable.
+    u32 CountAsciiBytes(const u8* data)
+    {
+    #if UNICODE_SSE2
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        const u32 mask = static_cast<u32>(_mm_movemask_epi8(bytes));
+        return mask != 0 ? std::countr_zero(mask) : 16;
+    #else
+        u64 words[2];
+        std::memcpy(words, data, sizeof(words));
+        if(((words[0] | words[1]) & 0x8080808080808080) == 0)
+            return 16;
+
+        u32 count = 0;
+        while(data[count] < 0x80)
+        {
+            ++count;
+        }
+
+        return count;
+    #endif
+    }
+
+    // Widens block of sixteen bytes, of which only leading ASCII ones are kept by caller.
+    void WidenAsciiBytes(const u8* data, char16_t* output)
+    {
+    #if UNICODE_SSE2
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        const __m128i zero = _mm_setzero_si128();
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 8), _mm_unpackhi_epi8(bytes, zero));
+    #else
+        for(u32 i = 0; i < 16; ++i)
+        {
+            output[i] = data[i];
+        }
+    #endif
+    }
+
+    void WidenAsciiBytes(const u8* data, char32_t* output)
+    {
+    #if UNICODE_SSE2
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 4), _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 8), _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 12), _mm_unpackhi_epi16(high, zero));
+    #else
+        for(u32 i = 0; i < 16; ++i)
+        {
+            output[i] = data[i];
+        }
+    #endif
+    }
+
+    // Narrows block of eight units to bytes when all of them are ASCII.
+    bool NarrowAsciiUnits(const char16_t* data, char* output)
+    {
+    #if UNICODE_SSE2
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        const __m128i high = _mm_and_si128(units, _mm_set1_epi16(static_cast<i16>(0xFF80)));
+        if(_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xFFFF)
+            return false;
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_packus_epi16(units, units));
+    #else
+        char16_t combined = 0;
+        for(u32 i = 0; i < 8; ++i)
+        {
+            combined |= data[i];
+        }
+
+        if(combined >= 0x80)
+            return false;
+
+        for(u32 i = 0; i < 8; ++i)
+        {
+            output[i] = static_cast<char>(data[i]);
+        }
+    #endif
+        return true;
+    }
+
+    bool NarrowAsciiUnits(const char32_t* data, char* output)
+    {
+    #if UNICODE_SSE2
+        const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 4));
+        const __m128i outside = _mm_and_si128(_mm_or_si128(low, high), _mm_set1_epi32(static_cast<i32>(0xFFFFFF80)));
+        if(_mm_movemask_epi8(_mm_cmpeq_epi32(outside, _mm_setzero_si128())) != 0xFFFF)
+            return false;
+
+        const __m128i units = _mm_packs_epi32(low, high);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_packus_epi16(units, units));
+    #else
+        char32_t combined = 0;
+        for(u32 i = 0; i < 8; ++i)
+        {
+            combined |= data[i];
+        }
+
+        if(combined >= 0x80)
+            return false;
+
+        for(u32 i = 0; i < 8; ++i)
+        {
+            output[i] = static_cast<char>(data[i]);
+        }
+    #endif
+        return true;
+    }
+
+    // Decodes sequence starting with non-ASCII byte and advances past it. On failure, advances
+    // past longest prefix that could start valid sequence, as recommended by Unicode standard.
+    bool DecodeSequence(const u8*& current, const u8* end, char32_t& codepoint)
+    {
+        const u8 lead = *current++;
+
+        u32 continuationCount;
+        u8 lowerBound = 0x80;
+        u8 upperBound = 0xBF;
+        if(lead >= 0xC2 && lead <= 0xDF)
+        {
+            continuationCount = 1;
+            codepoint = lead & 0x1F;
+        }
+        else if(lead >= 0xE0 && lead <= 0xEF)
+        {
+            // Second byte range excludes overlong encodings and surrogates.
+            continuationCount = 2;
+            codepoint = lead & 0x0F;
+            lowerBound = lead == 0xE0 ? 0xA0 : 0x80;
+            upperBound = lead == 0xED ? 0x9F : 0xBF;
+        }
+        else if(lead >= 0xF0 && lead <= 0xF4)
+        {
+            // Second byte range excludes overlong encodings and codepoints above maximum.
+            continuationCount = 3;
+            codepoint = lead & 0x07;
+            lowerBound = lead == 0xF0 ? 0x90 : 0x80;
+            upperBound = lead == 0xF4 ? 0x8F : 0xBF;
+        }
+        else
+        {
+            return false;
+        }
+
+        for(u32 i = 0; i < continuationCount; ++i)
+        {
+            if(current == end || *current < lowerBound || *current > upperBound)
+                return false;
+
+            codepoint = (codepoint << 6) | (*current++ & 0x3F);
+            lowerBound = 0x80;
+            upperBound = 0xBF;
+        }
+
+        return true;
+    }
+
+    bool IsSurrogate(const char32_t codepoint)
+    {
+        return codepoint >= 0xD800 && codepoint <= 0xDFFF;
+    }
+
+    // Decodes codepoint from one or two units and advances past them.
+    bool DecodeUtf16(const char16_t*& current, const char16_t* end, char32_t& codepoint)
+    {
+        const char16_t unit = *current++;
+        if(!IsSurrogate(unit))
+        {
+            codepoint = unit;
+            return true;
+        }
+
+        if(unit >= 0xDC00 || current == end || *current < 0xDC00 || *current > 0xDFFF)
+            return false;
+
+        codepoint = 0x10000 + ((static_cast<char32_t>(unit - 0xD800) << 10) | (*current++ - 0xDC00));
+        return true;
+    }
+
+    char* WriteUtf8(const char32_t codepoint, char* output)
+    {
+        if(codepoint < 0x80)
+        {
+            *output++ = static_cast<char>(codepoint);
+        }
+        else if(codepoint < 0x800)
+        {
+            *output++ = static_cast<char>(0xC0 | (codepoint >> 6));
+            *output++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+        else if(codepoint < 0x10000)
+        {
+            *output++ = static_cast<char>(0xE0 | (codepoint >> 12));
+            *output++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            *output++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+        else
+        {
+            *output++ = static_cast<char>(0xF0 | (codepoint >> 18));
+            *output++ = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+            *output++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            *output++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+
+        return output;
+    }
+
+    // Output never gets ahead of input when converting from UTF-8, so whole blocks can be
+    // written for leading ASCII bytes without exceeding buffer sized for given text.
+    template<typename OutputChar>
+    Optional<u64> ConvertFromUtf8(const StringView& text, OutputChar* buffer)
+    {
+        const u8* current = reinterpret_cast<const u8*>(text.GetBeginPtr());
+        const u8* end = reinterpret_cast<const u8*>(text.GetEndPtr());
+        OutputChar* output = buffer;
+
+        while(current != end)
+        {
+            if(static_cast<u64>(end - current) >= AsciiBlockSize)
+            {
+                const u32 asciiCount = CountAsciiBytes(current);
+                WidenAsciiBytes(current, output);
+                current += asciiCount;
+                output += asciiCount;
+                if(asciiCount == AsciiBlockSize)
+                    continue;
+            }
+            else if(*current < 0x80)
+            {
+                *output++ = *current++;
+                continue;
+            }
+
+            char32_t codepoint;
+            if(!DecodeSequence(current, end, codepoint))
+                return {};
+
+            if constexpr(sizeof(OutputChar) == 2)
+            {
+                if(codepoint >= 0x10000)
+                {
+                    codepoint -= 0x10000;
+                    *output++ = static_cast<char16_t>(0xD800 + (codepoint >> 10));
+                    *output++ = static_cast<char16_t>(0xDC00 + (codepoint & 0x3FF));
+                    continue;
+                }
+            }
+
+            *output++ = static_cast<OutputChar>(codepoint);
+        }
+
+        return static_cast<u64>(output - buffer);
+    }
+
+    // Each ASCII unit is written as single byte, so output stays within buffer sized for given text.
+    template<typename InputChar>
+    Optional<u64> ConvertToUtf8(const StringViewBase<InputChar>& text, char* buffer)
+    {
+        const InputChar* current = text.GetBeginPtr();
+        const InputChar* end = text.GetEndPtr();
+        char* output = buffer;
+
+        while(current != end)
+        {
+            if(static_cast<u64>(end - current) >= AsciiUnitBlockSize && NarrowAsciiUnits(current, output))
+            {
+                current += AsciiUnitBlockSize;
+                output += AsciiUnitBlockSize;
+                continue;
+            }
+
+            char32_t codepoint;
+            if constexpr(sizeof(InputChar) == 2)
+            {
+                if(!DecodeUtf16(current, end, codepoint))
+                    return {};
+            }
+            else
+            {
+                codepoint = *current++;
+                if(codepoint > Unicode::MaxCodepoint || IsSurrogate(codepoint))
+                    return {};
+            }
+
+            output = WriteUtf8(codepoint, output);
+        }
+
+        return static_cast<u64>(output - buffer);
+    }
+}
+
+bool Unicode::IsValidUtf8(const StringView& text)
+{
+    const u8* current = reinterpret_cast<const u8*>(text.GetBeginPtr());
+    const u8* end = reinterpret_cast<const u8*>(text.GetEndPtr());
+
+    while(current != end)
+    {
+        if(static_cast<u64>(end - current) >= AsciiBlockSize)
+        {
+            const u32 asciiCount = CountAsciiBytes(current);
+            current += asciiCount;
+            if(asciiCount == AsciiBlockSize)
+                continue;
+        }
+        else if(*current < 0x80)
+        {
+            ++current;
+            continue;
+        }
+
+        char32_t codepoint;
+        if(!DecodeSequence(current, end, codepoint))
+            return false;
+    }
+
+    return true;
+}
+
+bool Unicode::IsValidUtf16(const StringView16& text)
+{
+    const char16_t* current = text.GetBeginPtr();
+    const char16_t* end = text.GetEndPtr();
+
+    while(current != end)
+    {
+        char32_t codepoint;
+        if(!DecodeUtf16(current, end, codepoint))
+            return false;
+    }
+
+    return true;
+}
+
+bool Unicode::IsValidUtf32(const StringView32& text)
+{
+    for(const char32_t codepoint : text)
+    {
+        if(codepoint > MaxCodepoint || IsSurrogate(codepoint))
+            return false;
+    }
+
+    return true;
+}
+
+char32_t Unicode::DecodeUtf8(const char*& current, const char* end)
+{
+    ASSERT_SLOW(current != end);
+    if(static_cast<u8>(*current) < 0x80)
+        return static_cast<u8>(*current++);
+
+    const u8* position = reinterpret_cast<const u8*>(current);
+    char32_t codepoint;
+    const bool valid = DecodeSequence(position, reinterpret_cast<const u8*>(end), codepoint);
+    current = reinterpret_cast<const char*>(position);
+    return valid ? codepoint : ReplacementCodepoint;
+}
+
+u64 Unicode::EncodeUtf8(char32_t codepoint, char* buffer)
+{
+    if(codepoint > MaxCodepoint || IsSurrogate(codepoint))
+    {
+        codepoint = ReplacementCodepoint;
+    }
+
+    return WriteUtf8(codepoint, buffer) - buffer;
+}
+
+u64 Unicode::CountCodepoints(const StringView& text)
+{
+    u64 count = 0;
+    const char* current = text.GetBeginPtr();
+    const char* end = text.GetEndPtr();
+    while(current != end)
+    {
+        DecodeUtf8(current, end);
+        ++count;
+    }
+
+    return count;
+}
+
+Optional<u64> Unicode::ConvertUtf8ToUtf16(const StringView& text, char16_t* buffer)
+{
+    return ConvertFromUtf8(text, buffer);
+}
+
+Optional<u64> Unicode::ConvertUtf8ToUtf32(const StringView& text, char32_t* buffer)
+{
+    return ConvertFromUtf8(text, buffer);
+}
+
+Optional<u64> Unicode::ConvertUtf16ToUtf8(const StringView16& text, char* buffer)
+{
+    return ConvertToUtf8(text, buffer);
+}
+
+Optional<u64> Unicode::ConvertUtf32ToUtf8(const StringView32& text, char* buffer)
+{
+    return ConvertToUtf8(text, buffer);
+}
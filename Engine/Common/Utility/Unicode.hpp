@@ -0,0 +1,142 @@
+#pragma once
+
+// Validation, decoding and transcoding between UTF-8, UTF-16 and UTF-32. Text is scanned sixteen bytes
+// at a time for runs of ASCII characters, which are copied with vector instructions where available,
+// while other characters are decoded one at a time. Text is strictly validated, rejecting overlong
+// encodings, surrogates and codepoints above U+10FFFF, so transcoding fails instead of guessing.
+namespace Unicode
+{
+    constexpr char32_t ReplacementCodepoint = 0xFFFD;
+    constexpr char32_t MaxCodepoint = 0x10FFFF;
+    constexpr u64 MaxUtf8Units = 4;
+
+    bool IsValidUtf8(const StringView& text);
+    bool IsValidUtf16(const StringView16& text);
+    bool IsValidUtf32(const StringView32& text);
+
+    // Decodes codepoint at current position and advances past it, which must not be at the end.
+    // Invalid sequences decode as replacement codepoint and advance past their longest valid prefix.
+    char32_t DecodeUtf8(const char*& current, const char* end);
+
+    // Writes up to four units and returns their count. Invalid codepoints encode as replacement.
+    u64 EncodeUtf8(char32_t codepoint, char* buffer);
+
+    u64 CountCodepoints(const StringView& text);
+
+    // Iterates over codepoints of UTF-8 text, decoding invalid sequences as replacement codepoint.
+    class CodepointIterator
+    {
+        const char* m_current = nullptr;
+        const char* m_next = nullptr;
+        const char* m_end = nullptr;
+        char32_t m_codepoint = 0;
+
+    public:
+        CodepointIterator(const char* current, const char* end)
+            : m_current(current)
+            , m_next(current)
+            , m_end(end)
+        {
+            Decode();
+        }
+
+        // Position of current codepoint in original text.
+        const char* GetPtr() const
+        {
+            return m_current;
+        }
+
+        char32_t operator*() const
+        {
+            ASSERT_SLOW(m_current != m_end);
+            return m_codepoint;
+        }
+
+        CodepointIterator& operator++()
+        {
+            m_current = m_next;
+            Decode();
+            return *this;
+        }
+
+        bool operator==(const CodepointIterator& other) const
+        {
+            return m_current == other.m_current;
+        }
+
+        bool operator!=(const CodepointIterator& other) const
+        {
+            return m_current != other.m_current;
+        }
+
+    private:
+        void Decode()
+        {
+            if(m_next != m_end)
+            {
+                m_codepoint = DecodeUtf8(m_next, m_end);
+            }
+        }
+    };
+
+    class Codepoints
+    {
+        StringView m_text;
+
+    public:
+        Codepoints(const StringView& text)
+            : m_text(text)
+        {
+        }
+
+        CodepointIterator begin() const
+        {
+            return { m_text.GetBeginPtr(), m_text.GetEndPtr() };
+        }
+
+        CodepointIterator end() const
+        {
+            return { m_text.GetEndPtr(), m_text.GetEndPtr() };
+        }
+    };
+
+    // Writes converted units without null terminator and returns their count, or nothing when text is
+    // invalid. Buffer must have space for one unit per UTF-8 byte, or for three UTF-8 bytes per UTF-16
+    // unit and four UTF-8 bytes per UTF-32 unit, which are upper bounds for any valid text.
+    Optional<u64> ConvertUtf8ToUtf16(const StringView& text, char16_t* buffer);
+    Optional<u64> ConvertUtf8ToUtf32(const StringView& text, char32_t* buffer);
+    Optional<u64> ConvertUtf16ToUtf8(const StringView16& text, char* buffer);
+    Optional<u64> ConvertUtf32ToUtf8(const StringView32& text, char* buffer);
+
+    // Appends converted characters directly into spare capacity at the end of string.
+    // String is left unchanged when text is invalid.
+    template<typename OutputChar, typename InputChar, typename Allocator>
+    bool Convert(const StringViewBase<InputChar>& text, StringBase<OutputChar, Allocator>& string)
+    {
+        constexpr u64 maxUnitsPerInput = sizeof(OutputChar) == 1 ? (sizeof(InputChar) == 2 ? 3 : 4) : 1;
+        string.Reserve(string.GetLength() + text.GetLength() * maxUnitsPerInput, false);
+        OutputChar* buffer = string.GetData() + string.GetLength();
+
+        Optional<u64> length;
+        if constexpr(std::is_same_v<InputChar, char> && std::is_same_v<OutputChar, char16_t>)
+            length = ConvertUtf8ToUtf16(text, buffer);
+        else if constexpr(std::is_same_v<InputChar, char> && std::is_same_v<OutputChar, char32_t>)
+            length = ConvertUtf8ToUtf32(text, buffer);
+        else if constexpr(std::is_same_v<InputChar, char16_t> && std::is_same_v<OutputChar, char>)
+            length = ConvertUtf16ToUtf8(text, buffer);
+        else if constexpr(std::is_same_v<InputChar, char32_t> && std::is_same_v<OutputChar, char>)
+            length = ConvertUtf32ToUtf8(text, buffer);
+        else
+            static_assert(sizeof(InputChar) == 0, "Unsupported conversion");
+
+        // Null terminator may have been overwritten by partial output.
+        string.AddUninitialized(length ? *length : 0);
+        return length.HasValue();
+    }
+
+    template<typename OutputChar, typename InputChar, typename InputAllocator, typename Allocator>
+    bool Convert(const StringBase<InputChar, InputAllocator>& text, StringBase<OutputChar, Allocator>& string)
+    {
+        return Convert(StringViewBase<InputChar>(text), string);
+    }
+}
@@ -3,32 +3,84 @@
 #include "Memory/Memory.hpp"
 #include "Memory/Allocators/Default.hpp"
 
-template<typename Type, typename Deleter = std::conditional_t<std::is_void_v<Type>,
-    Memory::VoidDeleter, Memory::AllocationDeleter<Type, Memory::Allocators::Default>>>
-class UniquePtr final
+// Storage of owned pointer and its deleter. Deleter without any state is stored as
+// a base class, so empty base optimization makes it take no space. Unlike relying on
+// std::tuple layout or [[no_unique_address]], this works the same on all compilers.
+template<typename PointerType, typename DeleterType,
+    bool EmptyDeleter = std::is_empty_v<DeleterType> && !std::is_final_v<DeleterType>>
+class UniquePtrStorage final : private DeleterType
 {
-    template<typename OtherType, typename OtherDeleter>
-    friend class UniquePtr;
+public:
+    PointerType pointer = nullptr;
+
+    UniquePtrStorage(PointerType pointer, DeleterType&& deleter)
+        : DeleterType(Move(deleter))
+        , pointer(pointer)
+    {}
 
-    struct DeleterInvoker
+    DeleterType& GetDeleter()
     {
-        Deleter deleter = nullptr;
+        return *this;
+    }
+
+    const DeleterType& GetDeleter() const
+    {
+        return *this;
+    }
+};
+
+template<typename PointerType, typename DeleterType>
+class UniquePtrStorage<PointerType, DeleterType, false> final
+{
+    DeleterType m_deleter;
+
+public:
+    PointerType pointer = nullptr;
+
+    UniquePtrStorage(PointerType pointer, DeleterType&& deleter)
+        : m_deleter(Move(deleter))
+        , pointer(pointer)
+    {}
 
-        DeleterInvoker(Deleter deleter)
-            : deleter(deleter)
-        {}
+    DeleterType& GetDeleter()
+    {
+        return m_deleter;
+    }
 
-        void operator()(Type* pointer) const
+    const DeleterType& GetDeleter() const
+    {
+        return m_deleter;
+    }
+};
+
+// Function pointer deleter is wrapped to tolerate null function for empty pointers.
+template<typename Type, typename Deleter>
+struct UniquePtrDeleterInvoker
+{
+    Deleter deleter = nullptr;
+
+    UniquePtrDeleterInvoker(Deleter deleter)
+        : deleter(deleter)
+    {}
+
+    template<typename... Arguments>
+    void operator()(Type* pointer, Arguments... arguments) const
+    {
+        if(deleter)
         {
-            if(deleter)
-            {
-                (*deleter)(pointer);
-            }
+            (*deleter)(pointer, arguments...);
         }
-    };
+    }
+};
 
-    using DeleterType = std::conditional_t<std::is_pointer_v<Deleter>, DeleterInvoker, Deleter>;
-    using StorageType = std::tuple<Type*, DeleterType>;
+template<typename Type, typename Deleter = Memory::DefaultDeleter<Type>>
+class UniquePtr final
+{
+    template<typename OtherType, typename OtherDeleter>
+    friend class UniquePtr;
+
+    using DeleterType = std::conditional_t<std::is_pointer_v<Deleter>, UniquePtrDeleterInvoker<Type, Deleter>, Deleter>;
+    using StorageType = UniquePtrStorage<Type*, DeleterType>;
 
     StorageType m_storage;
 
@@ -59,6 +111,7 @@ public:
 
     template<typename OtherType, typename OtherDeleter>
     UniquePtr(UniquePtr<OtherType, OtherDeleter>&& other) noexcept
+        : m_storage(nullptr, Deleter{})
     {
         *this = Move(other);
     }
@@ -68,9 +121,9 @@ public:
     {
         Reset();
         static_assert(std::is_convertible_v<OtherType*, Type*>, "Incompatible types");
-        std::get<Type*>(m_storage) = std::get<OtherType*>(other.m_storage);
-        std::get<DeleterType>(m_storage) = Move(std::get<OtherDeleter>(other.m_storage));
-        other.m_storage = {};
+        m_storage.pointer = other.m_storage.pointer;
+        m_storage.GetDeleter() = Move(other.m_storage.GetDeleter());
+        other.m_storage.pointer = nullptr;
         return *this;
     }
 
@@ -131,12 +184,17 @@ public:
 
     Type* Get()
     {
-        return std::get<Type*>(m_storage);
+        return m_storage.pointer;
     }
 
     const Type* Get() const
     {
-        return std::get<Type*>(m_storage);
+        return m_storage.pointer;
+    }
+
+    DeleterType& GetDeleter()
+    {
+        return m_storage.GetDeleter();
     }
 
     void Reset()
@@ -161,23 +219,216 @@ public:
 
     Type* Detach()
     {
-        Type* pointer = std::get<Type*>(m_storage);
-        m_storage = StorageType(nullptr, {});
+        Type* pointer = m_storage.pointer;
+        m_storage.pointer = nullptr;
+        return pointer;
+    }
+
+    bool IsValid() const
+    {
+        return m_storage.pointer != nullptr;
+    }
+
+private:
+    void Delete()
+    {
+        if(Type* oldPointer = m_storage.pointer)
+        {
+            m_storage.GetDeleter()(oldPointer);
+        }
+    }
+
+    void EnsureDeleterPointer() const
+    {
+        if constexpr(std::is_pointer_v<Deleter>)
+        {
+            ASSERT(m_storage.GetDeleter().deleter, "Deleter function pointer must be valid");
+        }
+    }
+};
+
+// Owns array of elements together with its size. Deleter is called with
+// pointer and element count, so elements can be destructed and deallocated.
+template<typename Type, typename Deleter>
+class UniquePtr<Type[], Deleter> final
+{
+    using DeleterType = std::conditional_t<std::is_pointer_v<Deleter>, UniquePtrDeleterInvoker<Type, Deleter>, Deleter>;
+    using StorageType = UniquePtrStorage<Type*, DeleterType>;
+
+    StorageType m_storage;
+    u64 m_size = 0;
+
+public:
+    UniquePtr()
+        : m_storage(nullptr, Deleter{})
+    {}
+
+    UniquePtr(Type* pointer, const u64 size)
+        : m_storage(pointer, Deleter{})
+        , m_size(pointer ? size : 0)
+    {
+        static_assert(!std::is_pointer_v<Deleter>, "Deleter function pointer must be provided");
+    }
+
+    UniquePtr(Type* pointer, const u64 size, Deleter&& deleter)
+        : m_storage(pointer, Move(deleter))
+        , m_size(pointer ? size : 0)
+    {
+        EnsureDeleterPointer();
+    }
+
+    ~UniquePtr()
+    {
+        Delete();
+    }
+
+    UniquePtr(const UniquePtr&) = delete;
+    UniquePtr& operator=(const UniquePtr&) = delete;
+
+    UniquePtr(UniquePtr&& other) noexcept
+        : m_storage(nullptr, Deleter{})
+    {
+        *this = Move(other);
+    }
+
+    UniquePtr& operator=(UniquePtr&& other) noexcept
+    {
+        ASSERT_SLOW(this != &other);
+        Reset();
+        m_storage.pointer = other.m_storage.pointer;
+        m_storage.GetDeleter() = Move(other.m_storage.GetDeleter());
+        m_size = other.m_size;
+        other.m_storage.pointer = nullptr;
+        other.m_size = 0;
+        return *this;
+    }
+
+    UniquePtr& operator=(std::nullptr_t)
+    {
+        Reset();
+        return *this;
+    }
+
+    explicit operator bool() const
+    {
+        return IsValid();
+    }
+
+    bool operator==(const UniquePtr& other) const
+    {
+        return Get() == other.Get();
+    }
+
+    bool operator!=(const UniquePtr& other) const
+    {
+        return Get() != other.Get();
+    }
+
+    bool operator==(const Type* pointer) const
+    {
+        return Get() == pointer;
+    }
+
+    bool operator!=(const Type* pointer) const
+    {
+        return Get() != pointer;
+    }
+
+    Type& operator[](const u64 index)
+    {
+        ASSERT(index < m_size);
+        return m_storage.pointer[index];
+    }
+
+    const Type& operator[](const u64 index) const
+    {
+        ASSERT(index < m_size);
+        return m_storage.pointer[index];
+    }
+
+    Type* Get()
+    {
+        return m_storage.pointer;
+    }
+
+    const Type* Get() const
+    {
+        return m_storage.pointer;
+    }
+
+    u64 GetSize() const
+    {
+        return m_size;
+    }
+
+    DeleterType& GetDeleter()
+    {
+        return m_storage.GetDeleter();
+    }
+
+    void Reset()
+    {
+        Delete();
+        m_storage = StorageType{nullptr, Deleter{}};
+        m_size = 0;
+    }
+
+    void Reset(Type* newPointer, const u64 newSize)
+    {
+        Delete();
+        m_storage = StorageType{newPointer, Deleter{}};
+        m_size = newPointer ? newSize : 0;
+        static_assert(!std::is_pointer_v<Deleter>, "Deleter function pointer must be provided");
+    }
+
+    void Reset(Type* newPointer, const u64 newSize, Deleter&& newDeleter)
+    {
+        Delete();
+        m_storage = StorageType{newPointer, Move(newDeleter)};
+        m_size = newPointer ? newSize : 0;
+        EnsureDeleterPointer();
+    }
+
+    // Element count must be retrieved before detaching, as it is needed for deletion.
+    Type* Detach()
+    {
+        Type* pointer = m_storage.pointer;
+        m_storage.pointer = nullptr;
+        m_size = 0;
         return pointer;
     }
 
     bool IsValid() const
     {
-        return std::get<Type*>(m_storage) != nullptr;
+        return m_storage.pointer != nullptr;
+    }
+
+    Type* begin()
+    {
+        return m_storage.pointer;
+    }
+
+    Type* end()
+    {
+        return m_storage.pointer + m_size;
+    }
+
+    const Type* begin() const
+    {
+        return m_storage.pointer;
+    }
+
+    const Type* end() const
+    {
+        return m_storage.pointer + m_size;
     }
 
 private:
     void Delete()
     {
-        if (Type* oldPointer = std::get<Type*>(m_storage))
+        if(Type* oldPointer = m_storage.pointer)
         {
-            DeleterType& oldDeleter = std::get<DeleterType>(m_storage);
-            oldDeleter(oldPointer);
+            m_storage.GetDeleter()(oldPointer, m_size);
         }
     }
 
@@ -185,22 +436,41 @@ private:
     {
         if constexpr(std::is_pointer_v<Deleter>)
         {
-            ASSERT(std::get<DeleterInvoker>(m_storage).deleter,
-                "Deleter function pointer must be valid");
+            ASSERT(m_storage.GetDeleter().deleter, "Deleter function pointer must be valid");
         }
     }
 };
 
+// Allocates object with given allocator and owns it with deleter that returns it to the same
+// allocator. Stateless allocators keep the pointer the same size as a raw pointer.
+template<typename Type, typename Allocator = Memory::Allocators::Default, typename... Arguments>
+    requires (!std::is_array_v<Type>)
+UniquePtr<Type, Memory::AllocationDeleter<Type, Allocator>> MakeUnique(Arguments&&... arguments)
+{
+    return UniquePtr<Type, Memory::AllocationDeleter<Type, Allocator>>(
+        Memory::New<Type, Allocator>(Forward<Arguments>(arguments)...));
+}
+
+// Allocates array of default constructed elements, which are left uninitialized for trivial types.
+template<typename Type, typename Allocator = Memory::Allocators::Default>
+    requires std::is_unbounded_array_v<Type>
+UniquePtr<Type, Memory::ArrayAllocationDeleter<std::remove_extent_t<Type>, Allocator>> MakeUnique(const u64 count)
+{
+    using ElementType = std::remove_extent_t<Type>;
+    return UniquePtr<Type, Memory::ArrayAllocationDeleter<ElementType, Allocator>>(
+        Memory::NewArray<ElementType, Allocator>(count), count);
+}
+
+namespace Memory
+{
+    template<typename Type, typename Deleter>
+    constexpr bool IsTriviallyRelocatable<UniquePtr<Type, Deleter>> = IsTriviallyRelocatable<Deleter>;
+}
+
 using ErasedUniquePtr = UniquePtr<void>;
 
-#ifndef COMPILER_MSVC
-    static_assert(sizeof(UniquePtr<u8>) == 8);
-    static_assert(sizeof(UniquePtr<u32>) == 8);
-    static_assert(sizeof(UniquePtr<u64>) == 8);
-    static_assert(sizeof(ErasedUniquePtr) == 16);
-#else
-    static_assert(sizeof(UniquePtr<u8>) == 16);
-    static_assert(sizeof(UniquePtr<u32>) == 16);
-    static_assert(sizeof(UniquePtr<u64>) == 16);
-    static_assert(sizeof(ErasedUniquePtr) == 16);
-#endif
\ No newline at end of file
+static_assert(sizeof(UniquePtr<u8>) == 8);
+static_assert(sizeof(UniquePtr<u32>) == 8);
+static_assert(sizeof(UniquePtr<u64>) == 8);
+static_assert(sizeof(UniquePtr<u8[]>) == 16);
+static_assert(sizeof(ErasedUniquePtr) == 16);
@@ -3,12 +3,49 @@
 #include "Common/Config.hpp"
 #include "Platform/Config.hpp"
 #include "Graphics/Config.hpp"
+#include "Resources/Config.hpp"
+
+// Main loop sync points between update on main thread and render submission.
+struct FramePipelineConfig
+{
+    // Render submission runs on a dedicated render thread, overlapping
+    // with update of the next frame on the main thread. Otherwise each
+    // frame is updated and rendered in sequence on the main thread.
+    bool renderThread = false;
+
+    // Number of frame packets with render thread, 2 for double and 3 for triple buffering.
+    // Main thread waits for render thread to release a packet before preparing next frame,
+    // so at most this many frames are in flight at once. Single packet makes main thread
+    // wait until previous frame has been submitted, without overlapping both stages.
+    u32 framePacketCount = 2;
+};
+
+// Replay of main loop inputs recorded from a previous session.
+struct ReplayConfig
+{
+    // Records delta time, window size and input events of every frame into file at this path.
+    String recordPath;
+
+    // Plays back frames recorded in file at this path in place of platform timer, window
+    // and input, as fast as possible. Main loop exits once all frames have been played.
+    // Takes precedence over recording when both paths are set.
+    String playPath;
+
+    // Writes measured frame times of playback into text file at this path, one per line.
+    String timingsPath;
+};
 
 struct Config
 {
+    // Window and render API are not needed for running update alone, such as for
+    // replay playback. Enabled from command line with -headless like any other field.
     bool headless = false;
 
     Common::LoggerConfig logger;
     Platform::WindowConfig window;
+    Platform::AsyncIOConfig asyncIO;
+    Resources::ManagerConfig resources;
     Graphics::RenderConfig render;
+    FramePipelineConfig pipeline;
+    ReplayConfig replay;
 };
@@ -0,0 +1,418 @@
+#include "Shared.hpp"
+#include "ConfigFile.hpp"
+#include "Config.hpp"
+#include "Platform/CommandLine.hpp"
+#include "Platform/MappedFile.hpp"
+#include "Common/Utility/NumberConversion.hpp"
+
+namespace
+{
+    enum class ConfigFieldType : u8
+    {
+        Bool,
+        U32,
+        U64,
+        F32,
+        String,
+        Severity,
+    };
+
+    template<typename Type>
+    consteval ConfigFieldType GetConfigFieldType()
+    {
+        if constexpr(std::is_same_v<Type, bool>)
+            return ConfigFieldType::Bool;
+        else if constexpr(std::is_same_v<Type, u32>)
+            return ConfigFieldType::U32;
+        else if constexpr(std::is_same_v<Type, u64>)
+            return ConfigFieldType::U64;
+        else if constexpr(std::is_same_v<Type, f32>)
+            return ConfigFieldType::F32;
+        else if constexpr(std::is_same_v<Type, String>)
+            return ConfigFieldType::String;
+        else if constexpr(std::is_same_v<Type, Logger::Severity>)
+            return ConfigFieldType::Severity;
+        else
+            static_assert(sizeof(Type) == 0, "Config field type is not supported");
+    }
+
+    struct ConfigField
+    {
+        const char* name;
+        u64 nameLength;
+        u64 nameHash;
+        ConfigFieldType type;
+        void* (*getMember)(Config& config);
+    };
+
+    // Fields are named after their member path in config, which is also their dotted key.
+#define CONFIG_FIELD(member) ConfigField{ #member, sizeof(#member) - 1, Hash::Fnv1a64(#member, sizeof(#member) - 1), \
+    GetConfigFieldType<std::remove_reference_t<decltype(std::declval<Config&>().member)>>(), \
+    [](Config& config) -> void* { return &config.member; } }
+
+    constexpr ConfigField ConfigFields[] =
+    {
+        CONFIG_FIELD(headless),
+        CONFIG_FIELD(logger.minimumSeverity),
+        CONFIG_FIELD(window.width),
+        CONFIG_FIELD(window.height),
+        CONFIG_FIELD(window.eventScriptPath),
+        CONFIG_FIELD(window.eventTimeStep),
+        CONFIG_FIELD(asyncIO.workerCount),
+        CONFIG_FIELD(asyncIO.queueDepth),
+        CONFIG_FIELD(asyncIO.allowKernelQueue),
+        CONFIG_FIELD(resources.memoryBudget),
+        CONFIG_FIELD(resources.workerCount),
+        CONFIG_FIELD(render.software),
+        CONFIG_FIELD(render.softwareThreadCount),
+        CONFIG_FIELD(pipeline.renderThread),
+        CONFIG_FIELD(pipeline.framePacketCount),
+        CONFIG_FIELD(replay.recordPath),
+        CONFIG_FIELD(replay.playPath),
+        CONFIG_FIELD(replay.timingsPath),
+    };
+
+#undef CONFIG_FIELD
+
+    constexpr const char* ConfigSeverityNames[] =
+    {
+        "Debug",
+        "Info",
+        "Success",
+        "Warning",
+        "Error",
+        "Fatal",
+    };
+
+    static_assert(std::size(ConfigSeverityNames) == static_cast<u64>(Logger::Severity::Fatal) + 1);
+
+    // Key inside section is hashed as if it was written with dotted section prefix,
+    // so it can be found without concatenating both into a temporary string.
+    const ConfigField* FindConfigField(const StringView& section, const StringView& key)
+    {
+        u64 hash = Hash::Fnv1aOffsetBasis;
+        u64 length = key.GetLength();
+        if(!section.IsEmpty())
+        {
+            hash = Hash::Fnv1a64(section.GetData(), section.GetLength(), hash);
+            hash = Hash::Fnv1a64(".", 1, hash);
+            length += section.GetLength() + 1;
+        }
+
+        hash = Hash::Fnv1a64(key.GetData(), key.GetLength(), hash);
+
+        for(const ConfigField& field : ConfigFields)
+        {
+            if(field.nameHash != hash || field.nameLength != length)
+                continue;
+
+            const char* name = field.name;
+            if(!section.IsEmpty())
+            {
+                if(std::memcmp(name, section.GetData(), section.GetLength()) != 0 || name[section.GetLength()] != '.')
+                    continue;
+
+                name += section.GetLength() + 1;
+            }
+
+            if(std::memcmp(name, key.GetData(), key.GetLength()) == 0)
+                return &field;
+        }
+
+        return nullptr;
+    }
+
+    bool IsConfigSpace(const char character)
+    {
+        return character == ' ' || character == '\t' || character == '\r';
+    }
+
+    bool IsConfigNameChar(const char character)
+    {
+        return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') ||
+            (character >= '0' && character <= '9') || character == '_' || character == '.';
+    }
+
+    void SkipConfigSpace(const char*& current, const char* end)
+    {
+        while(current != end && IsConfigSpace(*current))
+            ++current;
+    }
+
+    bool IsConfigLineEnd(const char* current, const char* end)
+    {
+        return current == end || *current == '#' || *current == ';';
+    }
+
+    // Decimal or hexadecimal with 0x prefix, with optional underscores between digits.
+    bool ParseConfigUnsigned(const StringView& value, const u64 maxValue, u64& result)
+    {
+        const char* current = value.GetBeginPtr();
+        const char* end = value.GetEndPtr();
+
+        u64 base = 10;
+        if(value.GetLength() > 2 && current[0] == '0' && (current[1] == 'x' || current[1] == 'X'))
+        {
+            base = 16;
+            current += 2;
+        }
+
+        if(current == end)
+            return false;
+
+        u64 number = 0;
+        bool afterDigit = false;
+        for(; current != end; ++current)
+        {
+            const char character = *current;
+            if(character == '_')
+            {
+                if(!afterDigit || current + 1 == end || current[1] == '_')
+                    return false;
+
+                continue;
+            }
+
+            u64 digit;
+            if(character >= '0' && character <= '9')
+                digit = character - '0';
+            else if(base == 16 && character >= 'a' && character <= 'f')
+                digit = character - 'a' + 10;
+            else if(base == 16 && character >= 'A' && character <= 'F')
+                digit = character - 'A' + 10;
+            else
+                return false;
+
+            if(number > (maxValue - digit) / base)
+                return false;
+
+            number = number * base + digit;
+            afterDigit = true;
+        }
+
+        result = number;
+        return true;
+    }
+
+    // Returns error message on failure.
+    const char* ParseConfigValue(const ConfigField& field, const StringView& value, Config& config)
+    {
+        void* member = field.getMember(config);
+        switch(field.type)
+        {
+        case ConfigFieldType::Bool:
+            if(value == "true")
+                *static_cast<bool*>(member) = true;
+            else if(value == "false")
+                *static_cast<bool*>(member) = false;
+            else
+                return "Expected true or false";
+            return nullptr;
+
+        case ConfigFieldType::U32:
+        {
+            u64 number;
+            if(!ParseConfigUnsigned(value, std::numeric_limits<u32>::max(), number))
+                return "Expected unsigned 32-bit integer";
+
+            *static_cast<u32*>(member) = static_cast<u32>(number);
+            return nullptr;
+        }
+
+        case ConfigFieldType::U64:
+            if(!ParseConfigUnsigned(value, std::numeric_limits<u64>::max(), *static_cast<u64*>(member)))
+                return "Expected unsigned 64-bit integer";
+            return nullptr;
+
+        case ConfigFieldType::F32:
+        {
+            const Optional<f32> number = NumberConversion::ParseFloat<f32>(value);
+            if(!number)
+                return "Expected finite number";
+
+            *static_cast<f32*>(member) = *number;
+            return nullptr;
+        }
+
+        case ConfigFieldType::String:
+            *static_cast<String*>(member) = String(value);
+            return nullptr;
+
+        case ConfigFieldType::Severity:
+            for(u64 i = 0; i < std::size(ConfigSeverityNames); ++i)
+            {
+                if(value == ConfigSeverityNames[i])
+                {
+                    *static_cast<Logger::Severity*>(member) = static_cast<Logger::Severity>(i);
+                    return nullptr;
+                }
+            }
+            return "Expected Debug, Info, Success, Warning, Error or Fatal";
+        }
+
+        ASSERT(false, "Invalid config field type");
+        return "Invalid field type";
+    }
+}
+
+FailureResult<ConfigFile::Error> ConfigFile::Parse(const StringView& text, Config& config)
+{
+    using ResultType = FailureResult<Error>;
+
+    const char* current = text.GetBeginPtr();
+    const char* end = text.GetEndPtr();
+
+    StringView section;
+    u32 lineNumber = 0;
+    while(current != end)
+    {
+        ++lineNumber;
+
+        const char* lineEnd = static_cast<const char*>(std::memchr(current, '\n', end - current));
+        if(lineEnd == nullptr)
+        {
+            lineEnd = end;
+        }
+
+        const char* cursor = current;
+        current = lineEnd != end ? lineEnd + 1 : end;
+
+        SkipConfigSpace(cursor, lineEnd);
+        if(IsConfigLineEnd(cursor, lineEnd))
+            continue;
+
+        if(*cursor == '[')
+        {
+            ++cursor;
+            SkipConfigSpace(cursor, lineEnd);
+
+            const char* nameBegin = cursor;
+            while(cursor != lineEnd && IsConfigNameChar(*cursor))
+                ++cursor;
+
+            const StringView name(nameBegin, cursor - nameBegin);
+            SkipConfigSpace(cursor, lineEnd);
+            if(name.IsEmpty() || cursor == lineEnd || *cursor != ']')
+                return ResultType::Failure({ lineNumber, "Expected section name in brackets", StringView(nameBegin, lineEnd - nameBegin) });
+
+            ++cursor;
+            SkipConfigSpace(cursor, lineEnd);
+            if(!IsConfigLineEnd(cursor, lineEnd))
+                return ResultType::Failure({ lineNumber, "Unexpected text after section", StringView(cursor, lineEnd - cursor) });
+
+            section = StringView(name);
+            continue;
+        }
+
+        const char* keyBegin = cursor;
+        while(cursor != lineEnd && IsConfigNameChar(*cursor))
+            ++cursor;
+
+        const StringView key(keyBegin, cursor - keyBegin);
+        if(key.IsEmpty())
+            return ResultType::Failure({ lineNumber, "Expected key", StringView(cursor, lineEnd - cursor) });
+
+        SkipConfigSpace(cursor, lineEnd);
+        if(cursor == lineEnd || *cursor != '=')
+            return ResultType::Failure({ lineNumber, "Expected = after key", key });
+
+        ++cursor;
+        SkipConfigSpace(cursor, lineEnd);
+
+        StringView value;
+        bool quoted = false;
+        if(cursor != lineEnd && (*cursor == '"' || *cursor == '\''))
+        {
+            const char quote = *cursor++;
+            const char* valueBegin = cursor;
+            while(cursor != lineEnd && *cursor != quote)
+                ++cursor;
+
+            if(cursor == lineEnd)
+                return ResultType::Failure({ lineNumber, "Unterminated string", StringView(valueBegin - 1, lineEnd - valueBegin + 1) });
+
+            value = StringView(valueBegin, cursor - valueBegin);
+            quoted = true;
+
+            ++cursor;
+            SkipConfigSpace(cursor, lineEnd);
+            if(!IsConfigLineEnd(cursor, lineEnd))
+                return ResultType::Failure({ lineNumber, "Unexpected text after string", StringView(cursor, lineEnd - cursor) });
+        }
+        else
+        {
+            const char* valueBegin = cursor;
+            while(!IsConfigLineEnd(cursor, lineEnd))
+                ++cursor;
+
+            const char* valueEnd = cursor;
+            while(valueEnd != valueBegin && IsConfigSpace(valueEnd[-1]))
+                --valueEnd;
+
+            value = StringView(valueBegin, valueEnd - valueBegin);
+            if(value.IsEmpty())
+                return ResultType::Failure({ lineNumber, "Expected value", key });
+        }
+
+        const ConfigField* field = FindConfigField(section, key);
+        if(field == nullptr)
+            return ResultType::Failure({ lineNumber, "Unknown key", key });
+
+        if(quoted && field->type != ConfigFieldType::String)
+            return ResultType::Failure({ lineNumber, "Only strings can be quoted", value });
+
+        if(const char* message = ParseConfigValue(*field, value, config))
+            return ResultType::Failure({ lineNumber, message, value });
+    }
+
+    return ResultType::Success();
+}
+
+FailureResult<ConfigFile::Error> ConfigFile::ApplyOverrides(const Platform::CommandLine& commandLine, Config& config)
+{
+    using ResultType = FailureResult<Error>;
+
+    for(const ConfigField& field : ConfigFields)
+    {
+        const StringView name(field.name, field.nameLength);
+        if(!commandLine.HasArgument(name))
+            continue;
+
+        // Boolean fields can be enabled with flag alone.
+        const Optional<StringView> value = commandLine.GetArgumentValue(name);
+        if(!value.HasValue())
+        {
+            if(field.type != ConfigFieldType::Bool)
+                return ResultType::Failure({ 0, "Expected value", name });
+
+            *static_cast<bool*>(field.getMember(config)) = true;
+            continue;
+        }
+
+        if(const char* message = ParseConfigValue(field, value.GetValue(), config))
+            return ResultType::Failure({ 0, message, value.GetValue() });
+    }
+
+    return ResultType::Success();
+}
+
+bool ConfigFile::Load(const StringView& filePath, Config& config)
+{
+    Platform::MappedFile file;
+    if(!file.Open(filePath))
+    {
+        LOG_ERROR("Failed to open config file: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    auto result = Parse(file.GetStringView(), config);
+    if(!result)
+    {
+        const Error& error = result.GetFailure();
+        LOG_ERROR("%.*s(%u): %s: %.*s", STRING_VIEW_PRINTF_ARG(filePath),
+            error.line, error.message, STRING_VIEW_PRINTF_ARG(error.token));
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+struct Config;
+
+namespace Platform
+{
+    class CommandLine;
+}
+
+// Fills config from text in a subset of INI and TOML formats:
+//
+//     # Comments start with # or ; and run until end of line.
+//     headless = false
+//
+//     [window]
+//     width = 1920
+//     eventScriptPath = "Scripts/Resize.txt"
+//
+//     [logger]
+//     minimumSeverity = Warning
+//
+// Keys are names of config members, with section naming the member struct they belong to.
+// Dotted keys such as window.height can also be used outside of sections, and the same
+// dotted keys override values from command line, e.g. -window.width=800. Strings may be
+// quoted with either kind of quotes but do not support escape sequences, and are copied
+// into null terminated strings owned by config, so they can be passed on as file paths.
+// Text is parsed in a single pass straight into config members, without building any
+// intermediate tree, and memory is only allocated for string values.
+namespace ConfigFile
+{
+    struct Error
+    {
+        u32 line = 0; // Zero for values from command line
+        const char* message = "";
+        StringView token; // Key or value that caused the error
+    };
+
+    FailureResult<Error> Parse(const StringView& text, Config& config);
+    FailureResult<Error> ApplyOverrides(const Platform::CommandLine& commandLine, Config& config);
+
+    // Maps file only for as long as it is parsed, and logs errors.
+    bool Load(const StringView& filePath, Config& config);
+}
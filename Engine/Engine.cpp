@@ -2,6 +2,7 @@
 #include "Engine.hpp"
 #include "Platform/CommandLine.hpp"
 #include "Graphics/Stats.hpp"
+#include "Platform/ThreadStats.hpp"
 
 Engine::~Engine()
 {
@@ -13,6 +14,24 @@ bool Engine::Setup(const Config& config)
     ASSERT(!m_setupCalled && !m_setupSucceeded);
     LOG_DEBUG("Setting up engine...");
 
+    if(!m_asyncIO.Setup(config.asyncIO))
+    {
+        LOG_ERROR("Failed to setup async IO");
+        return false;
+    }
+
+    if(!m_resources.Setup(config.resources))
+    {
+        LOG_ERROR("Failed to setup resource manager");
+        return false;
+    }
+
+    if(!m_replay.Setup(config.replay))
+    {
+        LOG_ERROR("Failed to setup replay");
+        return false;
+    }
+
     if(!config.headless)
     {
         if(!m_window.Setup(config.window))
@@ -24,6 +43,12 @@ bool Engine::Setup(const Config& config)
         {
            auto windowTitle = InlineString<64>::Format("%s %s", Application::GetName(), EngineVersion::Readable);
             m_window.SetTitle(windowTitle);
+
+            // Played back input replaces input of the platform.
+            if(!m_replay.IsPlaying())
+            {
+                m_window.SetInputSystem(&m_input);
+            }
         }
 
         if(!m_renderApi.Setup(&m_window, config.render))
@@ -33,6 +58,15 @@ bool Engine::Setup(const Config& config)
         }
     }
 
+    if(!m_framePipeline.Setup(config.pipeline, [this](const FramePacket& packet)
+    {
+        RenderFrame(packet);
+    }))
+    {
+        LOG_ERROR("Failed to setup frame pipeline");
+        return false;
+    }
+
     LOG_SUCCESS("Engine setup complete");
     return m_setupSucceeded = true;
 }
@@ -45,23 +79,83 @@ ExitCodes Engine::Run(Application& application)
     LOG_INFO("Starting main loop...");
     m_window.Show();
 
+    m_application = &application;
+    SCOPE_GUARD
+    {
+        m_application = nullptr;
+    };
+
     while(true)
     {
-        m_renderApi.WaitForFrame();
+        // Render thread waits for swapchain by itself, while main thread is
+        // only throttled by waiting for a free frame packet instead.
+        // Replay playback runs as fast as possible without waiting at all.
+        if(!m_framePipeline.IsThreaded() && !m_replay.IsPlaying())
+        {
+            m_renderApi.WaitForFrame();
+        }
 
         float deltaTime = m_timer.Tick();
+        if(m_replay.IsPlaying())
+        {
+            if(!m_replay.PlayFrame(deltaTime))
+                break;
+
+            // Recorded size is picked up by event processing the same way as platform resize.
+            const ReplayFrame& replayFrame = m_replay.GetFrame();
+            deltaTime = replayFrame.deltaTime;
+            m_window.SetSize(replayFrame.width, replayFrame.height);
+        }
 
         m_window.ProcessEvents();
         if(m_window.IsClosing())
             break;
 
-        application.OnUpdate(deltaTime);
+        // Main thread could otherwise wait for a free packet while render thread waits in
+        // swapchain resize for window messages, so swapchain is resized here instead, once
+        // render thread has finished all submitted frames and no longer uses render API.
+        const u32 width = m_window.GetWidth();
+        const u32 height = m_window.GetHeight();
+        if(m_framePipeline.IsThreaded() && m_renderApi.IsSetup() &&
+            (width != m_renderApi.GetWidth() || height != m_renderApi.GetHeight()))
+        {
+            m_framePipeline.Flush();
+            m_renderApi.Resize(width, height);
+        }
+
+        if(m_replay.IsPlaying())
+        {
+            m_replay.PushEvents(m_input);
+        }
+
+        if(m_replay.IsRecording())
+        {
+            m_input.Update([this](const Input::Event& event)
+            {
+                m_replay.RecordEvent(event);
+            });
 
-        m_renderApi.BeginFrame();
+            m_replay.RecordFrame(deltaTime, m_window.GetWidth(), m_window.GetHeight());
+        }
+        else
         {
-            application.OnDraw(1.0f);
+            m_input.Update();
         }
-        m_renderApi.EndFrame();
+
+        m_asyncIO.ProcessCompletions();
+        m_resources.Update();
+
+        application.OnUpdate(deltaTime, m_input.GetState());
+
+        FramePacket& packet = m_framePipeline.AcquirePacket();
+        packet.deltaTime = deltaTime;
+        packet.alphaTime = 1.0f;
+        packet.width = m_window.GetWidth();
+        packet.height = m_window.GetHeight();
+        application.OnPrepareFrame(packet);
+        m_framePipeline.SubmitPacket();
+
+        Graphics::Stats::Get().OnEndFrame();
 
 #if !CONFIG_RELEASE
         Graphics::Stats& graphicsStats = Graphics::Stats::Get();
@@ -92,8 +186,17 @@ ExitCodes Engine::Run(Application& application)
 #endif
     }
 
+    // Frames already submitted are rendered before application is allowed to exit.
+    m_framePipeline.Flush();
+    m_replay.Shutdown();
+
+    m_resources.GetStats().Print();
     Memory::Stats::Get().Print();
 
+#if ENABLE_THREAD_STATS
+    Thread::Stats::Get().Print();
+#endif
+
     LOG_INFO("Exiting application...");
     return ExitCodes::Success;
 }
@@ -103,7 +206,52 @@ Platform::Window& Engine::GetWindow()
     return m_window;
 }
 
+Platform::AsyncIO& Engine::GetAsyncIO()
+{
+    return m_asyncIO;
+}
+
+Resources::Manager& Engine::GetResources()
+{
+    return m_resources;
+}
+
+Input::System& Engine::GetInput()
+{
+    return m_input;
+}
+
 Graphics::RenderApi& Engine::GetRenderApi()
 {
     return m_renderApi;
 }
+
+FramePipeline& Engine::GetFramePipeline()
+{
+    return m_framePipeline;
+}
+
+Replay& Engine::GetReplay()
+{
+    return m_replay;
+}
+
+void Engine::RenderFrame(const FramePacket& packet)
+{
+    ASSERT(m_application);
+
+    // Headless engine only runs update, as there is nothing to render into.
+    if(!m_renderApi.IsSetup())
+        return;
+
+    if(m_framePipeline.IsThreaded() && !m_replay.IsPlaying())
+    {
+        m_renderApi.WaitForFrame();
+    }
+
+    m_renderApi.BeginFrame(packet.width, packet.height);
+    {
+        m_application->OnDraw(packet);
+    }
+    m_renderApi.EndFrame();
+}
@@ -4,13 +4,24 @@
 #include "Application.hpp"
 #include "Platform/Time.hpp"
 #include "Platform/Window.hpp"
+#include "Platform/AsyncIO.hpp"
 #include "Graphics/RenderApi.hpp"
+#include "Input/System.hpp"
+#include "Resources/Manager.hpp"
+#include "FramePipeline.hpp"
+#include "Replay.hpp"
 
 class Engine final
 {
     Time::Timer m_timer;
+    Input::System m_input;
     Platform::Window m_window;
+    Platform::AsyncIO m_asyncIO;
+    Resources::Manager m_resources;
     Graphics::RenderApi m_renderApi;
+    FramePipeline m_framePipeline;
+    Replay m_replay;
+    Application* m_application = nullptr;
 
     bool m_setupCalled = false;
     bool m_setupSucceeded = false;
@@ -23,5 +34,13 @@ public:
     ExitCodes Run(Application& application);
 
     Platform::Window& GetWindow();
+    Platform::AsyncIO& GetAsyncIO();
+    Resources::Manager& GetResources();
     Graphics::RenderApi& GetRenderApi();
+    Input::System& GetInput();
+    FramePipeline& GetFramePipeline();
+    Replay& GetReplay();
+
+private:
+    void RenderFrame(const FramePacket& packet);
 };
@@ -12,6 +12,7 @@ const char* ExitCodeToString(ExitCodes exitCode)
         case ExitCodes::DiscoverTestsFailed: return "DiscoverTestsFailed";
         case ExitCodes::QueryTestsFailed:    return "QueryTestsFailed";
         case ExitCodes::RunTestsFailed:      return "RunTestsFailed";
+        case ExitCodes::PackArchiveFailed:   return "PackArchiveFailed";
     }
 
     ASSERT(false, "Unknown exit code");
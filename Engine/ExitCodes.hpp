@@ -9,6 +9,7 @@ enum class ExitCodes : u32
     DiscoverTestsFailed,
     QueryTestsFailed,
     RunTestsFailed,
+    PackArchiveFailed,
 };
 
 const char* ExitCodeToString(ExitCodes exitCode);
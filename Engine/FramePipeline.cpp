@@ -0,0 +1,149 @@
+#include "Shared.hpp"
+#include "FramePipeline.hpp"
+#include "Config.hpp"
+
+FramePipeline::~FramePipeline()
+{
+    Shutdown();
+}
+
+bool FramePipeline::Setup(const FramePipelineConfig& config, RenderFunction&& renderFunction)
+{
+    ASSERT(!m_setup);
+    ASSERT(renderFunction);
+    LOG_DEBUG("Setting up frame pipeline...");
+
+    if(config.framePacketCount == 0 || config.framePacketCount > MaxFramePacketCount)
+    {
+        LOG_ERROR("Frame packet count must be between 1 and %u", MaxFramePacketCount);
+        return false;
+    }
+
+    m_renderFunction = Move(renderFunction);
+
+    if(config.renderThread)
+    {
+        m_slotCount = config.framePacketCount;
+        m_freeSlots.Release(m_slotCount);
+
+        Thread::Config threadConfig;
+        threadConfig.name = "Render";
+        threadConfig.priority = Thread::Priority::High;
+        m_renderThread = Thread::Create(threadConfig, [this]()
+        {
+            RenderThread();
+        });
+
+        if(!m_renderThread.IsJoinable())
+        {
+            LOG_ERROR("Failed to create render thread");
+            return false;
+        }
+
+        LOG_INFO("Using render thread with %u frame packets", m_slotCount);
+    }
+    else
+    {
+        // Render stage runs inline, so a single packet is always available.
+        m_slotCount = 1;
+    }
+
+    LOG_SUCCESS("Frame pipeline setup complete");
+    return m_setup = true;
+}
+
+void FramePipeline::Shutdown()
+{
+    if(!m_setup)
+        return;
+
+    ASSERT(!m_acquired, "Frame pipeline shutdown with acquired packet");
+
+    if(IsThreaded())
+    {
+        // Exit is queued after all submitted packets, so they are still rendered.
+        m_freeSlots.Acquire();
+        m_slots[m_writeIndex].exit = true;
+        m_readySlots.Release();
+        m_renderThread.Join();
+        m_slots[m_writeIndex].exit = false;
+
+        while(m_freeSlots.TryAcquire())
+        {
+        }
+    }
+
+    m_writeIndex = 0;
+    m_readIndex = 0;
+    m_frameIndex = 0;
+    m_setup = false;
+}
+
+FramePacket& FramePipeline::AcquirePacket()
+{
+    ASSERT(m_setup);
+    ASSERT(!m_acquired);
+
+    if(IsThreaded())
+    {
+        m_freeSlots.Acquire();
+    }
+
+    FramePacket& packet = m_slots[m_writeIndex].packet;
+    packet.frameIndex = m_frameIndex++;
+    packet.data.Clear();
+
+    m_acquired = true;
+    return packet;
+}
+
+void FramePipeline::SubmitPacket()
+{
+    ASSERT(m_setup);
+    ASSERT(m_acquired);
+    m_acquired = false;
+
+    if(IsThreaded())
+    {
+        m_writeIndex = (m_writeIndex + 1) % m_slotCount;
+        m_readySlots.Release();
+    }
+    else
+    {
+        m_renderFunction(m_slots[m_writeIndex].packet);
+    }
+}
+
+void FramePipeline::Flush()
+{
+    ASSERT(m_setup);
+    ASSERT(!m_acquired);
+
+    if(IsThreaded())
+    {
+        // All packets are free once render thread has released every one of them.
+        for(u32 i = 0; i < m_slotCount; ++i)
+        {
+            m_freeSlots.Acquire();
+        }
+
+        m_freeSlots.Release(m_slotCount);
+    }
+}
+
+void FramePipeline::RenderThread()
+{
+    while(true)
+    {
+        m_readySlots.Acquire();
+
+        FrameSlot& slot = m_slots[m_readIndex];
+        if(slot.exit)
+            break;
+
+        m_renderFunction(slot.packet);
+
+        m_readIndex = (m_readIndex + 1) % m_slotCount;
+        m_freeSlots.Release();
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+struct FramePipelineConfig;
+
+// Snapshot of everything render stage needs to draw a frame, filled on main thread.
+// Packets are reused in a ring, so buffers keep their capacity between frames.
+struct FramePacket
+{
+    u64 frameIndex = 0;
+    f32 deltaTime = 0.0f;
+    f32 alphaTime = 1.0f;
+    u32 width = 0;
+    u32 height = 0;
+
+    // Render data written by application, only read by render stage.
+    HeapArray<u8> data;
+};
+
+// Hands frame packets from main thread over to render stage. Render stage either runs
+// inline on main thread, or on a dedicated render thread that renders frame N while main
+// thread prepares frame N + 1. Main thread waits for a free packet when all of them are
+// in flight, so configured packet count bounds how many frames render stage can lag behind.
+class FramePipeline final : NonCopyable
+{
+public:
+    static constexpr u32 MaxFramePacketCount = 3;
+    using RenderFunction = Function<void(const FramePacket&)>;
+
+private:
+    struct FrameSlot
+    {
+        FramePacket packet;
+        bool exit = false;
+    };
+
+    FrameSlot m_slots[MaxFramePacketCount];
+    u32 m_slotCount = 1;
+    u32 m_writeIndex = 0;
+    u32 m_readIndex = 0;
+    u64 m_frameIndex = 0;
+    bool m_acquired = false;
+
+    Thread::Semaphore m_freeSlots;
+    Thread::Semaphore m_readySlots;
+    Thread::Handle m_renderThread;
+    RenderFunction m_renderFunction;
+    bool m_setup = false;
+
+public:
+    FramePipeline() = default;
+    ~FramePipeline();
+
+    bool Setup(const FramePipelineConfig& config, RenderFunction&& renderFunction);
+    void Shutdown();
+
+    // Returns packet for the next frame, waiting for render stage to release one if needed.
+    FramePacket& AcquirePacket();
+
+    // Passes acquired packet to render stage, which renders it immediately without render thread.
+    void SubmitPacket();
+
+    // Waits until render stage has finished all submitted packets.
+    void Flush();
+
+    u32 GetPacketCount() const
+    {
+        return m_slotCount;
+    }
+
+    bool IsThreaded() const
+    {
+        return m_renderThread.IsJoinable();
+    }
+
+private:
+    void RenderThread();
+};
@@ -0,0 +1,34 @@
+#include "Shared.hpp"
+#include "CommandBuffer.hpp"
+#include "Common/Algorithms/Sorting.hpp"
+
+void Graphics::CommandList::Build(const CommandBuffer* const* buffers, const u64 bufferCount)
+{
+    ASSERT(buffers != nullptr || bufferCount == 0);
+
+    u64 commandCount = 0;
+    for(u64 i = 0; i < bufferCount; ++i)
+    {
+        ASSERT(buffers[i]);
+        commandCount += buffers[i]->GetCommandCount();
+    }
+
+    m_commands.Clear();
+    m_commands.Reserve(commandCount);
+    for(u64 i = 0; i < bufferCount; ++i)
+    {
+        const CommandBuffer& buffer = *buffers[i];
+        const CommandBuffer::Entry* entries = buffer.GetEntries();
+        for(u64 j = 0; j < buffer.GetCommandCount(); ++j)
+        {
+            m_commands.Add(Command{ entries[j].sortKey, buffer.GetCommandData(entries[j]), entries[j].type });
+        }
+    }
+
+    // Radix sort is stable, which preserves recording order of commands with equal keys.
+    m_scratch.Resize(commandCount);
+    RadixSort(m_commands.GetBeginPtr(), m_commands.GetEndPtr(), m_scratch.GetBeginPtr(), [](const Command& command)
+    {
+        return command.sortKey;
+    });
+}
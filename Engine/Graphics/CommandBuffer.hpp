@@ -0,0 +1,182 @@
+#pragma once
+
+namespace Graphics
+{
+    enum class CommandType : u8
+    {
+        Clear,
+        SetViewport,
+        Draw,
+        Count,
+    };
+
+    // Commands are plain data copied into command buffer memory, so they must be
+    // trivially copyable and only refer to resources through indices or handles.
+    struct ClearCommand
+    {
+        static constexpr CommandType Type = CommandType::Clear;
+        f32 color[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    };
+
+    struct SetViewportCommand
+    {
+        static constexpr CommandType Type = CommandType::SetViewport;
+        u32 x = 0;
+        u32 y = 0;
+        u32 width = 0;
+        u32 height = 0;
+    };
+
+    struct DrawCommand
+    {
+        static constexpr CommandType Type = CommandType::Draw;
+        u16 pipeline = 0;
+        u16 material = 0;
+        u32 mesh = 0;
+        u32 vertexOffset = 0;
+        u32 vertexCount = 0;
+        u32 instanceCount = 1;
+    };
+
+    // Sort key packs layer, pipeline, material and depth from most to least significant bits,
+    // so sorting by key groups draws by layer first and minimizes state changes within it.
+    namespace SortKey
+    {
+        constexpr u32 DepthBits = 24;
+        constexpr u32 MaxDepth = (1u << DepthBits) - 1;
+
+        constexpr u64 Make(const u8 layer, const u16 pipeline = 0, const u16 material = 0, const u32 depth = 0)
+        {
+            return static_cast<u64>(layer) << 56 |
+                static_cast<u64>(pipeline) << 40 |
+                static_cast<u64>(material) << 24 |
+                static_cast<u64>(depth & MaxDepth);
+        }
+
+        constexpr u8 GetLayer(const u64 key)
+        {
+            return static_cast<u8>(key >> 56);
+        }
+    }
+
+    // Records commands into linearly allocated memory, which keeps its capacity when reset
+    // so recording does not allocate once it has warmed up. Single command buffer must only
+    // be recorded from one thread, and parallel recording uses one buffer per thread that
+    // are sorted and merged together by command list.
+    class CommandBuffer final : NonCopyable
+    {
+    public:
+        struct Entry
+        {
+            u64 sortKey;
+            u32 offset;
+            CommandType type;
+        };
+
+    private:
+        // Memory is made of 8 byte words to keep every command suitably aligned.
+        HeapArray<u64> m_memory;
+        HeapArray<Entry> m_entries;
+
+    public:
+        CommandBuffer() = default;
+
+        template<typename Command>
+        void Add(const u64 sortKey, const Command& command)
+        {
+            static_assert(std::is_trivially_copyable_v<Command>, "Commands must be trivially copyable");
+            static_assert(alignof(Command) <= alignof(u64), "Commands must not be over-aligned");
+
+            const u64 wordCount = (sizeof(Command) + sizeof(u64) - 1) / sizeof(u64);
+            const u64 offset = m_memory.GetSize();
+            ASSERT(offset <= std::numeric_limits<u32>::max(), "Command buffer memory is too large");
+
+            std::memcpy(m_memory.AddUninitialized(wordCount), &command, sizeof(Command));
+            m_entries.Add(Entry{ sortKey, static_cast<u32>(offset), Command::Type });
+        }
+
+        void Reset()
+        {
+            m_memory.Clear();
+            m_entries.Clear();
+        }
+
+        const Entry* GetEntries() const
+        {
+            return m_entries.GetData();
+        }
+
+        u64 GetCommandCount() const
+        {
+            return m_entries.GetSize();
+        }
+
+        u64 GetMemorySize() const
+        {
+            return m_memory.GetSizeBytes();
+        }
+
+        const void* GetCommandData(const Entry& entry) const
+        {
+            ASSERT_SLOW(entry.offset < m_memory.GetSize());
+            return m_memory.GetData() + entry.offset;
+        }
+    };
+
+    // Commands from one or more command buffers merged in order of their sort keys.
+    // Commands with equal keys keep their recording order, with earlier buffers first,
+    // so the result does not depend on how recording was spread across threads.
+    // Command list only points at command data, so buffers must outlive its submission.
+    class CommandList final : NonCopyable
+    {
+    public:
+        struct Command
+        {
+            u64 sortKey;
+            const void* data;
+            CommandType type;
+        };
+
+    private:
+        HeapArray<Command> m_commands;
+        HeapArray<Command> m_scratch;
+
+    public:
+        CommandList() = default;
+
+        void Build(const CommandBuffer* const* buffers, u64 bufferCount);
+
+        void Build(const CommandBuffer& buffer)
+        {
+            const CommandBuffer* buffers[] = { &buffer };
+            Build(buffers, 1);
+        }
+
+        u64 GetCommandCount() const
+        {
+            return m_commands.GetSize();
+        }
+
+        const Command& GetCommand(const u64 index) const
+        {
+            return m_commands[index];
+        }
+
+        template<typename CommandData>
+        static const CommandData& Get(const Command& command)
+        {
+            ASSERT(command.type == CommandData::Type);
+            return *static_cast<const CommandData*>(command.data);
+        }
+
+        const Command* begin() const
+        {
+            return m_commands.GetBeginPtr();
+        }
+
+        const Command* end() const
+        {
+            return m_commands.GetEndPtr();
+        }
+    };
+}
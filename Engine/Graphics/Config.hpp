@@ -5,5 +5,6 @@ namespace Graphics
     struct RenderConfig
     {
         bool software = false;
+        u32 softwareThreadCount = 0; // Zero uses one thread per logical processor
     };
 }
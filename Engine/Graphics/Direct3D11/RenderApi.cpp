@@ -1,14 +1,85 @@
 #include "Shared.hpp"
 #include "RenderApi.hpp"
 #include "Config.hpp"
+#include "Graphics/CommandBuffer.hpp"
 #include "Platform/Window.hpp"
 
+namespace
+{
+    // Positions in pixels are mapped into clip space of current viewport, so vertices use
+    // render target coordinates regardless of viewport, same as with software rasterizer.
+    constexpr char BuiltinShaderSource[] = R"(
+        cbuffer Viewport : register(b0)
+        {
+            float2 viewportOrigin;
+            float2 inverseViewportSize;
+        };
+
+        struct VertexOutput
+        {
+            float4 position : SV_Position;
+            float4 color : COLOR;
+        };
+
+        VertexOutput VertexMain(float2 position : POSITION, float4 color : COLOR)
+        {
+            float2 normalized = (position - viewportOrigin) * inverseViewportSize;
+
+            VertexOutput output;
+            output.position = float4(normalized.x * 2.0 - 1.0, 1.0 - normalized.y * 2.0, 0.0, 1.0);
+            output.color = color;
+            return output;
+        }
+
+        float4 PixelMain(VertexOutput input) : SV_Target
+        {
+            return input.color;
+        }
+    )";
+
+    struct ViewportConstants
+    {
+        f32 originX;
+        f32 originY;
+        f32 inverseWidth;
+        f32 inverseHeight;
+    };
+
+    static_assert(sizeof(ViewportConstants) % 16 == 0, "Constant buffer size must be multiple of 16 bytes");
+
+    ComPtr<ID3DBlob> CompileBuiltinShader(const char* entryPoint, const char* target)
+    {
+        UINT compileFlags = D3DCOMPILE_ENABLE_STRICTNESS;
+    #if ENABLE_GRAPHICS_DEBUG
+        compileFlags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+    #endif
+
+        ComPtr<ID3DBlob> bytecode;
+        ComPtr<ID3DBlob> errors;
+        if(FAILED(D3DCompile(BuiltinShaderSource, sizeof(BuiltinShaderSource) - 1, "BuiltinShader",
+            nullptr, nullptr, entryPoint, target, compileFlags, 0, &bytecode, &errors)))
+        {
+            LOG_ERROR("Failed to compile D3D11 built-in shader %s: %s", entryPoint,
+                errors ? static_cast<const char*>(errors->GetBufferPointer()) : "unknown error");
+            return nullptr;
+        }
+
+        return bytecode;
+    }
+}
+
 Graphics::Detail::RenderApi::~RenderApi()
 {
     if(m_context)
     {
         m_context->ClearState();
 
+        m_meshes.Clear();
+        m_viewportBuffer = nullptr;
+        m_rasterizerState = nullptr;
+        m_inputLayout = nullptr;
+        m_pixelShader = nullptr;
+        m_vertexShader = nullptr;
         m_swapchainView = nullptr;
         m_swapchain = nullptr;
         m_context = nullptr;
@@ -39,6 +110,9 @@ bool Graphics::Detail::RenderApi::Setup(const Platform::Window* window, const Re
     if(!CreateSwapchainSync())
         return false;
 
+    if(!CreatePipeline())
+        return false;
+
     return true;
 }
 
@@ -211,6 +285,98 @@ bool Graphics::Detail::RenderApi::CreateSwapchainSync()
     return true;
 }
 
+bool Graphics::Detail::RenderApi::CreatePipeline()
+{
+    ASSERT(m_device);
+
+    // Shader model 4 profiles for feature level 9_3, which is the lowest one supporting instancing.
+    ComPtr<ID3DBlob> vertexBytecode = CompileBuiltinShader("VertexMain", "vs_4_0_level_9_3");
+    ComPtr<ID3DBlob> pixelBytecode = CompileBuiltinShader("PixelMain", "ps_4_0_level_9_3");
+    if(!vertexBytecode || !pixelBytecode)
+        return false;
+
+    if(FAILED(m_device->CreateVertexShader(vertexBytecode->GetBufferPointer(),
+        vertexBytecode->GetBufferSize(), nullptr, &m_vertexShader)))
+    {
+        LOG_ERROR("Failed to create D3D11 vertex shader");
+        return false;
+    }
+
+    if(FAILED(m_device->CreatePixelShader(pixelBytecode->GetBufferPointer(),
+        pixelBytecode->GetBufferSize(), nullptr, &m_pixelShader)))
+    {
+        LOG_ERROR("Failed to create D3D11 pixel shader");
+        return false;
+    }
+
+    // Packed color of software vertex stores red in its lowest byte.
+    const D3D11_INPUT_ELEMENT_DESC inputElements[] =
+    {
+        { "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT, 0, offsetof(Software::Vertex, x),
+            D3D11_INPUT_PER_VERTEX_DATA, 0 },
+        { "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, offsetof(Software::Vertex, color),
+            D3D11_INPUT_PER_VERTEX_DATA, 0 },
+    };
+
+    if(FAILED(m_device->CreateInputLayout(inputElements, ArraySize(inputElements),
+        vertexBytecode->GetBufferPointer(), vertexBytecode->GetBufferSize(), &m_inputLayout)))
+    {
+        LOG_ERROR("Failed to create D3D11 input layout");
+        return false;
+    }
+
+    // Triangles are drawn regardless of their winding, same as with software rasterizer.
+    D3D11_RASTERIZER_DESC rasterizerDesc = {};
+    rasterizerDesc.FillMode = D3D11_FILL_SOLID;
+    rasterizerDesc.CullMode = D3D11_CULL_NONE;
+    rasterizerDesc.DepthClipEnable = TRUE;
+
+    if(FAILED(m_device->CreateRasterizerState(&rasterizerDesc, &m_rasterizerState)))
+    {
+        LOG_ERROR("Failed to create D3D11 rasterizer state");
+        return false;
+    }
+
+    D3D11_BUFFER_DESC viewportBufferDesc = {};
+    viewportBufferDesc.ByteWidth = sizeof(ViewportConstants);
+    viewportBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+    viewportBufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+
+    if(FAILED(m_device->CreateBuffer(&viewportBufferDesc, nullptr, &m_viewportBuffer)))
+    {
+        LOG_ERROR("Failed to create D3D11 viewport constant buffer");
+        return false;
+    }
+
+    LOG_DEBUG("Created D3D11 pipeline");
+    return true;
+}
+
+u32 Graphics::Detail::RenderApi::CreateMesh(const Software::Vertex* vertices, const u32 vertexCount)
+{
+    ASSERT(m_device);
+    ASSERT(vertices != nullptr && vertexCount > 0);
+
+    D3D11_BUFFER_DESC bufferDesc = {};
+    bufferDesc.ByteWidth = static_cast<UINT>(sizeof(Software::Vertex) * vertexCount);
+    bufferDesc.Usage = D3D11_USAGE_IMMUTABLE;
+    bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+
+    D3D11_SUBRESOURCE_DATA bufferData = {};
+    bufferData.pSysMem = vertices;
+
+    Mesh mesh;
+    mesh.vertexCount = vertexCount;
+    if(FAILED(m_device->CreateBuffer(&bufferDesc, &bufferData, &mesh.vertexBuffer)))
+    {
+        LOG_ERROR("Failed to create D3D11 mesh vertex buffer");
+        return InvalidMesh;
+    }
+
+    m_meshes.Add(Move(mesh));
+    return static_cast<u32>(m_meshes.GetSize() - 1);
+}
+
 void Graphics::Detail::RenderApi::ResizeSwapchain(u32 width, u32 height)
 {
     ASSERT(m_context);
@@ -250,21 +416,101 @@ void Graphics::Detail::RenderApi::BeginFrame(u32 width, u32 height)
 
     m_context->ClearState();
 
-    D3D11_VIEWPORT viewport;
-    viewport.Width = static_cast<f32>(width);
-    viewport.Height = static_cast<f32>(height);
-    viewport.MinDepth = 0.0f;
-    viewport.MaxDepth = 1.0f;
-    viewport.TopLeftX = 0;
-    viewport.TopLeftY = 0;
+    // Built-in pipeline is bound once per frame, as it is shared by all draws.
+    m_context->IASetInputLayout(m_inputLayout.Get());
+    m_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    m_context->VSSetShader(m_vertexShader.Get(), nullptr, 0);
+    m_context->VSSetConstantBuffers(0, 1, m_viewportBuffer.GetAddressOf());
+    m_context->PSSetShader(m_pixelShader.Get(), nullptr, 0);
+    m_context->RSSetState(m_rasterizerState.Get());
 
-    m_context->RSSetViewports(1, &viewport);
+    SetViewport(0.0f, 0.0f, static_cast<f32>(width), static_cast<f32>(height));
     m_context->OMSetRenderTargets(1, m_swapchainView.GetAddressOf(), nullptr);
 
     constexpr f32 ClearColor[4] = { 0.0f, 0.25f, 0.25f, 1.0f };
     m_context->ClearRenderTargetView(m_swapchainView.Get(), &ClearColor[0]);
 }
 
+void Graphics::Detail::RenderApi::Submit(const CommandList& commandList)
+{
+    ASSERT(m_context);
+
+    u64 invalidCount = 0;
+    for(const CommandList::Command& command : commandList)
+    {
+        switch(command.type)
+        {
+        case CommandType::Clear:
+        {
+            const ClearCommand& clear = CommandList::Get<ClearCommand>(command);
+            m_context->ClearRenderTargetView(m_swapchainView.Get(), &clear.color[0]);
+            break;
+        }
+
+        case CommandType::SetViewport:
+        {
+            const SetViewportCommand& setViewport = CommandList::Get<SetViewportCommand>(command);
+            SetViewport(static_cast<f32>(setViewport.x), static_cast<f32>(setViewport.y),
+                static_cast<f32>(setViewport.width), static_cast<f32>(setViewport.height));
+            break;
+        }
+
+        case CommandType::Draw:
+        {
+            if(!ExecuteDraw(CommandList::Get<DrawCommand>(command)))
+            {
+                ++invalidCount;
+            }
+
+            break;
+        }
+
+        default:
+            ASSERT(false, "Unknown command type");
+            break;
+        }
+    }
+
+    if(invalidCount > 0)
+    {
+        LOG_ERROR("Submitted command list contains %llu invalid draw commands", invalidCount);
+    }
+}
+
+void Graphics::Detail::RenderApi::SetViewport(const f32 x, const f32 y, const f32 width, const f32 height)
+{
+    D3D11_VIEWPORT viewport;
+    viewport.Width = width;
+    viewport.Height = height;
+    viewport.MinDepth = 0.0f;
+    viewport.MaxDepth = 1.0f;
+    viewport.TopLeftX = x;
+    viewport.TopLeftY = y;
+    m_context->RSSetViewports(1, &viewport);
+
+    // Empty viewport of minimized window draws nothing either way.
+    const ViewportConstants constants = { x, y,
+        width > 0.0f ? 1.0f / width : 0.0f, height > 0.0f ? 1.0f / height : 0.0f };
+    m_context->UpdateSubresource(m_viewportBuffer.Get(), 0, nullptr, &constants, 0, 0);
+}
+
+bool Graphics::Detail::RenderApi::ExecuteDraw(const DrawCommand& draw)
+{
+    if(draw.mesh >= m_meshes.GetSize() || draw.vertexCount == 0 || draw.instanceCount == 0)
+        return false;
+
+    const Mesh& mesh = m_meshes[draw.mesh];
+    if(static_cast<u64>(draw.vertexOffset) + draw.vertexCount > mesh.vertexCount || draw.vertexCount % 3 != 0)
+        return false;
+
+    // Without per instance data, every instance draws the same vertices.
+    const UINT stride = sizeof(Software::Vertex);
+    const UINT offset = 0;
+    m_context->IASetVertexBuffers(0, 1, mesh.vertexBuffer.GetAddressOf(), &stride, &offset);
+    m_context->DrawInstanced(draw.vertexCount, draw.instanceCount, draw.vertexOffset, 0);
+    return true;
+}
+
 void Graphics::Detail::RenderApi::EndFrame()
 {
     ASSERT(m_swapchain);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Graphics/Software/Rasterizer.hpp"
+
 namespace Platform
 {
     class Window;
@@ -8,18 +10,35 @@ namespace Platform
 namespace Graphics
 {
     struct RenderConfig;
+    struct DrawCommand;
+    class CommandList;
 }
 
 namespace Graphics::Detail
 {
+    // Draws flat shaded triangles from meshes with the same vertex layout as software rasterizer,
+    // in pixel coordinates of render target, with a single built-in pipeline for all draws.
     class RenderApi final : NonCopyable
     {
+        struct Mesh
+        {
+            ComPtr<ID3D11Buffer> vertexBuffer;
+            u32 vertexCount = 0;
+        };
+
         ComPtr<ID3D11Device5> m_device;
         ComPtr<ID3D11DeviceContext4> m_context;
         ComPtr<IDXGISwapChain4> m_swapchain;
         ComPtr<ID3D11RenderTargetView> m_swapchainView;
         HANDLE m_swapchainFrameWaitable = nullptr;
 
+        ComPtr<ID3D11VertexShader> m_vertexShader;
+        ComPtr<ID3D11PixelShader> m_pixelShader;
+        ComPtr<ID3D11InputLayout> m_inputLayout;
+        ComPtr<ID3D11RasterizerState> m_rasterizerState;
+        ComPtr<ID3D11Buffer> m_viewportBuffer;
+        HeapArray<Mesh> m_meshes;
+
     public:
         RenderApi() = default;
         ~RenderApi();
@@ -29,8 +48,13 @@ namespace Graphics::Detail
 
         void WaitForFrame() const;
         void BeginFrame(u32 width, u32 height);
+        void Submit(const CommandList& commandList);
         void EndFrame();
 
+        // Returns index of mesh referenced by draw commands, or InvalidMesh on failure.
+        static constexpr u32 InvalidMesh = ~0u;
+        u32 CreateMesh(const Software::Vertex* vertices, u32 vertexCount);
+
         ID3D11Device5* GetDevice() const
         {
             ASSERT(m_device);
@@ -48,6 +72,9 @@ namespace Graphics::Detail
         bool CreateSwapchain(const Platform::Window* window);
         bool CreateSwapchainView();
         bool CreateSwapchainSync();
+        bool CreatePipeline();
         void ResizeSwapchain(u32 width, u32 height);
+        void SetViewport(f32 x, f32 y, f32 width, f32 height);
+        bool ExecuteDraw(const DrawCommand& draw);
     };
 }
@@ -1,14 +1,40 @@
 #include "Shared.hpp"
 #include "RenderApi.hpp"
 #include "Graphics/RenderApi.hpp"
+#include "Graphics/Config.hpp"
+#include "Platform/Window.hpp"
 
 bool Graphics::Detail::RenderApi::Setup(const Platform::Window* window, const RenderConfig& config)
 {
+    if(!config.software)
+        return true;
+
+    Software::RasterizerConfig rasterizerConfig;
+    rasterizerConfig.threadCount = config.softwareThreadCount;
+    if(!m_rasterizer.Setup(rasterizerConfig))
+    {
+        LOG_ERROR("Failed to setup software rasterizer");
+        return false;
+    }
+
+    if(window)
+    {
+        m_framebuffer.Resize(window->GetWidth(), window->GetHeight());
+    }
+
+    m_rasterizer.SetTarget(&m_framebuffer);
+    m_software = true;
     return true;
 }
 
-void Graphics::Detail::RenderApi::Resize(u32 width, u32 height)
+void Graphics::Detail::RenderApi::Resize(const u32 width, const u32 height)
 {
+    if(!m_software)
+        return;
+
+    m_rasterizer.SetTarget(nullptr);
+    m_framebuffer.Resize(width, height);
+    m_rasterizer.SetTarget(&m_framebuffer);
 }
 
 void Graphics::Detail::RenderApi::WaitForFrame() const
@@ -17,8 +43,133 @@ void Graphics::Detail::RenderApi::WaitForFrame() const
 
 void Graphics::Detail::RenderApi::BeginFrame(u32 width, u32 height)
 {
+    if(m_software)
+    {
+        m_rasterizer.SetViewport(0, 0, m_framebuffer.GetWidth(), m_framebuffer.GetHeight());
+    }
+}
+
+void Graphics::Detail::RenderApi::Submit(const CommandList& commandList)
+{
+    u64 invalidCount = 0;
+    u64 previousSortKey = 0;
+    for(const CommandList::Command& command : commandList)
+    {
+        if(command.sortKey < previousSortKey || !ValidateCommand(command))
+        {
+            ++invalidCount;
+            continue;
+        }
+
+        if(m_software && !ExecuteSoftware(command))
+        {
+            ++invalidCount;
+            continue;
+        }
+
+        ++m_submitStats.typeCounts[static_cast<u64>(command.type)];
+        previousSortKey = command.sortKey;
+    }
+
+    if(invalidCount > 0)
+    {
+        LOG_ERROR("Submitted command list contains %llu invalid commands", invalidCount);
+    }
+
+    m_submitStats.submitCount += 1;
+    m_submitStats.commandCount += commandList.GetCommandCount() - invalidCount;
+    m_submitStats.invalidCount += invalidCount;
 }
 
 void Graphics::Detail::RenderApi::EndFrame()
 {
+    if(m_software)
+    {
+        m_rasterizer.Flush();
+    }
+}
+
+u32 Graphics::Detail::RenderApi::CreateSoftwareMesh(const Software::Vertex* vertices, const u32 vertexCount)
+{
+    ASSERT(vertices != nullptr || vertexCount == 0);
+
+    HeapArray<Software::Vertex>& mesh = m_meshes.Add();
+    mesh.AppendRange(vertices, vertexCount);
+    return static_cast<u32>(m_meshes.GetSize() - 1);
+}
+
+bool Graphics::Detail::RenderApi::ValidateCommand(const CommandList::Command& command)
+{
+    if(command.data == nullptr)
+        return false;
+
+    switch(command.type)
+    {
+    case CommandType::Clear:
+        return true;
+
+    case CommandType::SetViewport:
+    {
+        const SetViewportCommand& viewport = CommandList::Get<SetViewportCommand>(command);
+        return viewport.width > 0 && viewport.height > 0;
+    }
+
+    case CommandType::Draw:
+    {
+        const DrawCommand& draw = CommandList::Get<DrawCommand>(command);
+        return draw.vertexCount > 0 && draw.instanceCount > 0;
+    }
+
+    default:
+        return false;
+    }
+}
+
+bool Graphics::Detail::RenderApi::ExecuteSoftware(const CommandList::Command& command)
+{
+    switch(command.type)
+    {
+    case CommandType::Clear:
+    {
+        const ClearCommand& clear = CommandList::Get<ClearCommand>(command);
+        const auto ToByte = [](const f32 value)
+        {
+            return static_cast<u8>(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+        };
+
+        m_rasterizer.Clear(Software::PackColor(ToByte(clear.color[0]),
+            ToByte(clear.color[1]), ToByte(clear.color[2]), ToByte(clear.color[3])));
+        return true;
+    }
+
+    case CommandType::SetViewport:
+    {
+        const SetViewportCommand& viewport = CommandList::Get<SetViewportCommand>(command);
+        m_rasterizer.SetViewport(static_cast<i32>(viewport.x), static_cast<i32>(viewport.y), viewport.width, viewport.height);
+        return true;
+    }
+
+    case CommandType::Draw:
+    {
+        const DrawCommand& draw = CommandList::Get<DrawCommand>(command);
+        if(draw.mesh >= m_meshes.GetSize())
+            return false;
+
+        const HeapArray<Software::Vertex>& mesh = m_meshes[draw.mesh];
+        if(static_cast<u64>(draw.vertexOffset) + draw.vertexCount > mesh.GetSize() || draw.vertexCount % 3 != 0)
+            return false;
+
+        // Without per instance data, every instance rasterizes the same vertices,
+        // same as instanced draw on hardware without instance buffers bound.
+        for(u32 instance = 0; instance < draw.instanceCount; ++instance)
+        {
+            m_rasterizer.DrawTriangles(mesh.GetData() + draw.vertexOffset, draw.vertexCount);
+        }
+
+        return true;
+    }
+
+    default:
+        return false;
+    }
 }
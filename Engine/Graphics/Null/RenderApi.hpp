@@ -1,5 +1,9 @@
 #pragma once
 
+#include "Graphics/CommandBuffer.hpp"
+#include "Graphics/Software/Framebuffer.hpp"
+#include "Graphics/Software/Rasterizer.hpp"
+
 namespace Platform
 {
     class Window;
@@ -7,13 +11,31 @@ namespace Platform
 
 namespace Graphics
 {
-    struct SystemConfig;
+    struct RenderConfig;
 }
 
 namespace Graphics::Detail
 {
+    // Totals of commands executed by null backend, which stand in for GPU work in tests.
+    struct SubmitStats
+    {
+        u64 submitCount = 0;
+        u64 commandCount = 0;
+        u64 invalidCount = 0;
+        u64 typeCounts[static_cast<u64>(CommandType::Count)] = {};
+    };
+
+    // Executes command lists by validating and counting their commands, so the whole command
+    // path can run without GPU. With software rendering enabled, commands are also rendered by
+    // software rasterizer into in-memory framebuffer, with meshes created from CPU side vertices.
     class RenderApi final : NonCopyable
     {
+        SubmitStats m_submitStats;
+        Software::Framebuffer m_framebuffer;
+        Software::Rasterizer m_rasterizer;
+        HeapArray<HeapArray<Software::Vertex>> m_meshes;
+        bool m_software = false;
+
     public:
         RenderApi() = default;
         ~RenderApi() = default;
@@ -23,6 +45,35 @@ namespace Graphics::Detail
 
         void WaitForFrame() const;
         void BeginFrame(u32 width, u32 height);
+        void Submit(const CommandList& commandList);
         void EndFrame();
+
+        // Returns index of mesh referenced by draw commands.
+        u32 CreateSoftwareMesh(const Software::Vertex* vertices, u32 vertexCount);
+
+        static bool ValidateCommand(const CommandList::Command& command);
+
+        bool IsSoftware() const
+        {
+            return m_software;
+        }
+
+        const Software::Framebuffer& GetFramebuffer() const
+        {
+            return m_framebuffer;
+        }
+
+        const Software::Rasterizer& GetRasterizer() const
+        {
+            return m_rasterizer;
+        }
+
+        const SubmitStats& GetSubmitStats() const
+        {
+            return m_submitStats;
+        }
+
+    private:
+        bool ExecuteSoftware(const CommandList::Command& command);
     };
 }
@@ -1,15 +1,9 @@
 #include "Shared.hpp"
 #include "RenderApi.hpp"
-#include "Stats.hpp"
 #include "Platform/Window.hpp"
 
 Graphics::RenderApi::~RenderApi()
 {
-    if(m_window)
-    {
-        m_window->GetResizeDelegate().Remove(m_windowResizeDelegate);
-    }
-
     if(m_setup)
     {
         LOG_DEBUG("Destroying graphics render API...");
@@ -22,41 +16,45 @@ bool Graphics::RenderApi::Setup(Platform::Window* window, const RenderConfig& co
     LOG_DEBUG("Setting up graphics render API...");
 
     ASSERT(window);
-    m_window = window;
-
-    if(!m_detail.Setup(m_window, config))
+    if(!m_detail.Setup(window, config))
     {
         return false;
     }
 
-    // #todo: Implement Function::CreateMethod() and similar utility functions for shortening this code.
-    Function<void(u32 width, u32 height)> onResizeFunction;
-    onResizeFunction.Bind<&Graphics::RenderApi::OnResize>(this);
-    m_windowResizeDelegate = m_window->GetResizeDelegate().Add(std::move(onResizeFunction));
+    m_width = window->GetWidth();
+    m_height = window->GetHeight();
 
     LOG_SUCCESS("Graphics render API setup complete");
     return m_setup = true;
 }
 
+void Graphics::RenderApi::Resize(const u32 width, const u32 height)
+{
+    if(width != m_width || height != m_height)
+    {
+        m_detail.Resize(width, height);
+        m_width = width;
+        m_height = height;
+    }
+}
+
 void Graphics::RenderApi::WaitForFrame() const
 {
     m_detail.WaitForFrame();
 }
 
-void Graphics::RenderApi::BeginFrame()
+void Graphics::RenderApi::BeginFrame(const u32 width, const u32 height)
 {
-    m_detail.BeginFrame(m_window->GetWidth(), m_window->GetHeight());
+    Resize(width, height);
+    m_detail.BeginFrame(width, height);
 }
 
-void Graphics::RenderApi::EndFrame()
+void Graphics::RenderApi::Submit(const CommandList& commandList)
 {
-    m_detail.EndFrame();
-
-    Stats& stats = Stats::Get();
-    stats.OnEndFrame();
+    m_detail.Submit(commandList);
 }
 
-void Graphics::RenderApi::OnResize(u32 width, u32 height)
+void Graphics::RenderApi::EndFrame()
 {
-    m_detail.Resize(width, height);
+    m_detail.EndFrame();
 }
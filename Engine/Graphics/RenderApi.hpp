@@ -16,12 +16,13 @@ namespace Platform
 namespace Graphics
 {
     struct RenderConfig;
+    class CommandList;
 
     class RenderApi final : NonCopyable
     {
         Detail::RenderApi m_detail;
-        Platform::Window* m_window = nullptr;
-        DelegateHandle m_windowResizeDelegate;
+        u32 m_width = 0;
+        u32 m_height = 0;
         bool m_setup = false;
 
     public:
@@ -30,11 +31,36 @@ namespace Graphics
 
         bool Setup(Platform::Window* window, const RenderConfig& config);
 
+        // Frame functions must be called from a single thread at a time, which can be
+        // a different thread than the one window is processed on. Swapchain is resized
+        // when frame size changes, which avoids touching it from window event handlers.
+        // Resizing swapchain may wait for window thread to process its messages, so render
+        // thread must not resize it while window thread waits for render thread. Resize can
+        // instead be called ahead from window thread while no frame functions are running.
+        void Resize(u32 width, u32 height);
         void WaitForFrame() const;
-        void BeginFrame();
+        void BeginFrame(u32 width, u32 height);
+        void Submit(const CommandList& commandList);
         void EndFrame();
 
-    private:
-        void OnResize(u32 width, u32 height);
+        u32 GetWidth() const
+        {
+            return m_width;
+        }
+
+        u32 GetHeight() const
+        {
+            return m_height;
+        }
+
+        Detail::RenderApi& GetDetail()
+        {
+            return m_detail;
+        }
+
+        bool IsSetup() const
+        {
+            return m_setup;
+        }
     };
 }
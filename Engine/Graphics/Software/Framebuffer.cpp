@@ -0,0 +1,42 @@
+#include "Shared.hpp"
+#include "Framebuffer.hpp"
+#include "Platform/Utility.hpp"
+
+void Graphics::Software::Framebuffer::Resize(const u32 width, const u32 height)
+{
+    ASSERT(width <= MaxSize && height <= MaxSize, "Framebuffer size %ux%u exceeds maximum", width, height);
+
+    m_pixels.Resize(static_cast<u64>(width) * height, 0u);
+    m_width = width;
+    m_height = height;
+}
+
+void Graphics::Software::Framebuffer::Clear(const u32 color)
+{
+    u32* pixels = m_pixels.GetData();
+    for(u64 i = 0; i < m_pixels.GetSize(); ++i)
+    {
+        pixels[i] = color;
+    }
+}
+
+bool Graphics::Software::Framebuffer::SavePPM(const StringView& filePath) const
+{
+    InlineString<32> header;
+    header.Append("P6\n%u %u\n255\n", m_width, m_height);
+
+    HeapArray<char> image;
+    image.Reserve(header.GetLength() + m_pixels.GetSize() * 3);
+    image.AppendRange(header.GetData(), header.GetLength());
+
+    char* rgb = image.AddUninitialized(m_pixels.GetSize() * 3);
+    for(u64 i = 0; i < m_pixels.GetSize(); ++i)
+    {
+        const u32 pixel = m_pixels[i];
+        rgb[i * 3 + 0] = static_cast<char>(pixel & 0xFF);
+        rgb[i * 3 + 1] = static_cast<char>((pixel >> 8) & 0xFF);
+        rgb[i * 3 + 2] = static_cast<char>((pixel >> 16) & 0xFF);
+    }
+
+    return WriteStringToFile(filePath, StringView(image.GetData(), image.GetSize()));
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+namespace Graphics::Software
+{
+    // Colors are packed with red in the lowest byte, which matches RGBA8 byte order in memory.
+    constexpr u32 PackColor(const u8 red, const u8 green, const u8 blue, const u8 alpha = 255)
+    {
+        return static_cast<u32>(red) | static_cast<u32>(green) << 8 |
+            static_cast<u32>(blue) << 16 | static_cast<u32>(alpha) << 24;
+    }
+
+    // In-memory color buffer written by software rasterizer.
+    class Framebuffer final : NonCopyable
+    {
+        HeapArray<u32> m_pixels;
+        u32 m_width = 0;
+        u32 m_height = 0;
+
+    public:
+        static constexpr u32 MaxSize = 8192;
+
+        Framebuffer() = default;
+
+        void Resize(u32 width, u32 height);
+        void Clear(u32 color);
+
+        // Writes binary PPM image, which drops alpha channel.
+        bool SavePPM(const StringView& filePath) const;
+
+        u32* GetRow(const u32 y)
+        {
+            ASSERT_SLOW(y < m_height);
+            return m_pixels.GetData() + static_cast<u64>(y) * m_width;
+        }
+
+        const u32* GetRow(const u32 y) const
+        {
+            ASSERT_SLOW(y < m_height);
+            return m_pixels.GetData() + static_cast<u64>(y) * m_width;
+        }
+
+        u32 GetPixel(const u32 x, const u32 y) const
+        {
+            ASSERT(x < m_width && y < m_height);
+            return GetRow(y)[x];
+        }
+
+        u32 GetWidth() const
+        {
+            return m_width;
+        }
+
+        u32 GetHeight() const
+        {
+            return m_height;
+        }
+    };
+}
@@ -0,0 +1,495 @@
+#include "Shared.hpp"
+#include "Rasterizer.hpp"
+#include "Framebuffer.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define RASTERIZER_SSE2 1
+#else
+    #define RASTERIZER_SSE2 0
+#endif
+
+namespace
+{
+    // Edge values far from zero are clamped at the start of every row, which keeps their sign
+    // while leaving enough headroom for stepping across a tile without overflowing 32 bits.
+    constexpr i64 EdgeClamp = 1ll << 30;
+
+    struct EdgeFunction
+    {
+        i64 stepX;
+        i64 stepY;
+        i64 originX;
+        i64 originY;
+        i64 bias;
+
+        EdgeFunction(const i32 ax, const i32 ay, const i32 bx, const i32 by)
+        {
+            // Positive inside of triangle with positive area. Pixels exactly on the edge are
+            // only covered by top or left edges, which is decided in opposite ways for the two
+            // triangles sharing the edge, because they walk it in opposite directions.
+            stepX = -(static_cast<i64>(by) - ay);
+            stepY = static_cast<i64>(bx) - ax;
+            originX = ax;
+            originY = ay;
+
+            const bool topLeft = stepX > 0 || (stepX == 0 && stepY > 0);
+            bias = topLeft ? 0 : -1;
+        }
+
+        i64 Evaluate(const i64 x, const i64 y) const
+        {
+            return stepX * (x - originX) + stepY * (y - originY) + bias;
+        }
+
+        i32 EvaluateClamped(const i64 x, const i64 y) const
+        {
+            return static_cast<i32>(std::min(std::max(Evaluate(x, y), -EdgeClamp), EdgeClamp));
+        }
+    };
+}
+
+Graphics::Software::Rasterizer::~Rasterizer()
+{
+    Shutdown();
+}
+
+bool Graphics::Software::Rasterizer::Setup(const RasterizerConfig& config)
+{
+    ASSERT(!m_setup);
+    LOG_DEBUG("Setting up software rasterizer...");
+
+    u32 threadCount = config.threadCount;
+    if(threadCount == 0)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Calling thread always takes part as the first worker.
+    m_threadCount = std::min(threadCount, MaxThreadCount);
+    m_setup = true;
+
+    for(u32 i = 1; i < m_threadCount; ++i)
+    {
+        Thread::Config threadConfig;
+        threadConfig.name = "Rasterizer";
+        m_workers[i] = Thread::Create(threadConfig, [this, i]()
+        {
+            WorkerThread(i);
+        });
+
+        if(!m_workers[i].IsJoinable())
+        {
+            LOG_ERROR("Failed to create software rasterizer thread");
+            m_threadCount = i;
+            Shutdown();
+            return false;
+        }
+    }
+
+    LOG_SUCCESS("Software rasterizer setup complete with %u threads", m_threadCount);
+    return true;
+}
+
+void Graphics::Software::Rasterizer::Shutdown()
+{
+    if(!m_setup)
+        return;
+
+    m_phase = Phase::Exit;
+    for(u32 i = 1; i < m_threadCount; ++i)
+    {
+        m_workerStart[i].Release();
+        m_workers[i].Join();
+    }
+
+    m_pending.Clear();
+    m_target = nullptr;
+    m_threadCount = 1;
+    m_setup = false;
+}
+
+void Graphics::Software::Rasterizer::SetTarget(Framebuffer* target)
+{
+    // Queued triangles are always rasterized into target they were drawn for.
+    if(target != m_target)
+    {
+        Flush();
+    }
+
+    m_target = target;
+    if(m_target)
+    {
+        SetViewport(0, 0, m_target->GetWidth(), m_target->GetHeight());
+    }
+}
+
+void Graphics::Software::Rasterizer::SetViewport(const i32 x, const i32 y, const u32 width, const u32 height)
+{
+    m_viewport.minX = x;
+    m_viewport.minY = y;
+    m_viewport.maxX = x + static_cast<i32>(width);
+    m_viewport.maxY = y + static_cast<i32>(height);
+}
+
+void Graphics::Software::Rasterizer::DrawTriangles(const Vertex* vertices, const u64 vertexCount)
+{
+    ASSERT(m_setup);
+    ASSERT(m_target, "Rasterizer target must be set before drawing");
+    ASSERT(vertices != nullptr || vertexCount == 0);
+    ASSERT(vertexCount % 3 == 0, "Vertex count must be a multiple of three");
+    ASSERT(m_pending.GetSize() + vertexCount / 3 <= std::numeric_limits<u32>::max());
+
+    PendingTriangle* triangles = m_pending.AddUninitialized(vertexCount / 3);
+    for(u64 i = 0; i < vertexCount / 3; ++i)
+    {
+        triangles[i].vertices[0] = vertices[i * 3 + 0];
+        triangles[i].vertices[1] = vertices[i * 3 + 1];
+        triangles[i].vertices[2] = vertices[i * 3 + 2];
+        triangles[i].scissor = m_viewport;
+    }
+}
+
+void Graphics::Software::Rasterizer::Clear(const u32 color)
+{
+    ASSERT(m_target);
+    Flush();
+    m_target->Clear(color);
+}
+
+void Graphics::Software::Rasterizer::Flush()
+{
+    ASSERT(m_setup);
+    if(m_pending.IsEmpty())
+        return;
+
+    ASSERT(m_target);
+    m_tileCountX = (m_target->GetWidth() + TileSize - 1) / TileSize;
+    m_tileCountY = (m_target->GetHeight() + TileSize - 1) / TileSize;
+
+    // Bins keep their capacity between flushes, so steady state does not allocate.
+    const u64 binCount = static_cast<u64>(m_threadCount) * m_tileCountX * m_tileCountY;
+    if(m_bins.GetSize() < binCount)
+    {
+        m_bins.Resize(binCount);
+    }
+
+    for(u64 i = 0; i < binCount; ++i)
+    {
+        m_bins[i].Clear();
+    }
+
+    m_triangles.Resize(m_pending.GetSize());
+    RunPhase(Phase::Bin);
+
+    m_nextTile.store(0, std::memory_order_relaxed);
+    RunPhase(Phase::Rasterize);
+
+    m_pending.Clear();
+}
+
+void Graphics::Software::Rasterizer::WorkerThread(const u32 workerIndex)
+{
+    while(true)
+    {
+        m_workerStart[workerIndex].Acquire();
+
+        const Phase phase = m_phase;
+        if(phase == Phase::Exit)
+            break;
+
+        ExecutePhase(phase, workerIndex);
+        m_workerDone.Release();
+    }
+}
+
+void Graphics::Software::Rasterizer::RunPhase(const Phase phase)
+{
+    m_phase = phase;
+    for(u32 i = 1; i < m_threadCount; ++i)
+    {
+        m_workerStart[i].Release();
+    }
+
+    ExecutePhase(phase, 0);
+
+    for(u32 i = 1; i < m_threadCount; ++i)
+    {
+        m_workerDone.Acquire();
+    }
+}
+
+void Graphics::Software::Rasterizer::ExecutePhase(const Phase phase, const u32 workerIndex)
+{
+    switch(phase)
+    {
+    case Phase::Bin:
+        BinTriangles(workerIndex);
+        break;
+
+    case Phase::Rasterize:
+        RasterizeTiles(workerIndex);
+        break;
+
+    default:
+        ASSERT(false, "Unexpected rasterizer phase");
+        break;
+    }
+}
+
+void Graphics::Software::Rasterizer::BinTriangles(const u32 workerIndex)
+{
+    const i32 subpixelScale = 1 << SubpixelBits;
+    const i32 halfPixel = subpixelScale / 2;
+
+    const u64 triangleCount = m_pending.GetSize();
+    const u64 beginIndex = triangleCount * workerIndex / m_threadCount;
+    const u64 endIndex = triangleCount * (workerIndex + 1) / m_threadCount;
+
+    const u64 tileCount = static_cast<u64>(m_tileCountX) * m_tileCountY;
+    HeapArray<u32>* bins = m_bins.GetData() + workerIndex * tileCount;
+
+    const i32 targetWidth = static_cast<i32>(m_target->GetWidth());
+    const i32 targetHeight = static_cast<i32>(m_target->GetHeight());
+
+    for(u64 index = beginIndex; index < endIndex; ++index)
+    {
+        const PendingTriangle& pending = m_pending[index];
+        Triangle& triangle = m_triangles[index];
+
+        bool insideGuardBand = true;
+        for(u32 i = 0; i < 3; ++i)
+        {
+            const f32 x = pending.vertices[i].x + static_cast<f32>(pending.scissor.minX);
+            const f32 y = pending.vertices[i].y + static_cast<f32>(pending.scissor.minY);
+
+            // Comparisons are written to also reject non-finite positions.
+            if(!(x >= -GuardBand && x <= GuardBand && y >= -GuardBand && y <= GuardBand))
+            {
+                insideGuardBand = false;
+                break;
+            }
+
+            triangle.x[i] = static_cast<i32>(std::lround(x * subpixelScale));
+            triangle.y[i] = static_cast<i32>(std::lround(y * subpixelScale));
+        }
+
+        if(!insideGuardBand)
+            continue;
+
+        const i64 area =
+            (static_cast<i64>(triangle.x[1]) - triangle.x[0]) * (static_cast<i64>(triangle.y[2]) - triangle.y[0]) -
+            (static_cast<i64>(triangle.y[1]) - triangle.y[0]) * (static_cast<i64>(triangle.x[2]) - triangle.x[0]);
+
+        if(area == 0)
+            continue;
+
+        // Both windings are drawn, so reverse ones are flipped to keep edge functions positive inside.
+        if(area < 0)
+        {
+            std::swap(triangle.x[1], triangle.x[2]);
+            std::swap(triangle.y[1], triangle.y[2]);
+        }
+
+        // Bounds are in whole pixels whose centers can be covered, with exclusive maximum.
+        const i32 minX = std::min(triangle.x[0], std::min(triangle.x[1], triangle.x[2]));
+        const i32 minY = std::min(triangle.y[0], std::min(triangle.y[1], triangle.y[2]));
+        const i32 maxX = std::max(triangle.x[0], std::max(triangle.x[1], triangle.x[2]));
+        const i32 maxY = std::max(triangle.y[0], std::max(triangle.y[1], triangle.y[2]));
+
+        Rectangle& bounds = triangle.bounds;
+        bounds.minX = std::max((minX - halfPixel + subpixelScale - 1) >> SubpixelBits, std::max(pending.scissor.minX, 0));
+        bounds.minY = std::max((minY - halfPixel + subpixelScale - 1) >> SubpixelBits, std::max(pending.scissor.minY, 0));
+        bounds.maxX = std::min(((maxX - halfPixel) >> SubpixelBits) + 1, std::min(pending.scissor.maxX, targetWidth));
+        bounds.maxY = std::min(((maxY - halfPixel) >> SubpixelBits) + 1, std::min(pending.scissor.maxY, targetHeight));
+
+        if(bounds.minX >= bounds.maxX || bounds.minY >= bounds.maxY)
+            continue;
+
+        triangle.color = pending.vertices[0].color;
+
+        const u32 tileMinX = static_cast<u32>(bounds.minX) / TileSize;
+        const u32 tileMinY = static_cast<u32>(bounds.minY) / TileSize;
+        const u32 tileMaxX = static_cast<u32>(bounds.maxX - 1) / TileSize;
+        const u32 tileMaxY = static_cast<u32>(bounds.maxY - 1) / TileSize;
+
+        for(u32 tileY = tileMinY; tileY <= tileMaxY; ++tileY)
+        {
+            for(u32 tileX = tileMinX; tileX <= tileMaxX; ++tileX)
+            {
+                bins[tileY * m_tileCountX + tileX].Add(static_cast<u32>(index));
+            }
+        }
+    }
+}
+
+void Graphics::Software::Rasterizer::RasterizeTiles(const u32 workerIndex)
+{
+    const u32 tileCount = m_tileCountX * m_tileCountY;
+    const i32 targetWidth = static_cast<i32>(m_target->GetWidth());
+    const i32 targetHeight = static_cast<i32>(m_target->GetHeight());
+
+    u64 pixelCount = 0;
+    while(true)
+    {
+        const u32 tileIndex = m_nextTile.fetch_add(1, std::memory_order_relaxed);
+        if(tileIndex >= tileCount)
+            break;
+
+        Rectangle tile;
+        tile.minX = static_cast<i32>((tileIndex % m_tileCountX) * TileSize);
+        tile.minY = static_cast<i32>((tileIndex / m_tileCountX) * TileSize);
+        tile.maxX = std::min(tile.minX + static_cast<i32>(TileSize), targetWidth);
+        tile.maxY = std::min(tile.minY + static_cast<i32>(TileSize), targetHeight);
+
+        // Bins of earlier threads hold earlier triangles, which keeps submission order.
+        for(u32 thread = 0; thread < m_threadCount; ++thread)
+        {
+            const HeapArray<u32>& bin = m_bins[static_cast<u64>(thread) * tileCount + tileIndex];
+            for(const u32 triangleIndex : bin)
+            {
+                RasterizeTriangle(m_triangles[triangleIndex], tile, pixelCount);
+            }
+        }
+    }
+
+    m_pixelCount.fetch_add(pixelCount, std::memory_order_relaxed);
+}
+
+void Graphics::Software::Rasterizer::RasterizeTriangle(const Triangle& triangle, const Rectangle& tile, u64& pixelCount)
+{
+    const i32 minX = std::max(triangle.bounds.minX, tile.minX);
+    const i32 minY = std::max(triangle.bounds.minY, tile.minY);
+    const i32 maxX = std::min(triangle.bounds.maxX, tile.maxX);
+    const i32 maxY = std::min(triangle.bounds.maxY, tile.maxY);
+    if(minX >= maxX || minY >= maxY)
+        return;
+
+    const EdgeFunction edges[3] =
+    {
+        EdgeFunction(triangle.x[0], triangle.y[0], triangle.x[1], triangle.y[1]),
+        EdgeFunction(triangle.x[1], triangle.y[1], triangle.x[2], triangle.y[2]),
+        EdgeFunction(triangle.x[2], triangle.y[2], triangle.x[0], triangle.y[0]),
+    };
+
+    // Pixel centers are sampled at half pixel offset.
+    const i64 halfPixel = 1 << (SubpixelBits - 1);
+    const i64 sampleMinX = (static_cast<i64>(minX) << SubpixelBits) + halfPixel;
+    const i64 sampleMinY = (static_cast<i64>(minY) << SubpixelBits) + halfPixel;
+    const i64 sampleMaxX = (static_cast<i64>(maxX - 1) << SubpixelBits) + halfPixel;
+    const i64 sampleMaxY = (static_cast<i64>(maxY - 1) << SubpixelBits) + halfPixel;
+
+    // Edge that is negative at all corners of covered area rejects the whole area.
+    for(const EdgeFunction& edge : edges)
+    {
+        if(edge.Evaluate(sampleMinX, sampleMinY) < 0 && edge.Evaluate(sampleMaxX, sampleMinY) < 0 &&
+            edge.Evaluate(sampleMinX, sampleMaxY) < 0 && edge.Evaluate(sampleMaxX, sampleMaxY) < 0)
+        {
+            return;
+        }
+    }
+
+    const i32 pixelStep = 1 << SubpixelBits;
+    i32 laneOffsets[3][4];
+    i32 blockSteps[3];
+    for(u32 i = 0; i < 3; ++i)
+    {
+        const i32 stepX = static_cast<i32>(edges[i].stepX) * pixelStep;
+        for(i32 lane = 0; lane < 4; ++lane)
+        {
+            laneOffsets[i][lane] = stepX * lane;
+        }
+
+        blockSteps[i] = stepX * 4;
+    }
+
+    Framebuffer& target = *m_target;
+    const u32 color = triangle.color;
+
+#if RASTERIZER_SSE2
+    const __m128i colors = _mm_set1_epi32(static_cast<int>(color));
+    __m128i offsets[3];
+    __m128i steps[3];
+    for(u32 i = 0; i < 3; ++i)
+    {
+        offsets[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(laneOffsets[i]));
+        steps[i] = _mm_set1_epi32(blockSteps[i]);
+    }
+#endif
+
+    for(i32 y = minY; y < maxY; ++y)
+    {
+        const i64 sampleY = (static_cast<i64>(y) << SubpixelBits) + halfPixel;
+        u32* row = target.GetRow(static_cast<u32>(y));
+
+    #if RASTERIZER_SSE2
+        __m128i values[3];
+        for(u32 i = 0; i < 3; ++i)
+        {
+            values[i] = _mm_add_epi32(_mm_set1_epi32(edges[i].EvaluateClamped(sampleMinX, sampleY)), offsets[i]);
+        }
+
+        for(i32 x = minX; x < maxX; x += 4)
+        {
+            // Pixel is inside when sign bit is clear for all three edge values.
+            const __m128i combined = _mm_or_si128(values[0], _mm_or_si128(values[1], values[2]));
+            const u32 outsideMask = static_cast<u32>(_mm_movemask_ps(_mm_castsi128_ps(combined)));
+            const u32 laneMask = maxX - x >= 4 ? 0xF : (1u << (maxX - x)) - 1;
+            const u32 insideMask = ~outsideMask & laneMask;
+
+            if(insideMask == 0xF)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(row + x), colors);
+            }
+            else if(insideMask != 0)
+            {
+                for(u32 lane = 0; lane < 4; ++lane)
+                {
+                    if(insideMask & (1u << lane))
+                    {
+                        row[x + lane] = color;
+                    }
+                }
+            }
+
+            pixelCount += std::popcount(insideMask);
+
+            for(u32 i = 0; i < 3; ++i)
+            {
+                values[i] = _mm_add_epi32(values[i], steps[i]);
+            }
+        }
+    #else
+        i32 values[3][4];
+        for(u32 i = 0; i < 3; ++i)
+        {
+            const i32 value = edges[i].EvaluateClamped(sampleMinX, sampleY);
+            for(u32 lane = 0; lane < 4; ++lane)
+            {
+                values[i][lane] = value + laneOffsets[i][lane];
+            }
+        }
+
+        for(i32 x = minX; x < maxX; x += 4)
+        {
+            const u32 laneCount = static_cast<u32>(std::min(maxX - x, 4));
+            for(u32 lane = 0; lane < laneCount; ++lane)
+            {
+                if((values[0][lane] | values[1][lane] | values[2][lane]) >= 0)
+                {
+                    row[x + lane] = color;
+                    ++pixelCount;
+                }
+            }
+
+            for(u32 i = 0; i < 3; ++i)
+            {
+                for(u32 lane = 0; lane < 4; ++lane)
+                {
+                    values[i][lane] += blockSteps[i];
+                }
+            }
+        }
+    #endif
+    }
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Platform/Thread.hpp"
+#include "Platform/Synchronization.hpp"
+
+namespace Graphics::Software
+{
+    class Framebuffer;
+
+    // Vertex position is in pixels relative to viewport origin, with pixel centers at half coordinates.
+    struct Vertex
+    {
+        f32 x = 0.0f;
+        f32 y = 0.0f;
+        u32 color = 0;
+    };
+
+    struct RasterizerConfig
+    {
+        u32 threadCount = 0; // Zero uses one thread per logical processor
+    };
+
+    // Tile based rasterizer that renders flat shaded triangles into framebuffer. Triangles are
+    // queued until flushed, then binned into screen tiles by all threads in parallel, and tiles
+    // are rasterized in parallel with edge functions evaluated four pixels at a time. Every tile
+    // processes its triangles in submission order, so output does not depend on thread count.
+    // Edge functions use fixed point with subpixel precision and top-left fill rule, so triangles
+    // sharing an edge never leave gaps between them or cover the same pixel twice. Triangles are
+    // not clipped, and ones with vertices outside of guard band around framebuffer are dropped.
+    class Rasterizer final : NonCopyable
+    {
+    public:
+        static constexpr u32 TileSize = 32;
+        static constexpr u32 MaxThreadCount = 16;
+        static constexpr i32 SubpixelBits = 4;
+        static constexpr i32 GuardBand = 16384;
+
+    private:
+        struct Rectangle
+        {
+            i32 minX = 0;
+            i32 minY = 0;
+            i32 maxX = 0;
+            i32 maxY = 0;
+        };
+
+        struct PendingTriangle
+        {
+            Vertex vertices[3];
+            Rectangle scissor;
+        };
+
+        struct Triangle
+        {
+            i32 x[3];
+            i32 y[3];
+            Rectangle bounds;
+            u32 color;
+        };
+
+        enum class Phase : u8
+        {
+            Bin,
+            Rasterize,
+            Exit,
+        };
+
+        Framebuffer* m_target = nullptr;
+        Rectangle m_viewport;
+
+        HeapArray<PendingTriangle> m_pending;
+        HeapArray<Triangle> m_triangles;
+
+        // Bins of triangle indices for each thread and tile, so binning threads never share a bin.
+        HeapArray<HeapArray<u32>> m_bins;
+        u32 m_tileCountX = 0;
+        u32 m_tileCountY = 0;
+
+        u32 m_threadCount = 1;
+        Thread::Handle m_workers[MaxThreadCount];
+        Thread::Semaphore m_workerStart[MaxThreadCount];
+        Thread::Semaphore m_workerDone;
+        Phase m_phase = Phase::Bin;
+        std::atomic<u32> m_nextTile = 0;
+        std::atomic<u64> m_pixelCount = 0;
+        bool m_setup = false;
+
+    public:
+        Rasterizer() = default;
+        ~Rasterizer();
+
+        bool Setup(const RasterizerConfig& config);
+        void Shutdown();
+
+        // Changing target or viewport does not flush, as queued triangles keep their own.
+        void SetTarget(Framebuffer* target);
+        void SetViewport(i32 x, i32 y, u32 width, u32 height);
+
+        // Every three vertices make a triangle, which uses color of its first vertex.
+        void DrawTriangles(const Vertex* vertices, u64 vertexCount);
+
+        // Flushes queued triangles before clearing, which preserves ordering with them.
+        void Clear(u32 color);
+        void Flush();
+
+        u32 GetThreadCount() const
+        {
+            return m_threadCount;
+        }
+
+        // Number of pixels written since setup, useful for measuring fill rate.
+        u64 GetPixelCount() const
+        {
+            return m_pixelCount.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void WorkerThread(u32 workerIndex);
+        void RunPhase(Phase phase);
+        void ExecutePhase(Phase phase, u32 workerIndex);
+        void BinTriangles(u32 workerIndex);
+        void RasterizeTiles(u32 workerIndex);
+        void RasterizeTriangle(const Triangle& triangle, const Rectangle& tile, u64& pixelCount);
+    };
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+namespace Input
+{
+    // Key codes match virtual key codes of Windows, which are also ASCII codes for digits and letters.
+    enum class Key : u8
+    {
+        Backspace = 0x08,
+        Tab = 0x09,
+        Enter = 0x0D,
+        Shift = 0x10,
+        Control = 0x11,
+        Alt = 0x12,
+        Escape = 0x1B,
+        Space = 0x20,
+        Left = 0x25,
+        Up = 0x26,
+        Right = 0x27,
+        Down = 0x28,
+        Digit0 = 0x30,
+        Digit1, Digit2, Digit3, Digit4, Digit5, Digit6, Digit7, Digit8, Digit9,
+        A = 0x41,
+        B, C, D, E, F, G, H, I, J, K, L, M, N, O, P, Q, R, S, T, U, V, W, X, Y, Z,
+        F1 = 0x70,
+        F2, F3, F4, F5, F6, F7, F8, F9, F10, F11, F12,
+    };
+
+    enum class MouseButton : u8
+    {
+        Left,
+        Right,
+        Middle,
+        Back,
+        Forward,
+        Count,
+    };
+
+    enum class GamepadButton : u8
+    {
+        A,
+        B,
+        X,
+        Y,
+        LeftShoulder,
+        RightShoulder,
+        Back,
+        Start,
+        LeftThumb,
+        RightThumb,
+        DPadUp,
+        DPadDown,
+        DPadLeft,
+        DPadRight,
+        Count,
+    };
+
+    enum class GamepadAxis : u8
+    {
+        LeftX,
+        LeftY,
+        RightX,
+        RightY,
+        LeftTrigger,
+        RightTrigger,
+        Count,
+    };
+
+    constexpr u32 KeyCount = 256;
+    constexpr u32 MaxGamepadCount = 4;
+
+    enum class EventType : u8
+    {
+        Key,
+        MouseMove,
+        MouseButton,
+        MouseWheel,
+        GamepadButton,
+        GamepadAxis,
+    };
+
+    // Input event as collected by platform, kept small so many fit into a cache line.
+    // Keys and buttons store pressed state in x, mouse move stores cursor position
+    // in x and y, mouse wheel stores its delta in x, and gamepad axis uses value.
+    struct Event
+    {
+        u64 tick = 0; // Time::GetCurrentTick() when event was collected
+        EventType type = EventType::Key;
+        u8 device = 0; // Gamepad index
+        u16 code = 0; // Key, button or axis
+        i32 x = 0;
+        i32 y = 0;
+        f32 value = 0.0f;
+    };
+
+    static_assert(sizeof(Event) == 24);
+}
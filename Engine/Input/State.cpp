@@ -0,0 +1,104 @@
+#include "Shared.hpp"
+#include "Input/State.hpp"
+
+namespace
+{
+    // Updates down, pressed and released bits of a single key or button, where
+    // repeated press events of a key that is already held are not new presses.
+    template<typename BitType>
+    void ApplyButton(BitType& down, BitType& pressed, BitType& released, const BitType bit, const bool isPressed)
+    {
+        if(isPressed)
+        {
+            if(!(down & bit))
+            {
+                pressed |= bit;
+            }
+
+            down |= bit;
+        }
+        else if(down & bit)
+        {
+            released |= bit;
+            down &= ~bit;
+        }
+    }
+}
+
+void Input::State::BeginFrame()
+{
+    std::memset(m_keysPressed, 0, sizeof(m_keysPressed));
+    std::memset(m_keysReleased, 0, sizeof(m_keysReleased));
+
+    m_mouseDeltaX = 0;
+    m_mouseDeltaY = 0;
+    m_mouseWheel = 0;
+    m_mousePressed = 0;
+    m_mouseReleased = 0;
+
+    for(GamepadState& gamepad : m_gamepads)
+    {
+        gamepad.buttonsPressed = 0;
+        gamepad.buttonsReleased = 0;
+    }
+
+    m_eventCount = 0;
+}
+
+void Input::State::Apply(const Event& event)
+{
+    ++m_eventCount;
+
+    switch(event.type)
+    {
+    case EventType::Key:
+        if(event.code < KeyCount)
+        {
+            const u32 word = event.code / 64;
+            ApplyButton(m_keysDown[word], m_keysPressed[word], m_keysReleased[word],
+                1ull << (event.code % 64), event.x != 0);
+        }
+        break;
+
+    case EventType::MouseMove:
+        // First known position does not count as movement.
+        if(m_mousePositionKnown)
+        {
+            m_mouseDeltaX += event.x - m_mouseX;
+            m_mouseDeltaY += event.y - m_mouseY;
+        }
+
+        m_mouseX = event.x;
+        m_mouseY = event.y;
+        m_mousePositionKnown = true;
+        break;
+
+    case EventType::MouseButton:
+        if(event.code < static_cast<u32>(MouseButton::Count))
+        {
+            ApplyButton<u8>(m_mouseDown, m_mousePressed, m_mouseReleased,
+                static_cast<u8>(1u << event.code), event.x != 0);
+        }
+        break;
+
+    case EventType::MouseWheel:
+        m_mouseWheel += event.x;
+        break;
+
+    case EventType::GamepadButton:
+        if(event.device < MaxGamepadCount && event.code < static_cast<u32>(GamepadButton::Count))
+        {
+            GamepadState& gamepad = m_gamepads[event.device];
+            ApplyButton(gamepad.buttonsDown, gamepad.buttonsPressed, gamepad.buttonsReleased,
+                1u << event.code, event.x != 0);
+        }
+        break;
+
+    case EventType::GamepadAxis:
+        if(event.device < MaxGamepadCount && event.code < static_cast<u32>(GamepadAxis::Count))
+        {
+            m_gamepads[event.device].axes[event.code] = event.value;
+        }
+        break;
+    }
+}
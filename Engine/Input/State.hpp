@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Input/Events.hpp"
+
+namespace Input
+{
+    // Snapshot of input at the start of a frame, built from events collected since the previous
+    // frame. Keys and buttons are stored as bit sets, so whole state stays within a few cache lines
+    // and can be copied cheaply. Pressed and released bits only cover the latest frame, and both
+    // can be set for a key that was tapped within a single frame.
+    class State final
+    {
+        struct GamepadState
+        {
+            u32 buttonsDown = 0;
+            u32 buttonsPressed = 0;
+            u32 buttonsReleased = 0;
+            f32 axes[static_cast<u32>(GamepadAxis::Count)] = {};
+        };
+
+        static constexpr u32 KeyWordCount = KeyCount / 64;
+        u64 m_keysDown[KeyWordCount] = {};
+        u64 m_keysPressed[KeyWordCount] = {};
+        u64 m_keysReleased[KeyWordCount] = {};
+
+        i32 m_mouseX = 0;
+        i32 m_mouseY = 0;
+        i32 m_mouseDeltaX = 0;
+        i32 m_mouseDeltaY = 0;
+        i32 m_mouseWheel = 0;
+        u8 m_mouseDown = 0;
+        u8 m_mousePressed = 0;
+        u8 m_mouseReleased = 0;
+        bool m_mousePositionKnown = false;
+
+        GamepadState m_gamepads[MaxGamepadCount];
+
+        u32 m_eventCount = 0;
+
+    public:
+        State() = default;
+
+        // Clears everything that only lasts for a single frame.
+        void BeginFrame();
+        void Apply(const Event& event);
+
+        bool IsKeyDown(const Key key) const
+        {
+            return TestBit(m_keysDown, static_cast<u32>(key));
+        }
+
+        bool WasKeyPressed(const Key key) const
+        {
+            return TestBit(m_keysPressed, static_cast<u32>(key));
+        }
+
+        bool WasKeyReleased(const Key key) const
+        {
+            return TestBit(m_keysReleased, static_cast<u32>(key));
+        }
+
+        bool IsMouseButtonDown(const MouseButton button) const
+        {
+            return m_mouseDown & (1u << static_cast<u32>(button));
+        }
+
+        bool WasMouseButtonPressed(const MouseButton button) const
+        {
+            return m_mousePressed & (1u << static_cast<u32>(button));
+        }
+
+        bool WasMouseButtonReleased(const MouseButton button) const
+        {
+            return m_mouseReleased & (1u << static_cast<u32>(button));
+        }
+
+        i32 GetMouseX() const
+        {
+            return m_mouseX;
+        }
+
+        i32 GetMouseY() const
+        {
+            return m_mouseY;
+        }
+
+        i32 GetMouseDeltaX() const
+        {
+            return m_mouseDeltaX;
+        }
+
+        i32 GetMouseDeltaY() const
+        {
+            return m_mouseDeltaY;
+        }
+
+        i32 GetMouseWheel() const
+        {
+            return m_mouseWheel;
+        }
+
+        bool IsGamepadButtonDown(const u32 gamepad, const GamepadButton button) const
+        {
+            ASSERT(gamepad < MaxGamepadCount);
+            return m_gamepads[gamepad].buttonsDown & (1u << static_cast<u32>(button));
+        }
+
+        bool WasGamepadButtonPressed(const u32 gamepad, const GamepadButton button) const
+        {
+            ASSERT(gamepad < MaxGamepadCount);
+            return m_gamepads[gamepad].buttonsPressed & (1u << static_cast<u32>(button));
+        }
+
+        bool WasGamepadButtonReleased(const u32 gamepad, const GamepadButton button) const
+        {
+            ASSERT(gamepad < MaxGamepadCount);
+            return m_gamepads[gamepad].buttonsReleased & (1u << static_cast<u32>(button));
+        }
+
+        f32 GetGamepadAxis(const u32 gamepad, const GamepadAxis axis) const
+        {
+            ASSERT(gamepad < MaxGamepadCount);
+            return m_gamepads[gamepad].axes[static_cast<u32>(axis)];
+        }
+
+        // Number of events applied during the latest frame.
+        u32 GetEventCount() const
+        {
+            return m_eventCount;
+        }
+
+    private:
+        static bool TestBit(const u64* bits, const u32 index)
+        {
+            return bits[index / 64] & (1ull << (index % 64));
+        }
+    };
+}
@@ -0,0 +1,83 @@
+#include "Shared.hpp"
+#include "Input/System.hpp"
+
+Input::System::System()
+    : m_queue(QueueCapacity)
+{
+}
+
+bool Input::System::Push(const Event& event)
+{
+    if(!m_queue.Push(event))
+    {
+        m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    return true;
+}
+
+bool Input::System::PushKey(const u16 code, const bool pressed)
+{
+    Event event;
+    event.tick = Time::GetCurrentTick();
+    event.type = EventType::Key;
+    event.code = code;
+    event.x = pressed;
+    return Push(event);
+}
+
+bool Input::System::PushMouseMove(const i32 x, const i32 y)
+{
+    Event event;
+    event.tick = Time::GetCurrentTick();
+    event.type = EventType::MouseMove;
+    event.x = x;
+    event.y = y;
+    return Push(event);
+}
+
+bool Input::System::PushMouseButton(const MouseButton button, const bool pressed)
+{
+    Event event;
+    event.tick = Time::GetCurrentTick();
+    event.type = EventType::MouseButton;
+    event.code = static_cast<u16>(button);
+    event.x = pressed;
+    return Push(event);
+}
+
+bool Input::System::PushMouseWheel(const i32 delta)
+{
+    Event event;
+    event.tick = Time::GetCurrentTick();
+    event.type = EventType::MouseWheel;
+    event.x = delta;
+    return Push(event);
+}
+
+bool Input::System::PushGamepadButton(const u32 gamepad, const GamepadButton button, const bool pressed)
+{
+    ASSERT(gamepad < MaxGamepadCount);
+
+    Event event;
+    event.tick = Time::GetCurrentTick();
+    event.type = EventType::GamepadButton;
+    event.device = static_cast<u8>(gamepad);
+    event.code = static_cast<u16>(button);
+    event.x = pressed;
+    return Push(event);
+}
+
+bool Input::System::PushGamepadAxis(const u32 gamepad, const GamepadAxis axis, const f32 value)
+{
+    ASSERT(gamepad < MaxGamepadCount);
+
+    Event event;
+    event.tick = Time::GetCurrentTick();
+    event.type = EventType::GamepadAxis;
+    event.device = static_cast<u8>(gamepad);
+    event.code = static_cast<u16>(axis);
+    event.value = value;
+    return Push(event);
+}
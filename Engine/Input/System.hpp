@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Input/State.hpp"
+#include "Platform/Time.hpp"
+#include "Common/Containers/MpmcRingQueue.hpp"
+
+namespace Input
+{
+    // Collects input events from any number of threads into a lock-free queue, and drains
+    // them once per frame into input state snapshot. Platform backends push events as soon
+    // as they receive them, with timestamps taken at that point, and never call into game code.
+    // Events pushed while the queue is full are dropped and counted.
+    class System final : NonCopyable
+    {
+    public:
+        static constexpr u64 QueueCapacity = 1024;
+
+    private:
+        MpmcRingQueue<Event> m_queue;
+        State m_state;
+        std::atomic<u64> m_droppedCount = 0;
+        u64 m_latencyTicks = 0;
+
+    public:
+        System();
+
+        // Can be called from any thread. Event keeps its timestamp, which is useful for replays.
+        bool Push(const Event& event);
+
+        // Can be called from any thread. Events are timestamped with current tick.
+        bool PushKey(u16 code, bool pressed);
+        bool PushMouseMove(i32 x, i32 y);
+        bool PushMouseButton(MouseButton button, bool pressed);
+        bool PushMouseWheel(i32 delta);
+        bool PushGamepadButton(u32 gamepad, GamepadButton button, bool pressed);
+        bool PushGamepadAxis(u32 gamepad, GamepadAxis axis, f32 value);
+
+        // Must be called from a single thread once per frame, and calls function for every
+        // drained event in order they were collected, before it is applied to state. Drains at
+        // most one queue capacity of events, so producers pushing without pause cannot stall
+        // the frame. Remaining events are left for the next update.
+        template<typename Function>
+        void Update(const Function& function)
+        {
+            m_state.BeginFrame();
+
+            const u64 currentTick = Time::GetCurrentTick();
+            u64 oldestTick = currentTick;
+
+            Event events[64];
+            u64 count;
+            u64 remaining = QueueCapacity;
+            while(remaining > 0 && (count = m_queue.PopBatch(events, std::min<u64>(std::size(events), remaining))) > 0)
+            {
+                remaining -= count;
+                for(u64 i = 0; i < count; ++i)
+                {
+                    oldestTick = std::min(oldestTick, events[i].tick);
+                    function(events[i]);
+                    m_state.Apply(events[i]);
+                }
+            }
+
+            m_latencyTicks = currentTick - oldestTick;
+        }
+
+        void Update()
+        {
+            Update([](const Event&)
+            {
+            });
+        }
+
+        const State& GetState() const
+        {
+            return m_state;
+        }
+
+        u64 GetDroppedCount() const
+        {
+            return m_droppedCount.load(std::memory_order_relaxed);
+        }
+
+        // Time between collecting the oldest event and its consumption during the latest update.
+        f32 GetLatency() const
+        {
+            return Time::ConvertTicksToSeconds(m_latencyTicks);
+        }
+    };
+}
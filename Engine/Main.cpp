@@ -1,6 +1,7 @@
 #include "Shared.hpp"
 #include "Engine.hpp"
 #include "Application.hpp"
+#include "ConfigFile.hpp"
 #include "Platform/CommandLine.hpp"
 
 ExitCodes g_exitCode = ExitCodes::Success;
@@ -50,6 +51,28 @@ int main(const int argc, const char* const* argv)
 
     Config config = application->GetConfig();
 
+    // Parse command line arguments before logging anything, as they can change logger config.
+    auto& commandLine = Platform::CommandLine::Get();
+    commandLine.Parse(argc, argv);
+
+    // Load config file over application defaults.
+    if(Optional<StringView> configPath = commandLine.GetArgumentValue("Config"))
+    {
+        if(!ConfigFile::Load(configPath.GetValue(), config))
+        {
+            LOG_FATAL("Failed to load config file");
+            return -1;
+        }
+    }
+
+    if(auto result = ConfigFile::ApplyOverrides(commandLine, config); !result)
+    {
+        const ConfigFile::Error& error = result.GetFailure();
+        LOG_FATAL("Invalid command line config override: %s: %.*s",
+            error.message, STRING_VIEW_PRINTF_ARG(error.token));
+        return -1;
+    }
+
 #if ENABLE_LOGGER
     Logger::g_minimumSeverity = config.logger.minimumSeverity;
 #endif
@@ -66,7 +89,7 @@ int main(const int argc, const char* const* argv)
     LOG("Engine source path: %s", BuildInfo::EngineSourcePath);
     LOG("Platform: %s", PLATFORM_NAME);
 
-    // Parse command line arguments.
+    // Print command line arguments.
     HeapString commandLineRaw;
     for(int i = 0; i < argc; i++)
     {
@@ -75,9 +98,6 @@ int main(const int argc, const char* const* argv)
     }
 
     LOG_INFO("Process command line arguments:%s", *commandLineRaw);
-
-    auto& commandLine = Platform::CommandLine::Get();
-    commandLine.Parse(argc, argv);
     commandLine.Print();
 
     // Setup engine and run the application.
@@ -68,7 +68,21 @@ namespace Memory::Allocators
             {
                 ASSERT(m_pointer != nullptr);
                 ASSERT_SLOW(m_capacity != 0);
-                m_pointer = Memory::Reallocate<ElementType, Allocators::Default>(m_pointer, newCapacity, m_capacity);
+                ASSERT(usedCapacity <= m_capacity);
+
+                if constexpr(IsTriviallyRelocatable<ElementType>)
+                {
+                    // Reallocation copies memory as is, which is only valid for relocatable elements.
+                    m_pointer = Memory::Reallocate<ElementType, Allocators::Default>(m_pointer, newCapacity, m_capacity);
+                }
+                else
+                {
+                    ElementType* newPointer = Memory::Allocate<ElementType, Allocators::Default>(newCapacity);
+                    Memory::RelocateRange(newPointer, m_pointer, std::min(usedCapacity, newCapacity));
+                    Memory::Deallocate<ElementType, Allocators::Default>(m_pointer, m_capacity);
+                    m_pointer = newPointer;
+                }
+
                 ASSERT_SLOW(m_pointer != nullptr);
                 m_capacity = newCapacity;
             }
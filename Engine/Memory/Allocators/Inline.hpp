@@ -41,6 +41,10 @@ namespace Memory::Allocators
 
                 PrimaryAllocation& operator=(PrimaryAllocation&& other) noexcept
                 {
+                    // Inline storage is relocated with memcpy without knowing how many elements are used,
+                    // which is only valid for elements that do not need their move constructor called.
+                    static_assert(IsTriviallyRelocatable<ElementType>,
+                        "Inline allocation can only be moved with trivially relocatable elements");
                     std::memcpy(elements, other.elements, sizeof(ElementType) * ElementCount);
                     MarkUninitialized(other.elements, sizeof(ElementType) * ElementCount);
                     return *this;
@@ -112,14 +116,14 @@ namespace Memory::Allocators
                     else
                     {
                         // Grown inline to secondary
-                        ObjectStorage<ElementType> elements[ElementCount];
-                        std::memcpy(elements, primary.elements, sizeof(ElementType) * usedCapacity);
-
-                        auto& secondary = m_storage.template emplace<SecondaryAllocation>();
+                        SecondaryAllocation secondary;
                         secondary.Allocate(newCapacity);
 
                         ASSERT_SLOW(secondary.GetCapacity() >= ElementCount);
-                        std::memcpy(secondary.GetPointer(), elements, sizeof(ElementType) * usedCapacity);
+                        Memory::RelocateRange(secondary.GetPointer(),
+                            reinterpret_cast<ElementType*>(primary.elements), usedCapacity);
+
+                        m_storage.template emplace<SecondaryAllocation>(Move(secondary));
                     }
                 }
                 else
@@ -128,11 +132,11 @@ namespace Memory::Allocators
                     if(IsInlineCapacity(newCapacity))
                     {
                         // Shrink secondary to inline
-                        ObjectStorage<ElementType> elements[ElementCount];
-                        std::memcpy(elements, secondary.GetPointer(), sizeof(ElementType) * newCapacity);
-
+                        SecondaryAllocation previous = Move(secondary);
                         auto& primary = m_storage.template emplace<PrimaryAllocation>();
-                        std::memcpy(primary.elements, elements, sizeof(ElementType) * newCapacity);
+
+                        Memory::RelocateRange(reinterpret_cast<ElementType*>(primary.elements),
+                            previous.GetPointer(), std::min(usedCapacity, newCapacity));
                     }
                     else
                     {
@@ -13,6 +13,12 @@ namespace Memory
     constexpr u64 UnknownSize = 0;
     constexpr u64 UnknownAlignment = 0;
 
+    // Types that can be moved to another address with memcpy, without calling move constructor and destructor.
+    // Trivially copyable types qualify by default, while other types opt in via specialization.
+    // Types storing pointers to themselves or registering their address elsewhere must not opt in.
+    template<typename Type>
+    constexpr bool IsTriviallyRelocatable = std::is_trivially_copyable_v<Type>;
+
     template<typename Type, typename Allocator = Allocators::Default>
     Type* Allocate(const u64 count = 1)
     {
@@ -86,6 +92,50 @@ namespace Memory
         }
     }
 
+    template<typename Type>
+    void RelocateRange(Type* destination, Type* source, const u64 count)
+    {
+        // Moves objects into destination and leaves source destructed.
+        // Ranges are allowed to overlap, which is useful for shifting elements in place.
+        if(destination == source || count == 0)
+            return;
+
+        ASSERT(destination != nullptr);
+        ASSERT(source != nullptr);
+
+        if constexpr(IsTriviallyRelocatable<Type>)
+        {
+            std::memmove(static_cast<void*>(destination), static_cast<const void*>(source), sizeof(Type) * count);
+        }
+        else if(destination < source)
+        {
+            for(u64 i = 0; i < count; ++i)
+            {
+                new (destination + i) Type(Move(source[i]));
+                source[i].~Type();
+            }
+        }
+        else
+        {
+            for(u64 i = count; i-- > 0;)
+            {
+                new (destination + i) Type(Move(source[i]));
+                source[i].~Type();
+            }
+        }
+
+        if(destination < source)
+        {
+            Type* vacatedBegin = std::max(source, destination + count);
+            MarkDestructed(vacatedBegin, sizeof(Type) * (source + count - vacatedBegin));
+        }
+        else
+        {
+            Type* vacatedEnd = std::min(destination, source + count);
+            MarkDestructed(source, sizeof(Type) * (vacatedEnd - source));
+        }
+    }
+
     template<typename Type>
     void Destruct(Type* object)
     {
@@ -130,6 +180,32 @@ namespace Memory
         }
     }
 
+    // Array is default constructed, which leaves trivial types uninitialized unless arguments are given.
+    template<typename Type, typename Allocator = Allocators::Default, typename... Arguments>
+    Type* NewArray(const u64 count, const Arguments&... arguments)
+    {
+        if(count == 0)
+            return nullptr;
+
+        Type* objects = Allocate<Type, Allocator>(count);
+        if constexpr(sizeof...(Arguments) > 0 || !std::is_trivially_default_constructible_v<Type>)
+        {
+            ConstructRange<Type>(objects, objects + count, arguments...);
+        }
+
+        return objects;
+    }
+
+    template<typename Type, typename Allocator = Allocators::Default>
+    void DeleteArray(Type* objects, const u64 count)
+    {
+        if(objects)
+        {
+            DestructRange<Type>(objects, objects + count);
+            Deallocate<Type, Allocator>(objects, count);
+        }
+    }
+
     using VoidDeleter = void(*)(void*);
 
     template<typename Type, typename Allocator>
@@ -148,4 +224,20 @@ namespace Memory
             return *this;
         }
     };
+
+    // Array elements cannot be deleted through pointer to base type, as their size would differ.
+    template<typename Type, typename Allocator>
+    struct ArrayAllocationDeleter
+    {
+        void operator()(Type* objects, const u64 count)
+        {
+            DeleteArray<Type, Allocator>(objects, count);
+        }
+    };
+
+    template<typename Type, typename Allocator = Allocators::Default>
+    using DefaultDeleter = std::conditional_t<std::is_void_v<Type>, VoidDeleter,
+        std::conditional_t<std::is_unbounded_array_v<Type>,
+            ArrayAllocationDeleter<std::remove_extent_t<Type>, Allocator>,
+            AllocationDeleter<Type, Allocator>>>;
 }
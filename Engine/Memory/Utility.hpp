@@ -9,6 +9,9 @@ namespace Memory
     constexpr u8 DestructedPattern = 0xDE;
     constexpr u8 FreedPattern = 0xFE;
 
+    // Separating data written by different threads by this many bytes avoids false sharing.
+    constexpr u64 CacheLineSize = 64;
+
     inline void MarkUninitialized(void* memory, const u64 size)
     {
     #if ENABLE_MEMORY_FILL
@@ -0,0 +1,272 @@
+#include "Shared.hpp"
+#include "Platform/AsyncIO.hpp"
+#include "Platform/Config.hpp"
+
+Platform::AsyncFile::~AsyncFile()
+{
+    Close();
+}
+
+Platform::AsyncFile::AsyncFile(AsyncFile&& other) noexcept
+{
+    *this = Move(other);
+}
+
+Platform::AsyncFile& Platform::AsyncFile::operator=(AsyncFile&& other) noexcept
+{
+    ASSERT_SLOW(this != &other);
+    Close();
+
+    m_handle = other.m_handle;
+    other.m_handle = -1;
+    return *this;
+}
+
+Platform::AsyncIO::~AsyncIO()
+{
+    if(!m_setup)
+        return;
+
+    LOG_DEBUG("Destroying async IO...");
+
+    // Requests already submitted are finished before exiting.
+    m_detail.Shutdown();
+
+    {
+        Thread::ScopedLock lock(m_queueMutex);
+        m_exiting = true;
+    }
+
+    m_queueCondition.NotifyAll();
+    for(Thread::Handle& worker : m_workers)
+    {
+        worker.Join();
+    }
+
+    ASSERT(m_completedQueue.head == nullptr, "Async IO destroyed with undispatched completion callbacks");
+}
+
+bool Platform::AsyncIO::Setup(const AsyncIOConfig& config)
+{
+    ASSERT(!m_setup);
+    LOG_DEBUG("Setting up async IO...");
+
+    if(config.allowKernelQueue && m_detail.Setup(this, config.queueDepth))
+    {
+        LOG_INFO("Using kernel queue for async IO with %u queue depth", config.queueDepth);
+    }
+    else if(config.workerCount > 0)
+    {
+        Thread::Config workerConfig;
+        workerConfig.name = "AsyncIO Worker";
+
+        m_workers.Reserve(config.workerCount);
+        for(u32 i = 0; i < config.workerCount; ++i)
+        {
+            m_workers.Add(Thread::Create(workerConfig, [this]()
+            {
+                WorkerThread();
+            }));
+        }
+
+        LOG_INFO("Using %u worker thread(s) for async IO", config.workerCount);
+    }
+    else
+    {
+        LOG_INFO("Using submitting thread for async IO");
+    }
+
+    LOG_SUCCESS("Async IO setup complete");
+    return m_setup = true;
+}
+
+void Platform::AsyncIO::Submit(AsyncIORequest& request)
+{
+    AsyncIORequest* requests[] = { &request };
+    Submit(requests, 1);
+}
+
+void Platform::AsyncIO::Submit(AsyncIORequest* const* requests, const u64 count)
+{
+    ASSERT(m_setup);
+    if(count == 0)
+        return;
+
+    {
+        Thread::ScopedLock lock(m_queueMutex);
+        ASSERT(!m_exiting);
+
+        for(u64 i = 0; i < count; ++i)
+        {
+            AsyncIORequest* request = requests[i];
+            ASSERT(request != nullptr);
+            ASSERT(!request->IsPending(), "Request is already in flight");
+            ASSERT(request->file != nullptr && request->file->IsOpen());
+            ASSERT(request->buffer != nullptr || request->size == 0);
+            ASSERT(request->priority < AsyncIOPriority::Count);
+
+            request->m_transferred = 0;
+            request->m_status.store(AsyncIOStatus::Pending, std::memory_order_relaxed);
+            PushPending(request);
+        }
+
+        if(m_detail.IsSetup())
+        {
+            m_detail.Flush();
+        }
+    }
+
+    if(!m_detail.IsSetup() && m_workers.IsEmpty())
+    {
+        // Queue is only drained here, so requests are still executed in order of priority.
+        while(true)
+        {
+            AsyncIORequest* request;
+            {
+                Thread::ScopedLock lock(m_queueMutex);
+                request = PopPending();
+            }
+
+            if(request == nullptr)
+                break;
+
+            Execute(request);
+        }
+    }
+    else if(count == 1)
+    {
+        m_queueCondition.NotifyOne();
+    }
+    else
+    {
+        m_queueCondition.NotifyAll();
+    }
+}
+
+void Platform::AsyncIO::Wait(const AsyncIORequest& request)
+{
+    ASSERT(m_setup);
+
+    Thread::ScopedLock lock(m_completionMutex);
+    m_completionCondition.Wait(m_completionMutex, [&request]()
+    {
+        return !request.IsPending();
+    });
+}
+
+u64 Platform::AsyncIO::ProcessCompletions()
+{
+    AsyncIORequest* request;
+    {
+        Thread::ScopedLock lock(m_completionMutex);
+        request = m_completedQueue.head;
+        m_completedQueue = {};
+    }
+
+    // Callbacks are allowed to submit the same request again.
+    u64 count = 0;
+    while(request != nullptr)
+    {
+        AsyncIORequest* next = request->m_next;
+        request->m_next = nullptr;
+        request->callback(*request);
+        request = next;
+        ++count;
+    }
+
+    return count;
+}
+
+void Platform::AsyncIO::PushPending(AsyncIORequest* request)
+{
+    RequestQueue& queue = m_pendingQueues[static_cast<u8>(request->priority)];
+    request->m_next = nullptr;
+
+    if(queue.tail != nullptr)
+    {
+        queue.tail->m_next = request;
+    }
+    else
+    {
+        queue.head = request;
+    }
+
+    queue.tail = request;
+}
+
+Platform::AsyncIORequest* Platform::AsyncIO::PopPending()
+{
+    for(u8 priority = static_cast<u8>(AsyncIOPriority::Count); priority-- > 0;)
+    {
+        RequestQueue& queue = m_pendingQueues[priority];
+        if(AsyncIORequest* request = queue.head)
+        {
+            queue.head = request->m_next;
+            if(queue.head == nullptr)
+            {
+                queue.tail = nullptr;
+            }
+
+            request->m_next = nullptr;
+            return request;
+        }
+    }
+
+    return nullptr;
+}
+
+void Platform::AsyncIO::Complete(AsyncIORequest* request, const AsyncIOStatus status, const u64 transferred)
+{
+    request->m_transferred = transferred;
+
+    {
+        // Request may be destroyed by its owner as soon as status is stored,
+        // so it must not be accessed afterwards unless callback is pending.
+        Thread::ScopedLock lock(m_completionMutex);
+        if(request->callback)
+        {
+            if(m_completedQueue.tail != nullptr)
+            {
+                m_completedQueue.tail->m_next = request;
+            }
+            else
+            {
+                m_completedQueue.head = request;
+            }
+
+            m_completedQueue.tail = request;
+        }
+
+        request->m_status.store(status, std::memory_order_release);
+    }
+
+    m_completionCondition.NotifyAll();
+}
+
+void Platform::AsyncIO::Execute(AsyncIORequest* request)
+{
+    u64 transferred = 0;
+    const bool success = Detail::ExecuteRequest(*request, transferred);
+    Complete(request, success ? AsyncIOStatus::Completed : AsyncIOStatus::Failed, transferred);
+}
+
+void Platform::AsyncIO::WorkerThread()
+{
+    while(true)
+    {
+        AsyncIORequest* request;
+        {
+            Thread::ScopedLock lock(m_queueMutex);
+            m_queueCondition.Wait(m_queueMutex, [this, &request]()
+            {
+                request = PopPending();
+                return request != nullptr || m_exiting;
+            });
+
+            if(request == nullptr)
+                break;
+        }
+
+        Execute(request);
+    }
+}
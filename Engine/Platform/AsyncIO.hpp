@@ -0,0 +1,168 @@
+#pragma once
+
+#if defined(PLATFORM_WINDOWS)
+    #include "Windows/AsyncIO.hpp"
+#elif defined(PLATFORM_LINUX)
+    #include "Linux/AsyncIO.hpp"
+#else
+    #error "Unknown platform"
+#endif
+
+namespace Platform
+{
+    struct AsyncIOConfig;
+
+    enum class AsyncIOOperation : u8
+    {
+        Read,
+        Write,
+    };
+
+    enum class AsyncIOPriority : u8
+    {
+        Low,
+        Normal,
+        High,
+        Count,
+    };
+
+    enum class AsyncIOStatus : u8
+    {
+        Idle,
+        Pending,
+        Completed,
+        Failed,
+    };
+
+    // File opened for reads and writes at explicit offsets,
+    // which allows multiple requests to be in flight at once.
+    class AsyncFile final : NonCopyable
+    {
+        i64 m_handle = -1;
+
+    public:
+        AsyncFile() = default;
+        ~AsyncFile();
+
+        AsyncFile(AsyncFile&& other) noexcept;
+        AsyncFile& operator=(AsyncFile&& other) noexcept;
+
+        // Write access creates the file or truncates existing contents.
+        bool Open(const StringView& filePath, AsyncIOOperation access);
+        void Close();
+
+        u64 GetSize() const;
+
+        i64 GetHandle() const
+        {
+            return m_handle;
+        }
+
+        bool IsOpen() const
+        {
+            return m_handle != -1;
+        }
+    };
+
+    // Request is owned by the caller and must outlive its completion,
+    // including the callback dispatch if one has been provided.
+    class AsyncIORequest final : NonCopyable
+    {
+        friend class AsyncIO;
+        friend class Detail::AsyncIO;
+
+        std::atomic<AsyncIOStatus> m_status = AsyncIOStatus::Idle;
+        u64 m_transferred = 0;
+        AsyncIORequest* m_next = nullptr;
+
+    public:
+        // Callback is invoked on the thread calling AsyncIO::ProcessCompletions().
+        using CompletionCallback = Function<void(AsyncIORequest&)>;
+
+        const AsyncFile* file = nullptr;
+        void* buffer = nullptr;
+        u64 offset = 0;
+        u64 size = 0;
+        AsyncIOOperation operation = AsyncIOOperation::Read;
+        AsyncIOPriority priority = AsyncIOPriority::Normal;
+        CompletionCallback callback;
+
+        AsyncIOStatus GetStatus() const
+        {
+            return m_status.load(std::memory_order_acquire);
+        }
+
+        // Can be less than requested size when reading past the end of file.
+        u64 GetTransferredBytes() const
+        {
+            ASSERT(!IsPending());
+            return m_transferred;
+        }
+
+        bool IsPending() const
+        {
+            return GetStatus() == AsyncIOStatus::Pending;
+        }
+
+        bool IsSucceeded() const
+        {
+            return GetStatus() == AsyncIOStatus::Completed;
+        }
+    };
+
+    // Executes file reads and writes in the background. Requests are
+    // executed by kernel submission queue when available on the platform
+    // (io_uring on Linux), or by a pool of worker threads otherwise.
+    // Without kernel queue and workers, requests are executed right away
+    // on the submitting thread, still completing through the same path.
+    // Higher priority requests are always dispatched before lower ones.
+    class AsyncIO final : NonCopyable
+    {
+        Detail::AsyncIO m_detail;
+
+        struct RequestQueue
+        {
+            AsyncIORequest* head = nullptr;
+            AsyncIORequest* tail = nullptr;
+        };
+
+        Thread::Mutex m_queueMutex;
+        Thread::ConditionVariable m_queueCondition;
+        RequestQueue m_pendingQueues[static_cast<u8>(AsyncIOPriority::Count)];
+        HeapArray<Thread::Handle> m_workers;
+        bool m_exiting = false;
+
+        Thread::Mutex m_completionMutex;
+        Thread::ConditionVariable m_completionCondition;
+        RequestQueue m_completedQueue;
+
+        bool m_setup = false;
+
+    public:
+        AsyncIO() = default;
+        ~AsyncIO();
+
+        bool Setup(const AsyncIOConfig& config);
+
+        // Requests in one batch are queued with a single lock and kernel submission.
+        void Submit(AsyncIORequest& request);
+        void Submit(AsyncIORequest* const* requests, u64 count);
+
+        void Wait(const AsyncIORequest& request);
+        u64 ProcessCompletions();
+
+        bool IsUsingKernelQueue() const
+        {
+            return m_detail.IsSetup();
+        }
+
+    private:
+        friend class Detail::AsyncIO;
+
+        void PushPending(AsyncIORequest* request);
+        AsyncIORequest* PopPending();
+        void Complete(AsyncIORequest* request, AsyncIOStatus status, u64 transferred);
+        void Execute(AsyncIORequest* request);
+        void WorkerThread();
+    };
+}
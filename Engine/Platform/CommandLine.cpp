@@ -1,5 +1,6 @@
 #include "Shared.hpp"
 #include "CommandLine.hpp"
+#include "Common/Utility/NumberConversion.hpp"
 
 void Platform::CommandLine::Parse(const u32 argc, const char* const* argv)
 {
@@ -54,6 +55,60 @@ void Platform::CommandLine::Parse(const u32 argc, const char* const* argv)
             });
         }
     }
+
+    BuildIndex();
+}
+
+void Platform::CommandLine::BuildIndex()
+{
+    // Keeps table at most half full, so probe sequences stay short.
+    const u64 slotCount = NextPow2(m_arguments.GetSize() * 2);
+    const u64 slotMask = slotCount - 1;
+
+    m_index.Clear();
+    m_index.Resize(slotCount);
+    for(u64 i = 0; i < m_arguments.GetSize(); ++i)
+    {
+        const Argument& argument = m_arguments[i];
+        if(!argument.name)
+            continue;
+
+        const StringView& name = argument.name.GetValue();
+        const u64 hash = Hash::Fnv1a64(name.GetData(), name.GetLength());
+        for(u64 slot = hash & slotMask;; slot = (slot + 1) & slotMask)
+        {
+            IndexSlot& indexSlot = m_index[slot];
+            if(indexSlot.argumentIndex == InvalidIndex)
+            {
+                indexSlot.nameHash = hash;
+                indexSlot.argumentIndex = static_cast<u32>(i);
+                break;
+            }
+
+            // Earlier occurrence of the same name takes precedence.
+            if(indexSlot.nameHash == hash && *m_arguments[indexSlot.argumentIndex].name == name)
+                break;
+        }
+    }
+}
+
+const Platform::CommandLine::Argument* Platform::CommandLine::FindArgument(const StringView& argumentName) const
+{
+    if(m_index.IsEmpty())
+        return nullptr;
+
+    const u64 slotMask = m_index.GetSize() - 1;
+    const u64 hash = Hash::Fnv1a64(argumentName.GetData(), argumentName.GetLength());
+    for(u64 slot = hash & slotMask;; slot = (slot + 1) & slotMask)
+    {
+        const IndexSlot& indexSlot = m_index[slot];
+        if(indexSlot.argumentIndex == InvalidIndex)
+            return nullptr;
+
+        const Argument& argument = m_arguments[indexSlot.argumentIndex];
+        if(indexSlot.nameHash == hash && *argument.name == argumentName)
+            return &argument;
+    }
 }
 
 void Platform::CommandLine::Print() const
@@ -67,17 +122,17 @@ void Platform::CommandLine::Print() const
 
         if(!name.HasValue())
         {
-            LOG("  %u: %.*s", index,
+            LOG("  %llu: %.*s", index,
                 STRING_VIEW_PRINTF_ARG(value.GetValue()));
         }
         else if(!value.HasValue())
         {
-            LOG("  %u: -%.*s", index,
-                STRING_VIEW_PRINTF_ARG(value.GetValue()));
+            LOG("  %llu: -%.*s", index,
+                STRING_VIEW_PRINTF_ARG(name.GetValue()));
         }
         else
         {
-            LOG("  %u: -%.*s=\"%.*s\"", index,
+            LOG("  %llu: -%.*s=\"%.*s\"", index,
                 STRING_VIEW_PRINTF_ARG(name.GetValue()),
                 STRING_VIEW_PRINTF_ARG(value.GetValue()));
         }
@@ -88,18 +143,115 @@ void Platform::CommandLine::Print() const
 
 bool Platform::CommandLine::HasArgument(const StringView& argumentName) const
 {
-    return m_arguments.ContainsPredicate([&argumentName](const Argument& argument)
-    {
-        return argument.name ? *argument.name == argumentName : false;
-    });
+    return FindArgument(argumentName) != nullptr;
 }
 
 Optional<StringView> Platform::CommandLine::GetArgumentValue(const StringView& argumentName) const
 {
-    const Argument* argument = m_arguments.FindPredicate([&argumentName](const Argument& argument)
+    const Argument* argument = FindArgument(argumentName);
+    return argument ? argument->value : Optional<StringView>();
+}
+
+Result<i64, Platform::CommandLine::ArgumentError> Platform::CommandLine::GetInt(const StringView& argumentName) const
+{
+    using ResultType = Result<i64, ArgumentError>;
+
+    const Argument* argument = FindArgument(argumentName);
+    if(argument == nullptr)
+        return ResultType::Failure(ArgumentError::Missing);
+
+    if(!argument->value)
+        return ResultType::Failure(ArgumentError::MissingValue);
+
+    Optional<i64> value = NumberConversion::ParseInt(argument->value.GetValue());
+    if(!value)
+        return ResultType::Failure(ArgumentError::InvalidValue);
+
+    return ResultType::Success(Move(value.GetValue()));
+}
+
+Result<f64, Platform::CommandLine::ArgumentError> Platform::CommandLine::GetFloat(const StringView& argumentName) const
+{
+    using ResultType = Result<f64, ArgumentError>;
+
+    const Argument* argument = FindArgument(argumentName);
+    if(argument == nullptr)
+        return ResultType::Failure(ArgumentError::Missing);
+
+    if(!argument->value)
+        return ResultType::Failure(ArgumentError::MissingValue);
+
+    Optional<f64> value = NumberConversion::ParseFloat(argument->value.GetValue());
+    if(!value)
+        return ResultType::Failure(ArgumentError::InvalidValue);
+
+    return ResultType::Success(Move(value.GetValue()));
+}
+
+Result<bool, Platform::CommandLine::ArgumentError> Platform::CommandLine::GetBool(const StringView& argumentName) const
+{
+    using ResultType = Result<bool, ArgumentError>;
+
+    const Argument* argument = FindArgument(argumentName);
+    if(argument == nullptr)
+        return ResultType::Failure(ArgumentError::Missing);
+
+    if(!argument->value)
+        return ResultType::Success(true);
+
+    const StringView& value = argument->value.GetValue();
+    if(value == "true" || value == "1")
+        return ResultType::Success(true);
+
+    if(value == "false" || value == "0")
+        return ResultType::Success(false);
+
+    return ResultType::Failure(ArgumentError::InvalidValue);
+}
+
+Result<HeapArray<StringView>, Platform::CommandLine::ArgumentError> Platform::CommandLine::GetList(const StringView& argumentName) const
+{
+    using ResultType = Result<HeapArray<StringView>, ArgumentError>;
+
+    const Argument* argument = FindArgument(argumentName);
+    if(argument == nullptr)
+        return ResultType::Failure(ArgumentError::Missing);
+
+    if(!argument->value)
+        return ResultType::Failure(ArgumentError::MissingValue);
+
+    HeapArray<StringView> values;
+    const StringView& value = argument->value.GetValue();
+    if(value.IsEmpty())
+        return ResultType::Success(Move(values));
+
+    const char* current = value.GetBeginPtr();
+    const char* end = value.GetEndPtr();
+    while(true)
     {
-        return argument.name ? *argument.name == argumentName : false;
-    });
+        const char* separator = current;
+        while(separator != end && *separator != ',')
+            ++separator;
 
-    return argument ? argument->value : Optional<StringView>();
+        values.Add(StringView(current, separator - current));
+        if(separator == end)
+            break;
+
+        current = separator + 1;
+    }
+
+    return ResultType::Success(Move(values));
+}
+
+const char* Platform::ArgumentErrorToString(const CommandLine::ArgumentError error)
+{
+    switch(error)
+    {
+        case CommandLine::ArgumentError::Missing:      return "Missing";
+        case CommandLine::ArgumentError::MissingValue: return "MissingValue";
+        case CommandLine::ArgumentError::InvalidValue: return "InvalidValue";
+    }
+
+    ASSERT(false, "Unknown argument error");
+    return "Unknown";
 }
@@ -4,15 +4,36 @@
 
 namespace Platform
 {
+    // Arguments are parsed once into name and value views of process arguments, with
+    // named arguments indexed by hash of their name, so lookups do not scan all arguments.
+    // When the same name is passed more than once, only its first occurrence is found.
     class CommandLine final : public Singleton<CommandLine>
     {
+    public:
+        enum class ArgumentError : u8
+        {
+            Missing,      // Argument was not passed
+            MissingValue, // Argument was passed as flag without value
+            InvalidValue, // Value could not be parsed as requested type
+        };
+
+    private:
+        static constexpr u32 InvalidIndex = std::numeric_limits<u32>::max();
+
         struct Argument
         {
             Optional<StringView> name;
             Optional<StringView> value;
         };
 
+        struct IndexSlot
+        {
+            u64 nameHash = 0;
+            u32 argumentIndex = InvalidIndex;
+        };
+
         Array<Argument> m_arguments;
+        Array<IndexSlot> m_index; // Open addressing with linear probing and power of two size
 
     public:
         void Parse(u32 argc, const char* const* argv);
@@ -20,5 +41,19 @@ namespace Platform
 
         bool HasArgument(const StringView& argumentName) const;
         Optional<StringView> GetArgumentValue(const StringView& argumentName) const;
+
+        // Typed getters fail for missing argument or value, except boolean flag passed without
+        // value, which is true. Integers are decimal with optional sign and booleans are either
+        // true, false, 1 or 0. Lists are comma separated values that point into arguments.
+        Result<i64, ArgumentError> GetInt(const StringView& argumentName) const;
+        Result<f64, ArgumentError> GetFloat(const StringView& argumentName) const;
+        Result<bool, ArgumentError> GetBool(const StringView& argumentName) const;
+        Result<HeapArray<StringView>, ArgumentError> GetList(const StringView& argumentName) const;
+
+    private:
+        void BuildIndex();
+        const Argument* FindArgument(const StringView& argumentName) const;
     };
+
+    const char* ArgumentErrorToString(CommandLine::ArgumentError error);
 }
@@ -6,5 +6,17 @@ namespace Platform
     {
         u32 width = 1280;
         u32 height = 720;
+
+        // Window events played back from script file, see WindowEventScript for its format.
+        // Fixed time step advances playback by that many seconds every frame, while zero follows real time.
+        String eventScriptPath;
+        f32 eventTimeStep = 0.0f;
+    };
+
+    struct AsyncIOConfig
+    {
+        u32 workerCount = 2; // Used when kernel queue is not available, zero executes on submitting thread
+        u32 queueDepth = 64; // Maximum number of requests in flight in kernel queue
+        bool allowKernelQueue = true;
     };
 }
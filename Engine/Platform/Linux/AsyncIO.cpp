@@ -0,0 +1,361 @@
+#include "Shared.hpp"
+#include "Platform/AsyncIO.hpp"
+
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+
+namespace
+{
+    // Entry with zero user data is never a request and is used to wake up the reaper thread on exit.
+    constexpr u64 ExitUserData = 0;
+
+    // Largest transfer done by kernel in one read or write, so larger requests are split into chunks.
+    constexpr u32 MaxEntrySize = 0x7FFFF000;
+
+    int SetupRing(const u32 entries, io_uring_params& params)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    }
+
+    int EnterRing(const int ring, const u32 submitCount, const u32 waitCount, const u32 flags)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_enter, ring, submitCount, waitCount, flags, nullptr, 0));
+    }
+}
+
+bool Platform::AsyncFile::Open(const StringView& filePath, const AsyncIOOperation access)
+{
+    Close();
+
+    const int flags = access == AsyncIOOperation::Read ?
+        O_RDONLY | O_CLOEXEC : O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+
+    const int file = open(*filePath, flags, 0644);
+    if(file < 0)
+    {
+        LOG_ERROR("Failed to open file for async access: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    m_handle = file;
+    return true;
+}
+
+void Platform::AsyncFile::Close()
+{
+    if(m_handle != -1)
+    {
+        close(static_cast<int>(m_handle));
+        m_handle = -1;
+    }
+}
+
+u64 Platform::AsyncFile::GetSize() const
+{
+    ASSERT(IsOpen());
+
+    struct stat stats;
+    if(fstat(static_cast<int>(m_handle), &stats) != 0)
+        return 0;
+
+    return static_cast<u64>(stats.st_size);
+}
+
+Platform::Detail::AsyncIO::~AsyncIO()
+{
+    Shutdown();
+}
+
+bool Platform::Detail::AsyncIO::Setup(Platform::AsyncIO* owner, const u32 queueDepth)
+{
+    ASSERT(owner != nullptr);
+    ASSERT(!IsSetup());
+
+    io_uring_params params = {};
+    const int ring = SetupRing(std::max(1u, queueDepth), params);
+    if(ring < 0)
+    {
+        LOG_DEBUG("Kernel queue is not available (error %i)", errno);
+        return false;
+    }
+
+    // Read and write opcodes were introduced in the same kernel version as current position feature.
+    const u32 requiredFeatures = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_RW_CUR_POS;
+    if((params.features & requiredFeatures) != requiredFeatures)
+    {
+        LOG_DEBUG("Kernel queue is missing required features");
+        close(ring);
+        return false;
+    }
+
+    // Submission and completion rings share one mapping with single mapping feature.
+    const u64 submitRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+    const u64 completeRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const u64 ringMemorySize = std::max(submitRingSize, completeRingSize);
+    void* ringMemory = mmap(nullptr, ringMemorySize, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQ_RING);
+    if(ringMemory == MAP_FAILED)
+    {
+        LOG_ERROR("Failed to map kernel queue rings");
+        close(ring);
+        return false;
+    }
+
+    const u64 submitEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* submitEntries = mmap(nullptr, submitEntriesSize, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQES);
+    if(submitEntries == MAP_FAILED)
+    {
+        LOG_ERROR("Failed to map kernel queue entries");
+        munmap(ringMemory, ringMemorySize);
+        close(ring);
+        return false;
+    }
+
+    u8* ringBytes = static_cast<u8*>(ringMemory);
+    m_submitHead = reinterpret_cast<u32*>(ringBytes + params.sq_off.head);
+    m_submitTail = reinterpret_cast<u32*>(ringBytes + params.sq_off.tail);
+    m_submitArray = reinterpret_cast<u32*>(ringBytes + params.sq_off.array);
+    m_submitMask = *reinterpret_cast<u32*>(ringBytes + params.sq_off.ring_mask);
+    m_completeHead = reinterpret_cast<u32*>(ringBytes + params.cq_off.head);
+    m_completeTail = reinterpret_cast<u32*>(ringBytes + params.cq_off.tail);
+    m_completeEntries = ringBytes + params.cq_off.cqes;
+    m_completeMask = *reinterpret_cast<u32*>(ringBytes + params.cq_off.ring_mask);
+
+    // Requests in flight are limited by submission queue size, so completion
+    // queue that is at least as large as that can never overflow.
+    m_submitCapacity = params.sq_entries;
+    ASSERT(params.cq_entries >= params.sq_entries);
+
+    m_owner = owner;
+    m_ring = ring;
+    m_ringMemory = ringMemory;
+    m_ringMemorySize = ringMemorySize;
+    m_submitEntries = submitEntries;
+    m_submitEntriesSize = submitEntriesSize;
+    Thread::Config reaperConfig;
+    reaperConfig.name = "AsyncIO Reaper";
+    m_reaper = Thread::Create(reaperConfig, [this]()
+    {
+        ReaperThread();
+    });
+
+    return true;
+}
+
+void Platform::Detail::AsyncIO::Shutdown()
+{
+    if(!IsSetup())
+        return;
+
+    {
+        // Pending requests are always flushed while there is space for them,
+        // so all of them have been submitted once nothing is in flight.
+        Thread::ScopedLock lock(m_owner->m_queueMutex);
+        m_owner->m_queueCondition.Wait(m_owner->m_queueMutex, [this]()
+        {
+            return m_inFlight == 0;
+        });
+
+        PushEntry(IORING_OP_NOP, -1, 0, nullptr, 0, ExitUserData);
+        SubmitEntries();
+    }
+
+    m_reaper.Join();
+
+    munmap(m_submitEntries, m_submitEntriesSize);
+    munmap(m_ringMemory, m_ringMemorySize);
+    close(m_ring);
+
+    m_ring = -1;
+    m_ringMemory = nullptr;
+    m_submitEntries = nullptr;
+    m_owner = nullptr;
+}
+
+void Platform::Detail::AsyncIO::Flush()
+{
+    ASSERT(IsSetup());
+
+    while(m_inFlight < m_submitCapacity)
+    {
+        AsyncIORequest* request = m_owner->PopPending();
+        if(request == nullptr)
+            break;
+
+        PushRequest(request);
+        ++m_inFlight;
+    }
+
+    SubmitEntries();
+}
+
+void Platform::Detail::AsyncIO::PushRequest(AsyncIORequest* request)
+{
+    // Only part of request that has not been transferred yet is pushed.
+    const u64 transferred = request->m_transferred;
+    const u32 size = static_cast<u32>(std::min<u64>(request->size - transferred, MaxEntrySize));
+    const u8 opcode = request->operation == AsyncIOOperation::Read ? IORING_OP_READ : IORING_OP_WRITE;
+    PushEntry(opcode, static_cast<i32>(request->file->GetHandle()), request->offset + transferred,
+        static_cast<u8*>(request->buffer) + transferred, size, reinterpret_cast<u64>(request));
+}
+
+void Platform::Detail::AsyncIO::PushEntry(const u8 opcode, const i32 file, const u64 offset,
+    void* buffer, const u32 size, const u64 userData)
+{
+    // Submission tail is only written by this side, while kernel reads it.
+    const u32 tail = *m_submitTail;
+    const u32 index = tail & m_submitMask;
+
+    io_uring_sqe& entry = static_cast<io_uring_sqe*>(m_submitEntries)[index];
+    std::memset(&entry, 0, sizeof(entry));
+    entry.opcode = opcode;
+    entry.fd = file;
+    entry.off = offset;
+    entry.addr = reinterpret_cast<u64>(buffer);
+    entry.len = size;
+    entry.user_data = userData;
+
+    m_submitArray[index] = index;
+    std::atomic_ref(*m_submitTail).store(tail + 1, std::memory_order_release);
+}
+
+void Platform::Detail::AsyncIO::SubmitEntries()
+{
+    // Entries not consumed by previous submission are retried together with new ones.
+    const u32 head = std::atomic_ref(*m_submitHead).load(std::memory_order_acquire);
+    const u32 tail = *m_submitTail;
+    if(head == tail)
+        return;
+
+    while(EnterRing(m_ring, tail - head, 0, 0) < 0)
+    {
+        if(errno == EINTR || errno == EAGAIN || errno == EBUSY)
+            continue;
+
+        LOG_ERROR("Failed to submit kernel queue entries (error %i)", errno);
+
+        // Entries refused by kernel will never complete, so their requests fail right away
+        // and are taken out of submission queue, which kernel only reads when entered.
+        const io_uring_sqe* entries = static_cast<const io_uring_sqe*>(m_submitEntries);
+        for(u32 index = head; index != tail; ++index)
+        {
+            const u64 userData = entries[index & m_submitMask].user_data;
+            if(userData == ExitUserData)
+                continue;
+
+            AsyncIORequest* request = reinterpret_cast<AsyncIORequest*>(userData);
+            m_owner->Complete(request, AsyncIOStatus::Failed, request->m_transferred);
+            --m_inFlight;
+        }
+
+        std::atomic_ref(*m_submitTail).store(head, std::memory_order_release);
+        break;
+    }
+}
+
+void Platform::Detail::AsyncIO::ReaperThread()
+{
+    io_uring_cqe* entries = static_cast<io_uring_cqe*>(m_completeEntries);
+
+    bool exiting = false;
+    while(!exiting)
+    {
+        if(EnterRing(m_ring, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+        {
+            LOG_ERROR("Failed to wait for kernel queue completions (error %i)", errno);
+            Thread::Sleep(1);
+        }
+
+        u32 head = *m_completeHead;
+        const u32 tail = std::atomic_ref(*m_completeTail).load(std::memory_order_acquire);
+
+        u32 completedCount = 0;
+        AsyncIORequest* resubmitHead = nullptr;
+        for(; head != tail; ++head)
+        {
+            const io_uring_cqe& entry = entries[head & m_completeMask];
+            if(entry.user_data == ExitUserData)
+            {
+                exiting = true;
+                continue;
+            }
+
+            // Short transfers are continued from where they stopped, same as synchronous execution.
+            // Zero bytes transferred means end of file was reached, which is not an error.
+            AsyncIORequest* request = reinterpret_cast<AsyncIORequest*>(entry.user_data);
+            bool resubmit = entry.res == -EINTR || entry.res == -EAGAIN;
+            if(entry.res > 0)
+            {
+                request->m_transferred += static_cast<u64>(entry.res);
+                resubmit = request->m_transferred < request->size;
+            }
+
+            if(resubmit)
+            {
+                request->m_next = resubmitHead;
+                resubmitHead = request;
+                continue;
+            }
+
+            m_owner->Complete(request, entry.res >= 0 ? AsyncIOStatus::Completed : AsyncIOStatus::Failed,
+                request->m_transferred);
+
+            ++completedCount;
+        }
+
+        std::atomic_ref(*m_completeHead).store(head, std::memory_order_release);
+
+        if(completedCount > 0 || resubmitHead != nullptr)
+        {
+            {
+                // Resubmitted requests remain in flight and take precedence over pending ones.
+                Thread::ScopedLock lock(m_owner->m_queueMutex);
+                while(resubmitHead != nullptr)
+                {
+                    AsyncIORequest* request = resubmitHead;
+                    resubmitHead = request->m_next;
+                    request->m_next = nullptr;
+                    PushRequest(request);
+                }
+
+                m_inFlight -= completedCount;
+                Flush();
+            }
+
+            m_owner->m_queueCondition.NotifyAll();
+        }
+    }
+}
+
+bool Platform::Detail::ExecuteRequest(const AsyncIORequest& request, u64& transferred)
+{
+    const int file = static_cast<int>(request.file->GetHandle());
+    u8* buffer = static_cast<u8*>(request.buffer);
+
+    transferred = 0;
+    while(transferred < request.size)
+    {
+        const u64 remaining = request.size - transferred;
+        const off_t offset = static_cast<off_t>(request.offset + transferred);
+        const ssize_t result = request.operation == AsyncIOOperation::Read ?
+            pread(file, buffer + transferred, remaining, offset) :
+            pwrite(file, buffer + transferred, remaining, offset);
+
+        if(result < 0)
+        {
+            if(errno == EINTR)
+                continue;
+
+            return false;
+        }
+
+        // Reading past end of file is not an error and results in fewer bytes transferred.
+        if(result == 0)
+            break;
+
+        transferred += static_cast<u64>(result);
+    }
+
+    return true;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+namespace Platform
+{
+    class AsyncIO;
+    class AsyncIORequest;
+}
+
+namespace Platform::Detail
+{
+    // Kernel submission queue backed by io_uring, which executes requests
+    // without dedicated worker threads. Setup fails on kernels where
+    // io_uring is missing or disabled, in which case workers are used.
+    class AsyncIO final : NonCopyable
+    {
+        Platform::AsyncIO* m_owner = nullptr;
+        int m_ring = -1;
+
+        void* m_ringMemory = nullptr;
+        u64 m_ringMemorySize = 0;
+        void* m_submitEntries = nullptr;
+        u64 m_submitEntriesSize = 0;
+
+        u32* m_submitHead = nullptr;
+        u32* m_submitTail = nullptr;
+        u32* m_submitArray = nullptr;
+        u32 m_submitMask = 0;
+        u32 m_submitCapacity = 0;
+
+        u32* m_completeHead = nullptr;
+        u32* m_completeTail = nullptr;
+        void* m_completeEntries = nullptr;
+        u32 m_completeMask = 0;
+
+        u32 m_inFlight = 0;
+        Thread::Handle m_reaper;
+
+    public:
+        AsyncIO() = default;
+        ~AsyncIO();
+
+        bool Setup(Platform::AsyncIO* owner, u32 queueDepth);
+        void Shutdown();
+
+        // Moves pending requests into submission queue, must be called with owner queue lock held.
+        void Flush();
+
+        bool IsSetup() const
+        {
+            return m_ring != -1;
+        }
+
+    private:
+        void PushRequest(AsyncIORequest* request);
+        void PushEntry(u8 opcode, i32 file, u64 offset, void* buffer, u32 size, u64 userData);
+        void SubmitEntries();
+        void ReaperThread();
+    };
+
+    bool ExecuteRequest(const AsyncIORequest& request, u64& transferred);
+}
@@ -0,0 +1,82 @@
+#include "Shared.hpp"
+#include "Platform/MappedFile.hpp"
+
+bool Platform::MappedFile::Open(const StringView& filePath)
+{
+    Close();
+
+    const int file = open(*filePath, O_RDONLY | O_CLOEXEC);
+    if(file < 0)
+    {
+        LOG_ERROR("Failed to open file for mapping: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    SCOPE_GUARD
+    {
+        // Mapping remains valid after file descriptor is closed.
+        close(file);
+    };
+
+    struct stat stats;
+    if(fstat(file, &stats) != 0)
+    {
+        LOG_ERROR("Failed to query file stats: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    // Regular files with known size are mapped, while pipes and special files
+    // (e.g. from procfs that report zero size) are streamed in chunks instead.
+    if(S_ISREG(stats.st_mode) && stats.st_size > 0)
+    {
+        const u64 size = static_cast<u64>(stats.st_size);
+        void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        if(mapping != MAP_FAILED)
+        {
+            // Hint that contents will be read front to back soon, so kernel can read ahead aggressively.
+            madvise(mapping, size, MADV_SEQUENTIAL);
+            madvise(mapping, size, MADV_WILLNEED);
+
+            m_data = static_cast<const u8*>(mapping);
+            m_size = size;
+            m_mapped = true;
+            m_open = true;
+            return true;
+        }
+
+        LOG_WARNING("Failed to map file, falling back to streaming: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+    }
+
+    while(true)
+    {
+        u8* chunk = m_buffer.AddUninitialized(StreamChunkSize);
+        const ssize_t result = read(file, chunk, StreamChunkSize);
+        if(result < 0)
+        {
+            if(errno == EINTR)
+            {
+                m_buffer.Resize(m_buffer.GetSize() - StreamChunkSize);
+                continue;
+            }
+
+            LOG_ERROR("Failed to stream file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+            m_buffer = {};
+            return false;
+        }
+
+        m_buffer.Resize(m_buffer.GetSize() - StreamChunkSize + static_cast<u64>(result));
+        if(result == 0)
+            break;
+    }
+
+    m_data = m_buffer.GetData();
+    m_size = m_buffer.GetSize();
+    m_open = true;
+    return true;
+}
+
+void Platform::MappedFile::Unmap()
+{
+    ASSERT(m_mapped);
+    ASSERT_EVALUATE(munmap(const_cast<u8*>(m_data), m_size) == 0);
+}
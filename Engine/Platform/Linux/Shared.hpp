@@ -2,3 +2,5 @@
 
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <unistd.h>
@@ -0,0 +1,33 @@
+#include "Shared.hpp"
+#include "Platform/Synchronization.hpp"
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <limits>
+
+namespace
+{
+    // Atomic is layout compatible with its underlying type, which is what futex operates on.
+    static_assert(sizeof(std::atomic<u32>) == sizeof(u32));
+
+    long Futex(std::atomic<u32>& address, const int operation, const u32 value)
+    {
+        return syscall(SYS_futex, reinterpret_cast<u32*>(&address), operation | FUTEX_PRIVATE_FLAG, value, nullptr, nullptr, 0);
+    }
+}
+
+void Thread::Detail::WaitOnAddress(std::atomic<u32>& address, const u32 expected)
+{
+    // Interruptions and changed value are both reported as errors, which callers handle as spurious wake up.
+    Futex(address, FUTEX_WAIT, expected);
+}
+
+void Thread::Detail::WakeOne(std::atomic<u32>& address)
+{
+    Futex(address, FUTEX_WAKE, 1);
+}
+
+void Thread::Detail::WakeAll(std::atomic<u32>& address)
+{
+    Futex(address, FUTEX_WAKE, std::numeric_limits<i32>::max());
+}
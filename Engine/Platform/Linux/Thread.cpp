@@ -1,6 +1,74 @@
 #include "Shared.hpp"
 #include "Platform/Thread.hpp"
 
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+
+namespace
+{
+    // Linux limits thread names to 16 bytes including null terminator.
+    constexpr u64 MaxThreadNameLength = 15;
+
+    // Context is allocated by creating thread and owned by the new thread once
+    // created, so creating thread does not have to wait for it to start running.
+    struct ThreadStartContext
+    {
+        Function<void()> function;
+        char name[MaxThreadNameLength + 1] = {};
+        u64 affinityMask = 0;
+        Thread::Priority priority = Thread::Priority::Normal;
+    };
+
+    void ApplyThreadConfig(const ThreadStartContext& context)
+    {
+        if(context.name[0] != '\0')
+        {
+            pthread_setname_np(pthread_self(), context.name);
+        }
+
+        if(context.affinityMask != 0)
+        {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            for(u32 cpu = 0; cpu < 64; ++cpu)
+            {
+                if(context.affinityMask & (1ull << cpu))
+                {
+                    CPU_SET(cpu, &cpuSet);
+                }
+            }
+
+            if(pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) != 0)
+            {
+                LOG_WARNING("Failed to set affinity mask 0x%llx for thread \"%s\"", context.affinityMask, context.name);
+            }
+        }
+
+        // Threads with normal scheduling policy are prioritized by per thread nice value.
+        if(context.priority != Thread::Priority::Normal)
+        {
+            const int niceValue = context.priority == Thread::Priority::High ? -5 : 5;
+            if(setpriority(PRIO_PROCESS, static_cast<id_t>(gettid()), niceValue) != 0)
+            {
+                LOG_DEBUG("Thread \"%s\" priority could not be changed (error %i)", context.name, errno);
+            }
+        }
+    }
+
+    void* ThreadStart(void* argument)
+    {
+        UniquePtr<ThreadStartContext> context(static_cast<ThreadStartContext*>(argument));
+        ApplyThreadConfig(*context);
+
+        Function<void()> function = Move(context->function);
+        context.Reset();
+
+        function();
+        return nullptr;
+    }
+}
+
 void Thread::Sleep(const u64 milliseconds)
 {
     usleep(milliseconds * 1000);
@@ -8,10 +76,51 @@ void Thread::Sleep(const u64 milliseconds)
 
 void Thread::Pause()
 {
-    pause();
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
 }
 
 void Thread::Yield()
 {
     sched_yield();
 }
+
+void Thread::Handle::Join()
+{
+    ASSERT(m_joinable);
+    ASSERT_EVALUATE(pthread_join(static_cast<pthread_t>(m_handle), nullptr) == 0);
+    m_joinable = false;
+}
+
+Thread::Handle Thread::Create(const Config& config, Function<void()>&& function)
+{
+    ASSERT(function);
+
+    UniquePtr<ThreadStartContext> context(Memory::New<ThreadStartContext>());
+    context->function = Move(function);
+    context->affinityMask = config.affinityMask;
+    context->priority = config.priority;
+
+    const u64 nameLength = std::min(config.name.GetLength(), MaxThreadNameLength);
+    if(nameLength > 0)
+    {
+        std::memcpy(context->name, config.name.GetData(), nameLength);
+    }
+
+    pthread_t thread;
+    if(pthread_create(&thread, nullptr, &ThreadStart, context.Get()) != 0)
+    {
+        LOG_ERROR("Failed to create thread \"%s\"", context->name);
+        return {};
+    }
+
+    context.Detach();
+
+    Handle handle;
+    handle.m_handle = static_cast<u64>(thread);
+    handle.m_joinable = true;
+    return handle;
+}
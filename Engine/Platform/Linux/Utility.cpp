@@ -0,0 +1,201 @@
+#include "Shared.hpp"
+#include "Platform/Utility.hpp"
+
+#include <sys/uio.h>
+
+namespace
+{
+    bool WriteStringBuilderChunks(const int file, const StringBuilder& builder)
+    {
+        // Chunks are gathered in batches and written with a single vectored
+        // call per batch, without concatenating them into one buffer first.
+        constexpr u32 BatchSize = 64;
+        iovec vectors[BatchSize];
+        u32 vectorCount = 0;
+        bool success = true;
+
+        auto flushVectors = [&]()
+        {
+            iovec* pending = vectors;
+            u32 pendingCount = vectorCount;
+            vectorCount = 0;
+
+            while(success && pendingCount > 0)
+            {
+                ssize_t written = writev(file, pending, static_cast<int>(pendingCount));
+                if(written < 0)
+                {
+                    if(errno == EINTR)
+                        continue;
+
+                    success = false;
+                    break;
+                }
+
+                // Skip vectors that have been fully written and adjust partially written one.
+                while(pendingCount > 0 && static_cast<u64>(written) >= pending->iov_len)
+                {
+                    written -= static_cast<ssize_t>(pending->iov_len);
+                    ++pending;
+                    --pendingCount;
+                }
+
+                if(pendingCount > 0)
+                {
+                    pending->iov_base = static_cast<u8*>(pending->iov_base) + written;
+                    pending->iov_len -= static_cast<u64>(written);
+                }
+            }
+        };
+
+        builder.ForEachChunk([&](const StringView& chunk)
+        {
+            vectors[vectorCount++] = { const_cast<char*>(chunk.GetData()), chunk.GetLength() };
+            if(vectorCount == BatchSize)
+            {
+                flushVectors();
+            }
+        });
+
+        flushVectors();
+        return success;
+    }
+}
+
+u32 Platform::GetProcessId()
+{
+    return static_cast<u32>(getpid());
+}
+
+bool Platform::WriteStringToFileSynced(const StringView& filePath, const StringView& contents)
+{
+    const int file = open(*filePath, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if(file < 0)
+    {
+        LOG_ERROR("Failed to open file for writing: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    bool success = false;
+    SCOPE_GUARD
+    {
+        close(file);
+        if(!success)
+        {
+            unlink(*filePath);
+        }
+    };
+
+    const char* data = contents.GetData();
+    u64 remaining = contents.GetLength();
+    while(remaining > 0)
+    {
+        const ssize_t written = write(file, data, remaining);
+        if(written < 0)
+        {
+            if(errno == EINTR)
+                continue;
+
+            LOG_ERROR("Failed to write file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+            return false;
+        }
+
+        data += written;
+        remaining -= static_cast<u64>(written);
+    }
+
+    if(fsync(file) != 0)
+    {
+        LOG_ERROR("Failed to flush file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    success = true;
+    return true;
+}
+
+bool Platform::ReplaceFileAtomic(const StringView& sourcePath, const StringView& destinationPath)
+{
+    if(rename(*sourcePath, *destinationPath) != 0)
+    {
+        LOG_ERROR("Failed to replace file: %.*s", STRING_VIEW_PRINTF_ARG(destinationPath));
+        return false;
+    }
+
+    // Renamed directory entry is only durable once its parent directory is flushed.
+    u64 separatorIndex = destinationPath.GetLength();
+    while(separatorIndex > 0 && destinationPath[separatorIndex - 1] != '/')
+    {
+        --separatorIndex;
+    }
+
+    const auto directoryPath = separatorIndex == 0 ? InlineString<256>(".") :
+        InlineString<256>(destinationPath.SubString(0, std::max(separatorIndex - 1, 1ull)));
+
+    const int directory = open(*directoryPath, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(directory >= 0)
+    {
+        fsync(directory);
+        close(directory);
+    }
+
+    return true;
+}
+
+bool Platform::WriteStringBuilderToFileSynced(const StringView& filePath, const StringBuilder& builder)
+{
+    const int file = open(*filePath, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if(file < 0)
+    {
+        LOG_ERROR("Failed to open file for writing: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    bool success = false;
+    SCOPE_GUARD
+    {
+        close(file);
+        if(!success)
+        {
+            unlink(*filePath);
+        }
+    };
+
+    if(!WriteStringBuilderChunks(file, builder))
+    {
+        LOG_ERROR("Failed to write file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    if(fsync(file) != 0)
+    {
+        LOG_ERROR("Failed to flush file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    success = true;
+    return true;
+}
+
+bool WriteStringBuilderToFile(const StringView& filePath, const StringBuilder& builder)
+{
+    const int file = open(*filePath, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if(file < 0)
+    {
+        LOG_ERROR("Failed to open file for writing: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    SCOPE_GUARD
+    {
+        close(file);
+    };
+
+    if(!WriteStringBuilderChunks(file, builder))
+    {
+        LOG_ERROR("Failed to write file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,45 @@
+#include "Shared.hpp"
+#include "Platform/MappedFile.hpp"
+
+Platform::MappedFile::~MappedFile()
+{
+    Close();
+}
+
+Platform::MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    *this = Move(other);
+}
+
+Platform::MappedFile& Platform::MappedFile::operator=(MappedFile&& other) noexcept
+{
+    ASSERT_SLOW(this != &other);
+    Close();
+
+    // Heap buffer keeps its address when moved, so streamed data pointer remains valid.
+    m_data = other.m_data;
+    m_size = other.m_size;
+    m_mapped = other.m_mapped;
+    m_open = other.m_open;
+    m_buffer = Move(other.m_buffer);
+
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_mapped = false;
+    other.m_open = false;
+    return *this;
+}
+
+void Platform::MappedFile::Close()
+{
+    if(m_mapped)
+    {
+        Unmap();
+    }
+
+    m_buffer = {};
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+    m_open = false;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+namespace Platform
+{
+    // Read-only view of file contents mapped directly into memory.
+    // Files that cannot be mapped (e.g. pipes or special files without
+    // known size) are streamed into a heap buffer as a fallback.
+    class MappedFile final : NonCopyable
+    {
+        const u8* m_data = nullptr;
+        u64 m_size = 0;
+        bool m_mapped = false;
+        bool m_open = false;
+        HeapArray<u8> m_buffer;
+
+    public:
+        static constexpr u64 StreamChunkSize = 64 * 1024;
+
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        bool Open(const StringView& filePath);
+        void Close();
+
+        const u8* GetData() const
+        {
+            return m_data;
+        }
+
+        u64 GetSize() const
+        {
+            return m_size;
+        }
+
+        StringView GetStringView() const
+        {
+            if(m_data == nullptr)
+                return {};
+
+            return { reinterpret_cast<const char*>(m_data), m_size };
+        }
+
+        bool IsOpen() const
+        {
+            return m_open;
+        }
+
+        bool IsMapped() const
+        {
+            return m_mapped;
+        }
+
+    private:
+        void Unmap();
+    };
+}
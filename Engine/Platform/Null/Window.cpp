@@ -3,10 +3,18 @@
 
 void Platform::Detail::Window::SetOnCloseEvent(OnWindowCloseFunction&& function)
 {
+    // Headless window can only be closed by scripted events handled by platform window.
+}
+
+void Platform::Detail::Window::SetInputSystem(Input::System* input)
+{
+    // Headless window has no input of its own, other than scripted events.
 }
 
 bool Platform::Detail::Window::Setup(const StringView& title, u32& width, u32& height)
 {
+    m_width = width;
+    m_height = height;
     return true;
 }
 
@@ -14,18 +22,23 @@ void Platform::Detail::Window::ProcessEvents()
 {
 }
 
-void Platform::Detail::Window::SetSize(u32 width, u32 height)
+void Platform::Detail::Window::SetSize(const u32 width, const u32 height)
 {
+    m_width = width;
+    m_height = height;
 }
 
 void Platform::Detail::Window::SetTitle(const StringView& title)
 {
 }
 
-void Platform::Detail::Window::SetVisibility(bool visible)
+void Platform::Detail::Window::SetVisibility(const bool visible)
 {
+    m_visible = visible;
 }
 
 void Platform::Detail::Window::GetSize(u32& width, u32& height)
 {
+    width = m_width;
+    height = m_height;
 }
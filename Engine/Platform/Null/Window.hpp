@@ -2,15 +2,28 @@
 
 #include "Platform/WindowEvents.hpp"
 
+namespace Input
+{
+    class System;
+}
+
 namespace Platform::Detail
 {
+    // Headless window that has no system window and only keeps size of offscreen framebuffer.
+    // Size changes are applied immediately and picked up by the next processing of events,
+    // the same way as system window resizes are, so resize handling runs without display.
     class Window
     {
+        u32 m_width = 0;
+        u32 m_height = 0;
+        bool m_visible = false;
+
     public:
         Window() = default;
         ~Window() = default;
 
         void SetOnCloseEvent(OnWindowCloseFunction&& function);
+        void SetInputSystem(Input::System* input);
         bool Setup(const StringView& title, u32& width, u32& height);
 
         void ProcessEvents();
@@ -19,5 +32,10 @@ namespace Platform::Detail
         void SetVisibility(bool visible);
 
         void GetSize(u32& width, u32& height);
+
+        bool IsVisible() const
+        {
+            return m_visible;
+        }
     };
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#define ENABLE_THREAD_STATS !CONFIG_RELEASE // Track contention of synchronization primitives in non-Release builds
+
 #if defined(PLATFORM_WINDOWS)
     #define PLATFORM_NAME "Windows"
     #include "Windows/Shared.hpp"
@@ -0,0 +1,235 @@
+#include "Shared.hpp"
+#include "Platform/Synchronization.hpp"
+#include "Platform/ThreadStats.hpp"
+
+void Thread::Mutex::LockContended()
+{
+#if ENABLE_THREAD_STATS
+    m_contentionCount.fetch_add(1, std::memory_order_relaxed);
+    Stats::Get().OnMutexContended();
+#endif
+
+    // Locks are usually held briefly, so spinning for a while
+    // is cheaper than going to sleep and being woken up again.
+    for(u32 i = 0; i < SpinCount; ++i)
+    {
+        u32 state = m_state.load(std::memory_order_relaxed);
+        if(state == Unlocked)
+        {
+            if(m_state.compare_exchange_weak(state, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+                return;
+        }
+        else if(state == LockedWithWaiters)
+        {
+            // Other threads are already sleeping, so there is no point in spinning.
+            break;
+        }
+
+        Pause();
+    }
+
+    LockAsWaiter();
+}
+
+void Thread::Mutex::LockAsWaiter()
+{
+    // Lock is acquired with waiters state, because this thread cannot know
+    // whether other threads are still sleeping, which is resolved by one
+    // unnecessary wake up at worst.
+    while(m_state.exchange(LockedWithWaiters, std::memory_order_acquire) != Unlocked)
+    {
+    #if ENABLE_THREAD_STATS
+        Stats::Get().OnMutexSleep();
+    #endif
+
+        Detail::WaitOnAddress(m_state, LockedWithWaiters);
+    }
+}
+
+void Thread::ConditionVariable::Wait(Mutex& mutex)
+{
+    // Sequence is read while mutex is held, so notification issued
+    // after releasing it changes the sequence and prevents sleeping.
+    m_waiterCount.fetch_add(1);
+    const u32 sequence = m_sequence.load(std::memory_order_relaxed);
+    mutex.Unlock();
+
+#if ENABLE_THREAD_STATS
+    Stats::Get().OnConditionSleep();
+#endif
+
+    Detail::WaitOnAddress(m_sequence, sequence);
+    m_waiterCount.fetch_sub(1, std::memory_order_relaxed);
+
+    // Other threads may have been woken up together with this one.
+    mutex.LockAsWaiter();
+}
+
+void Thread::ConditionVariable::NotifyOne()
+{
+    m_sequence.fetch_add(1);
+    if(m_waiterCount.load() > 0)
+    {
+        Detail::WakeOne(m_sequence);
+    }
+}
+
+void Thread::ConditionVariable::NotifyAll()
+{
+    m_sequence.fetch_add(1);
+    if(m_waiterCount.load() > 0)
+    {
+        Detail::WakeAll(m_sequence);
+    }
+}
+
+bool Thread::Semaphore::TryAcquire()
+{
+    // Sequentially consistent load pairs with waiter count in Release().
+    u32 count = m_count.load();
+    while(count > 0)
+    {
+        if(m_count.compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed))
+            return true;
+    }
+
+    return false;
+}
+
+void Thread::Semaphore::Acquire()
+{
+    for(u32 i = 0; i < SpinCount; ++i)
+    {
+        if(TryAcquire())
+            return;
+
+        Pause();
+    }
+
+    // Releasing thread either observes this waiter or this
+    // waiter observes count incremented by releasing thread.
+    m_waiterCount.fetch_add(1);
+    while(!TryAcquire())
+    {
+    #if ENABLE_THREAD_STATS
+        Stats::Get().OnSemaphoreSleep();
+    #endif
+
+        Detail::WaitOnAddress(m_count, 0);
+    }
+
+    m_waiterCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void Thread::Semaphore::Release(const u32 count)
+{
+    ASSERT(count > 0);
+    m_count.fetch_add(count);
+
+    if(m_waiterCount.load() > 0)
+    {
+        if(count == 1)
+        {
+            Detail::WakeOne(m_count);
+        }
+        else
+        {
+            Detail::WakeAll(m_count);
+        }
+    }
+}
+
+void Thread::Event::Signal()
+{
+    if(m_state.exchange(Signaled, std::memory_order_release) == UnsignaledWithWaiters)
+    {
+        if(m_manualReset)
+        {
+            Detail::WakeAll(m_state);
+        }
+        else
+        {
+            Detail::WakeOne(m_state);
+        }
+    }
+}
+
+void Thread::Event::Reset()
+{
+    u32 expected = Signaled;
+    m_state.compare_exchange_strong(expected, Unsignaled, std::memory_order_relaxed);
+}
+
+void Thread::Event::Wait()
+{
+    bool slept = false;
+    u32 state = m_state.load(std::memory_order_acquire);
+    while(true)
+    {
+        if(state == Signaled)
+        {
+            if(m_manualReset)
+                return;
+
+            // Woken thread cannot know whether other threads are still sleeping,
+            // so it keeps waiters state for next signal to wake one of them.
+            const u32 resetState = slept ? UnsignaledWithWaiters : Unsignaled;
+            if(m_state.compare_exchange_weak(state, resetState, std::memory_order_acquire, std::memory_order_acquire))
+                return;
+
+            continue;
+        }
+
+        if(state == Unsignaled && !m_state.compare_exchange_weak(state, UnsignaledWithWaiters,
+            std::memory_order_acquire, std::memory_order_acquire))
+        {
+            continue;
+        }
+
+    #if ENABLE_THREAD_STATS
+        Stats::Get().OnEventSleep();
+    #endif
+
+        Detail::WaitOnAddress(m_state, UnsignaledWithWaiters);
+        state = m_state.load(std::memory_order_acquire);
+        slept = true;
+    }
+}
+
+void Thread::SpinLock::LockContended()
+{
+#if ENABLE_THREAD_STATS
+    m_contentionCount.fetch_add(1, std::memory_order_relaxed);
+    Stats::Get().OnSpinLockContended();
+#endif
+
+    u32 backoff = 1;
+    while(true)
+    {
+        // Waiting with plain loads keeps cache line shared until lock is released.
+        while(m_locked.load(std::memory_order_relaxed))
+        {
+            if(backoff < MaxBackoff)
+            {
+                for(u32 i = 0; i < backoff; ++i)
+                {
+                    Pause();
+                }
+
+                backoff *= 2;
+            }
+            else
+            {
+                // Lock holder is likely not running, so give it a chance to finish.
+            #if ENABLE_THREAD_STATS
+                Stats::Get().OnSpinLockYield();
+            #endif
+
+                Yield();
+            }
+        }
+
+        if(!m_locked.exchange(true, std::memory_order_acquire))
+            return;
+    }
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+// Synchronization primitives built on top of waiting on an address (futex on Linux,
+// WaitOnAddress on Windows). Uncontended paths are a single atomic operation without
+// a system call, and threads only sleep in the kernel after briefly spinning.
+// Contended paths are counted in Thread::Stats when thread stats are enabled.
+namespace Thread
+{
+    namespace Detail
+    {
+        // Sleeps while value at address equals expected value. May return spuriously.
+        void WaitOnAddress(std::atomic<u32>& address, u32 expected);
+        void WakeOne(std::atomic<u32>& address);
+        void WakeAll(std::atomic<u32>& address);
+    }
+
+    // Number of pause iterations to spin before sleeping on contended primitive.
+    constexpr u32 SpinCount = 100;
+
+    class Mutex final : NonCopyable
+    {
+        friend class ConditionVariable;
+
+        enum State : u32
+        {
+            Unlocked,
+            Locked,
+            LockedWithWaiters,
+        };
+
+        std::atomic<u32> m_state = Unlocked;
+
+    #if ENABLE_THREAD_STATS
+        std::atomic<u32> m_contentionCount = 0;
+    #endif
+
+    public:
+        Mutex() = default;
+
+        void Lock()
+        {
+            u32 expected = Unlocked;
+            if(!m_state.compare_exchange_strong(expected, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                LockContended();
+            }
+        }
+
+        bool TryLock()
+        {
+            u32 expected = Unlocked;
+            return m_state.compare_exchange_strong(expected, Locked, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+        void Unlock()
+        {
+            if(m_state.exchange(Unlocked, std::memory_order_release) == LockedWithWaiters)
+            {
+                Detail::WakeOne(m_state);
+            }
+        }
+
+        // Number of times lock was already held when attempting to acquire it.
+        u32 GetContentionCount() const
+        {
+        #if ENABLE_THREAD_STATS
+            return m_contentionCount.load(std::memory_order_relaxed);
+        #else
+            return 0;
+        #endif
+        }
+
+    private:
+        void LockContended();
+        void LockAsWaiter();
+    };
+
+    // Waiting releases the mutex and reacquires it before returning.
+    // Waiting can return spuriously, so condition must be checked in a loop
+    // or predicate version of the wait should be used instead.
+    class ConditionVariable final : NonCopyable
+    {
+        std::atomic<u32> m_sequence = 0;
+        std::atomic<u32> m_waiterCount = 0;
+
+    public:
+        ConditionVariable() = default;
+
+        void Wait(Mutex& mutex);
+
+        template<typename Predicate>
+        void Wait(Mutex& mutex, Predicate&& predicate)
+        {
+            while(!predicate())
+            {
+                Wait(mutex);
+            }
+        }
+
+        void NotifyOne();
+        void NotifyAll();
+    };
+
+    // Counting semaphore where acquiring blocks while count is zero.
+    class Semaphore final : NonCopyable
+    {
+        std::atomic<u32> m_count = 0;
+        std::atomic<u32> m_waiterCount = 0;
+
+    public:
+        explicit Semaphore(const u32 initialCount = 0)
+            : m_count(initialCount)
+        {
+        }
+
+        void Acquire();
+        bool TryAcquire();
+        void Release(u32 count = 1);
+
+        u32 GetCount() const
+        {
+            return m_count.load(std::memory_order_relaxed);
+        }
+    };
+
+    // Event that threads can wait on until it is signaled. Manual reset event stays
+    // signaled and releases all waiters until reset, while automatic reset event
+    // releases a single waiter and returns to unsignaled state.
+    class Event final : NonCopyable
+    {
+        enum State : u32
+        {
+            Unsignaled,
+            Signaled,
+            UnsignaledWithWaiters,
+        };
+
+        std::atomic<u32> m_state = Unsignaled;
+        bool m_manualReset = false;
+
+    public:
+        explicit Event(const bool manualReset = false, const bool signaled = false)
+            : m_state(signaled ? Signaled : Unsignaled)
+            , m_manualReset(manualReset)
+        {
+        }
+
+        void Signal();
+        void Reset();
+        void Wait();
+
+        bool IsSignaled() const
+        {
+            return m_state.load(std::memory_order_acquire) == Signaled;
+        }
+    };
+
+    // Lock that never sleeps in the kernel, meant for very short critical sections.
+    // Contended lock spins with exponentially growing pause backoff, and adaptively
+    // starts yielding to other threads once backoff reaches its maximum.
+    class SpinLock final : NonCopyable
+    {
+        std::atomic<bool> m_locked = false;
+
+    #if ENABLE_THREAD_STATS
+        std::atomic<u32> m_contentionCount = 0;
+    #endif
+
+    public:
+        static constexpr u32 MaxBackoff = 64;
+
+        SpinLock() = default;
+
+        void Lock()
+        {
+            if(m_locked.exchange(true, std::memory_order_acquire))
+            {
+                LockContended();
+            }
+        }
+
+        bool TryLock()
+        {
+            return !m_locked.load(std::memory_order_relaxed) &&
+                !m_locked.exchange(true, std::memory_order_acquire);
+        }
+
+        void Unlock()
+        {
+            m_locked.store(false, std::memory_order_release);
+        }
+
+        u32 GetContentionCount() const
+        {
+        #if ENABLE_THREAD_STATS
+            return m_contentionCount.load(std::memory_order_relaxed);
+        #else
+            return 0;
+        #endif
+        }
+
+    private:
+        void LockContended();
+    };
+
+    // Holds lock of any primitive with Lock() and Unlock() methods for the duration of a scope.
+    template<typename LockType>
+    class ScopedLock final : NonCopyable
+    {
+        LockType& m_lock;
+
+    public:
+        explicit ScopedLock(LockType& lock)
+            : m_lock(lock)
+        {
+            m_lock.Lock();
+        }
+
+        ~ScopedLock()
+        {
+            m_lock.Unlock();
+        }
+    };
+}
@@ -0,0 +1,24 @@
+#include "Shared.hpp"
+#include "Platform/Thread.hpp"
+
+Thread::Handle::~Handle()
+{
+    ASSERT(!m_joinable, "Thread handle destroyed without being joined");
+}
+
+Thread::Handle::Handle(Handle&& other) noexcept
+{
+    *this = Move(other);
+}
+
+Thread::Handle& Thread::Handle::operator=(Handle&& other) noexcept
+{
+    ASSERT_SLOW(this != &other);
+    ASSERT(!m_joinable, "Thread handle overwritten without being joined");
+
+    m_handle = other.m_handle;
+    m_joinable = other.m_joinable;
+    other.m_handle = 0;
+    other.m_joinable = false;
+    return *this;
+}
@@ -5,4 +5,50 @@ namespace Thread
     void Sleep(u64 milliseconds);
     void Pause();
     void Yield();
+
+    enum class Priority : u8
+    {
+        Low,
+        Normal,
+        High,
+    };
+
+    struct Config
+    {
+        // Name visible in debuggers and profilers, truncated to 15 characters on Linux.
+        StringView name;
+
+        // Each set bit allows the thread to run on logical processor with that index.
+        // Zero keeps the default affinity inherited from the creating thread.
+        u64 affinityMask = 0;
+
+        // Raising priority may require elevated privileges and is skipped if not allowed.
+        Priority priority = Priority::Normal;
+    };
+
+    // Owning handle of a system thread that must be joined before it is destroyed.
+    class Handle final : NonCopyable
+    {
+        friend Handle Create(const Config& config, Function<void()>&& function);
+
+        u64 m_handle = 0;
+        bool m_joinable = false;
+
+    public:
+        Handle() = default;
+        ~Handle();
+
+        Handle(Handle&& other) noexcept;
+        Handle& operator=(Handle&& other) noexcept;
+
+        void Join();
+
+        bool IsJoinable() const
+        {
+            return m_joinable;
+        }
+    };
+
+    // Returns handle that is not joinable if thread could not be created.
+    Handle Create(const Config& config, Function<void()>&& function);
 }
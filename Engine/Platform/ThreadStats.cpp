@@ -0,0 +1,17 @@
+#include "Shared.hpp"
+#include "Platform/ThreadStats.hpp"
+
+#if ENABLE_THREAD_STATS
+
+void Thread::Stats::Print() const
+{
+    LOG_INFO("Thread stats:");
+    LOG_NO_SOURCE_LINE_SCOPE();
+    LOG_INFO("  Mutex contentions: %llu (%llu sleeps)", GetMutexContendedCount(), GetMutexSleepCount());
+    LOG_INFO("  Spin lock contentions: %llu (%llu yields)", GetSpinLockContendedCount(), GetSpinLockYieldCount());
+    LOG_INFO("  Condition variable sleeps: %llu", GetConditionSleepCount());
+    LOG_INFO("  Semaphore sleeps: %llu", GetSemaphoreSleepCount());
+    LOG_INFO("  Event sleeps: %llu", GetEventSleepCount());
+}
+
+#endif
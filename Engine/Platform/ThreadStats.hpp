@@ -0,0 +1,99 @@
+#pragma once
+
+#if ENABLE_THREAD_STATS
+
+#include "Common/Utility/Singleton.hpp"
+
+namespace Thread
+{
+    // Stats are only updated on contended paths of synchronization
+    // primitives, so they do not slow down uncontended locking.
+    class Stats final : public Singleton<Stats>
+    {
+        // Lock attempts that found lock already held.
+        std::atomic<u64> m_mutexContendedCount = 0;
+        std::atomic<u64> m_spinLockContendedCount = 0;
+
+        // Times thread went to sleep or yielded instead of spinning.
+        std::atomic<u64> m_mutexSleepCount = 0;
+        std::atomic<u64> m_spinLockYieldCount = 0;
+        std::atomic<u64> m_conditionSleepCount = 0;
+        std::atomic<u64> m_semaphoreSleepCount = 0;
+        std::atomic<u64> m_eventSleepCount = 0;
+
+    public:
+        void Print() const;
+
+        void OnMutexContended()
+        {
+            m_mutexContendedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void OnSpinLockContended()
+        {
+            m_spinLockContendedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void OnMutexSleep()
+        {
+            m_mutexSleepCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void OnSpinLockYield()
+        {
+            m_spinLockYieldCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void OnConditionSleep()
+        {
+            m_conditionSleepCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void OnSemaphoreSleep()
+        {
+            m_semaphoreSleepCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void OnEventSleep()
+        {
+            m_eventSleepCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        u64 GetMutexContendedCount() const
+        {
+            return m_mutexContendedCount.load(std::memory_order_relaxed);
+        }
+
+        u64 GetSpinLockContendedCount() const
+        {
+            return m_spinLockContendedCount.load(std::memory_order_relaxed);
+        }
+
+        u64 GetMutexSleepCount() const
+        {
+            return m_mutexSleepCount.load(std::memory_order_relaxed);
+        }
+
+        u64 GetSpinLockYieldCount() const
+        {
+            return m_spinLockYieldCount.load(std::memory_order_relaxed);
+        }
+
+        u64 GetConditionSleepCount() const
+        {
+            return m_conditionSleepCount.load(std::memory_order_relaxed);
+        }
+
+        u64 GetSemaphoreSleepCount() const
+        {
+            return m_semaphoreSleepCount.load(std::memory_order_relaxed);
+        }
+
+        u64 GetEventSleepCount() const
+        {
+            return m_eventSleepCount.load(std::memory_order_relaxed);
+        }
+    };
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include "Shared.hpp"
 #include "Common/Utility/Utility.hpp"
+#include "Platform/MappedFile.hpp"
 
 bool CheckFileExists(const StringView& filePath)
 {
@@ -7,57 +8,170 @@ bool CheckFileExists(const StringView& filePath)
     return stat(*filePath, &stats) == 0;
 }
 
-bool WriteStringToFileIfDifferent(const StringView& filePath, const StringView& contents)
+namespace
 {
-    if(!CheckFileExists(filePath))
+    // Compares next part of file with contents in fixed size chunks.
+    bool CompareFileContents(FILE* file, const StringView& contents)
     {
-        return WriteStringToFile(filePath, contents);
+        char buffer[16 * 1024];
+        for(u64 offset = 0; offset < contents.GetLength();)
+        {
+            const u64 chunkSize = std::min<u64>(sizeof(buffer), contents.GetLength() - offset);
+            if(fread(buffer, 1, chunkSize, file) != chunkSize)
+                return false;
+
+            if(std::memcmp(buffer, contents.GetData() + offset, chunkSize) != 0)
+                return false;
+
+            offset += chunkSize;
+        }
+
+        return true;
     }
 
-    String existingContent;
-    if(!ReadStringFromFile(filePath, existingContent))
+    // Contents are passed in consecutive parts to function given to forEachPart.
+    template<typename ForEachPart>
+    bool CheckFileEquals(const StringView& filePath, const u64 length, ForEachPart&& forEachPart)
     {
-        return false;
+        // Sizes are compared first, so only files that are likely
+        // unchanged are read and compared in fixed size chunks.
+        struct stat stats;
+        if(stat(*filePath, &stats) != 0 || static_cast<u64>(stats.st_size) != length)
+            return false;
+
+        FILE* file = fopen(*filePath, "rb");
+        if(!file)
+            return false;
+
+        SCOPE_GUARD
+        {
+            fclose(file);
+        };
+
+        bool equal = true;
+        forEachPart([&equal, file](const StringView& part)
+        {
+            equal = equal && CompareFileContents(file, part);
+        });
+
+        // File could have grown since its size has been queried.
+        return equal && fgetc(file) == EOF;
     }
 
-    if(existingContent != contents)
+    // Temporary file is placed next to destination, so it can be renamed over it on the same volume.
+    // Process identifier and counter keep names unique between concurrent writers of the same file.
+    InlineString<256> MakeTemporaryPath(const StringView& filePath)
     {
-        return WriteStringToFile(filePath, contents);
+        static std::atomic<u32> counter = 0;
+        return InlineString<256>::Format("%.*s.%u-%u.tmp", STRING_VIEW_PRINTF_ARG(filePath),
+            Platform::GetProcessId(), counter.fetch_add(1, std::memory_order_relaxed));
     }
+}
 
-    return true;
+bool CheckFileEqualsString(const StringView& filePath, const StringView& contents)
+{
+    return CheckFileEquals(filePath, contents.GetLength(), [&contents](auto&& function)
+    {
+        function(contents);
+    });
 }
 
-bool WriteStringToFile(const StringView& filePath, const StringView& contents)
+bool CheckFileEqualsStringBuilder(const StringView& filePath, const StringBuilder& builder)
 {
-    FILE* file = fopen(*filePath, "wb");
-    if(!file)
+    return CheckFileEquals(filePath, builder.GetLength(), [&builder](auto&& function)
     {
-        LOG_ERROR("Failed to open file for writing: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        builder.ForEachChunk(function);
+    });
+}
+
+bool WriteStringToFileIfDifferent(const StringView& filePath, const StringView& contents)
+{
+    const FileContents file = { filePath, contents };
+    return WriteFilesIfDifferent(&file, 1);
+}
+
+bool WriteStringBuilderToFileIfDifferent(const StringView& filePath, const StringBuilder& builder)
+{
+    // Chunks are compared and written without concatenating them, while changed
+    // file is still replaced in a single step like with other written strings.
+    if(CheckFileEqualsStringBuilder(filePath, builder))
+        return true;
+
+    const auto temporaryPath = MakeTemporaryPath(filePath);
+    if(!Platform::WriteStringBuilderToFileSynced(temporaryPath, builder))
+        return false;
+
+    if(!Platform::ReplaceFileAtomic(temporaryPath, filePath))
+    {
+        std::remove(*temporaryPath);
         return false;
     }
 
+    return true;
+}
+
+bool WriteFilesIfDifferent(const FileContents* files, const u64 count)
+{
+    // All changed files are written to temporary files first and replaced only once every write
+    // succeeded, so failed write leaves all files untouched. Each file is replaced atomically,
+    // but batch is not, so failed replace can leave files before it already replaced.
+    InlineArray<u64, 16> changedFiles;
+    InlineArray<InlineString<256>, 16> temporaryPaths;
+
     SCOPE_GUARD
     {
-        fclose(file);
+        for(const auto& temporaryPath : temporaryPaths)
+        {
+            std::remove(*temporaryPath);
+        }
     };
 
-    const u64 written = fwrite(contents.GetBeginPtr(), contents.GetCharSize(), contents.GetLength(), file);
-    if(written != contents.GetLength())
+    for(u64 i = 0; i < count; ++i)
     {
-        LOG_ERROR("Failed to write file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        const FileContents& file = files[i];
+        if(CheckFileEqualsString(file.path, file.contents))
+            continue;
+
+        // Temporary file is only removed by this function once it has been created by it.
+        auto temporaryPath = MakeTemporaryPath(file.path);
+        if(!Platform::WriteStringToFileSynced(temporaryPath, file.contents))
+            return false;
+
+        temporaryPaths.Add(Move(temporaryPath));
+        changedFiles.Add(i);
+    }
+
+    for(u64 i = 0; i < changedFiles.GetSize(); ++i)
+    {
+        if(!Platform::ReplaceFileAtomic(temporaryPaths[i], files[changedFiles[i]].path))
+            return false;
+    }
+
+    temporaryPaths.Clear();
+    return true;
+}
+
+bool WriteStringToFileAtomic(const StringView& filePath, const StringView& contents)
+{
+    const auto temporaryPath = MakeTemporaryPath(filePath);
+    if(!Platform::WriteStringToFileSynced(temporaryPath, contents))
+        return false;
+
+    if(!Platform::ReplaceFileAtomic(temporaryPath, filePath))
+    {
+        std::remove(*temporaryPath);
         return false;
     }
 
     return true;
 }
 
-bool ReadStringFromFile(const StringView& filePath, String& contents)
+bool WriteStringToFile(const StringView& filePath, const StringView& contents)
 {
-    FILE* file = fopen(*filePath, "rb");
+    FILE* file = fopen(*filePath, "wb");
     if(!file)
     {
-        LOG_ERROR("Failed to open file for reading: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        LOG_ERROR("Failed to open file for writing: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
         return false;
     }
 
@@ -66,18 +180,24 @@ bool ReadStringFromFile(const StringView& filePath, String& contents)
         fclose(file);
     };
 
-    fseek(file, 0, SEEK_END);
-    const u64 size = ftell(file);
-
-    contents.Resize(size, '\0');
-    fseek(file, 0, SEEK_SET);
-
-    const u64 read = fread(contents.GetData(), 1, size, file);
-    if(read != size)
+    const u64 written = fwrite(contents.GetBeginPtr(), contents.GetCharSize(), contents.GetLength(), file);
+    if(written != contents.GetLength())
     {
-        LOG_ERROR("Failed to read file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        LOG_ERROR("Failed to write file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
         return false;
     }
 
     return true;
 }
+
+bool ReadStringFromFile(const StringView& filePath, String& contents)
+{
+    // Contents are copied straight from mapped pages, avoiding
+    // intermediate zero-fill and additional read buffer copies.
+    Platform::MappedFile file;
+    if(!file.Open(filePath))
+        return false;
+
+    contents = file.GetStringView();
+    return true;
+}
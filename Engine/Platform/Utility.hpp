@@ -2,7 +2,39 @@
 
 #include "Common/Containers/StringView.hpp"
 
+class StringBuilder;
+
+struct FileContents
+{
+    StringView path;
+    StringView contents;
+};
+
 bool CheckFileExists(const StringView& filePath);
+bool CheckFileEqualsString(const StringView& filePath, const StringView& contents);
+bool CheckFileEqualsStringBuilder(const StringView& filePath, const StringBuilder& builder);
 bool WriteStringToFileIfDifferent(const StringView& filePath, const StringView& contents);
+bool WriteStringBuilderToFileIfDifferent(const StringView& filePath, const StringBuilder& builder);
+
+// Files are replaced only after all changed ones have been written, but failure while
+// replacing them can leave some files already replaced and others not.
+bool WriteFilesIfDifferent(const FileContents* files, u64 count);
+
+bool WriteStringToFileAtomic(const StringView& filePath, const StringView& contents);
 bool WriteStringToFile(const StringView& filePath, const StringView& contents);
+bool WriteStringBuilderToFile(const StringView& filePath, const StringBuilder& builder);
 bool ReadStringFromFile(const StringView& filePath, String& contents);
+
+namespace Platform
+{
+    u32 GetProcessId();
+
+    // Returns only after contents have been flushed to storage device. File must not exist yet,
+    // so existing files are never overwritten, and is removed again if writing fails.
+    bool WriteStringToFileSynced(const StringView& filePath, const StringView& contents);
+    bool WriteStringBuilderToFileSynced(const StringView& filePath, const StringBuilder& builder);
+
+    // Replaces destination with source file in a single step, so readers
+    // never observe partially written destination file.
+    bool ReplaceFileAtomic(const StringView& sourcePath, const StringView& destinationPath);
+}
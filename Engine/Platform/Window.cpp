@@ -1,6 +1,7 @@
 #include "Shared.hpp"
 #include "Platform/Window.hpp"
 #include "Engine.hpp"
+#include "Input/System.hpp"
 
 Platform::Window::~Window()
 {
@@ -29,6 +30,19 @@ bool Platform::Window::Setup(const WindowConfig& config)
         return false;
     }
 
+    if(!config.eventScriptPath.IsEmpty())
+    {
+        WindowEventScript script;
+        if(!script.Load(config.eventScriptPath))
+        {
+            LOG_ERROR("Failed to load window event script");
+            return false;
+        }
+
+        LOG_INFO("Playing %llu scripted window events", script.GetEventCount());
+        PlayEventScript(Move(script), config.eventTimeStep);
+    }
+
     LOG_INFO("Created %ux%u window", m_width, m_height);
     LOG_SUCCESS("Platform window setup complete");
     return m_setup = true;
@@ -37,6 +51,7 @@ bool Platform::Window::Setup(const WindowConfig& config)
 void Platform::Window::ProcessEvents()
 {
     m_detail.ProcessEvents();
+    ProcessScriptedEvents();
 
     u32 width, height;
     m_detail.GetSize(width, height);
@@ -78,6 +93,59 @@ void Platform::Window::SetTitleSuffix(const StringView& suffix)
     UpdateTitle();
 }
 
+void Platform::Window::SetInputSystem(Input::System* input)
+{
+    m_input = input;
+    m_detail.SetInputSystem(input);
+}
+
+void Platform::Window::PlayEventScript(WindowEventScript&& script, const f32 timeStep)
+{
+    m_eventScript = Move(script);
+    m_eventScript.Start(timeStep);
+}
+
+void Platform::Window::ProcessScriptedEvents()
+{
+    m_eventScript.Advance();
+
+    WindowEvent event;
+    while(m_eventScript.PopEvent(event))
+    {
+        switch(event.type)
+        {
+        case WindowEventType::Resize:
+            m_detail.SetSize(static_cast<u32>(event.x), static_cast<u32>(event.y));
+            break;
+
+        case WindowEventType::Close:
+            OnCloseEvent();
+            break;
+
+        case WindowEventType::Key:
+            if(m_input)
+            {
+                m_input->PushKey(static_cast<u16>(event.code), event.x != 0);
+            }
+            break;
+
+        case WindowEventType::MouseMove:
+            if(m_input)
+            {
+                m_input->PushMouseMove(event.x, event.y);
+            }
+            break;
+
+        case WindowEventType::MouseButton:
+            if(m_input)
+            {
+                m_input->PushMouseButton(static_cast<Input::MouseButton>(event.code), event.x != 0);
+            }
+            break;
+        }
+    }
+}
+
 void Platform::Window::UpdateTitle()
 {
     InlineString<256> fullTitle;
@@ -8,6 +8,13 @@
     #error "Unknown platform"
 #endif
 
+#include "Platform/WindowEventScript.hpp"
+
+namespace Input
+{
+    class System;
+}
+
 namespace Platform
 {
     struct WindowConfig;
@@ -26,6 +33,9 @@ namespace Platform
         using ResizeDelegate = Delegate<void(u32, u32)>;
         ResizeDelegate m_resizeDelegate;
 
+        Input::System* m_input = nullptr;
+        WindowEventScript m_eventScript;
+
     public:
         Window() = default;
         ~Window();
@@ -41,6 +51,14 @@ namespace Platform
         void SetTitle(const StringView& title);
         void SetTitleSuffix(const StringView& suffix);
 
+        // Input events received by window are pushed into input system, which must outlive the window.
+        void SetInputSystem(Input::System* input);
+
+        // Scripted events are delivered during event processing, after events of the platform.
+        // Resize and close events act as if they came from platform, while input events are
+        // pushed into input system.
+        void PlayEventScript(WindowEventScript&& script, f32 timeStep = 0.0f);
+
         u32 GetWidth() const
         {
             return m_width;
@@ -66,6 +84,11 @@ namespace Platform
             return m_resizeDelegate;
         }
 
+        const WindowEventScript& GetEventScript() const
+        {
+            return m_eventScript;
+        }
+
         const Detail::Window& GetDetail() const
         {
             return m_detail;
@@ -73,6 +96,7 @@ namespace Platform
 
     private:
         void UpdateTitle();
+        void ProcessScriptedEvents();
         void OnCloseEvent();
         void HandleResize(u32 width, u32 height);
     };
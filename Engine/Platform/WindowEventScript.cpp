@@ -0,0 +1,248 @@
+#include "Shared.hpp"
+#include "Platform/WindowEventScript.hpp"
+#include "Platform/Utility.hpp"
+#include "Platform/Time.hpp"
+#include "Common/Utility/NumberConversion.hpp"
+
+namespace
+{
+    struct EventTypeName
+    {
+        const char* name;
+        Platform::WindowEventType type;
+        u32 argumentCount;
+    };
+
+    constexpr EventTypeName EventTypeNames[] =
+    {
+        { "resize", Platform::WindowEventType::Resize, 2 },
+        { "close", Platform::WindowEventType::Close, 0 },
+        { "key", Platform::WindowEventType::Key, 2 },
+        { "mouse_move", Platform::WindowEventType::MouseMove, 2 },
+        { "mouse_button", Platform::WindowEventType::MouseButton, 2 },
+    };
+
+    bool IsScriptSpace(const char character)
+    {
+        return character == ' ' || character == '\t' || character == '\r';
+    }
+
+    // Splits line into whitespace separated tokens, with unused ones left empty.
+    u32 TokenizeScriptLine(const char* begin, const char* end, StringView* tokens, const u32 maxTokens)
+    {
+        u32 tokenCount = 0;
+        const char* current = begin;
+        while(current != end)
+        {
+            while(current != end && IsScriptSpace(*current))
+                ++current;
+
+            if(current == end || *current == '#')
+                break;
+
+            const char* tokenBegin = current;
+            while(current != end && !IsScriptSpace(*current) && *current != '#')
+                ++current;
+
+            if(tokenCount == maxTokens)
+                return maxTokens + 1;
+
+            tokens[tokenCount++] = StringView(tokenBegin, current - tokenBegin);
+        }
+
+        return tokenCount;
+    }
+
+    bool ParseScriptNumber(const StringView& token, f64& value)
+    {
+        const Optional<f64> number = NumberConversion::ParseFloat(token);
+        if(!number)
+            return false;
+
+        value = *number;
+        return true;
+    }
+
+    bool ParseScriptInteger(const StringView& token, i32& value)
+    {
+        const Optional<i32> number = NumberConversion::ParseInt<i32>(token);
+        if(!number)
+            return false;
+
+        value = *number;
+        return true;
+    }
+}
+
+bool Platform::WindowEventScript::Load(const StringView& filePath)
+{
+    String text;
+    if(!ReadStringFromFile(filePath, text))
+    {
+        LOG_ERROR("Failed to read window event script: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    return Parse(text, filePath);
+}
+
+bool Platform::WindowEventScript::Parse(const StringView& text, const StringView& sourceName)
+{
+    const char* current = text.GetBeginPtr();
+    const char* end = text.GetEndPtr();
+
+    u32 lineNumber = 0;
+    while(current != end)
+    {
+        ++lineNumber;
+
+        const char* lineEnd = current;
+        while(lineEnd != end && *lineEnd != '\n')
+            ++lineEnd;
+
+        StringView tokens[4];
+        const u32 tokenCount = TokenizeScriptLine(current, lineEnd, tokens, 4);
+        current = lineEnd != end ? lineEnd + 1 : end;
+
+        if(tokenCount == 0)
+            continue;
+
+        WindowEvent event;
+        f64 time;
+        if(!ParseScriptNumber(tokens[0], time) || time < 0.0)
+        {
+            LOG_ERROR("%.*s(%u): Invalid event time \"%.*s\"", STRING_VIEW_PRINTF_ARG(sourceName),
+                lineNumber, STRING_VIEW_PRINTF_ARG(tokens[0]));
+            return false;
+        }
+
+        event.time = static_cast<f32>(time);
+
+        const EventTypeName* typeName = nullptr;
+        for(const EventTypeName& entry : EventTypeNames)
+        {
+            if(tokenCount > 1 && tokens[1] == entry.name)
+            {
+                typeName = &entry;
+                break;
+            }
+        }
+
+        if(typeName == nullptr)
+        {
+            LOG_ERROR("%.*s(%u): Unknown event type \"%.*s\"", STRING_VIEW_PRINTF_ARG(sourceName),
+                lineNumber, STRING_VIEW_PRINTF_ARG(tokens[1]));
+            return false;
+        }
+
+        if(tokenCount != typeName->argumentCount + 2)
+        {
+            LOG_ERROR("%.*s(%u): Event \"%s\" expects %u arguments", STRING_VIEW_PRINTF_ARG(sourceName),
+                lineNumber, typeName->name, typeName->argumentCount);
+            return false;
+        }
+
+        event.type = typeName->type;
+
+        i32 arguments[2] = {};
+        for(u32 i = 0; i < typeName->argumentCount; ++i)
+        {
+            if(!ParseScriptInteger(tokens[i + 2], arguments[i]))
+            {
+                LOG_ERROR("%.*s(%u): Invalid event argument \"%.*s\"", STRING_VIEW_PRINTF_ARG(sourceName),
+                    lineNumber, STRING_VIEW_PRINTF_ARG(tokens[i + 2]));
+                return false;
+            }
+        }
+
+        switch(event.type)
+        {
+        case WindowEventType::Key:
+        case WindowEventType::MouseButton:
+            event.code = static_cast<u32>(arguments[0]);
+            event.x = arguments[1] != 0;
+            break;
+
+        default:
+            event.x = arguments[0];
+            event.y = arguments[1];
+            break;
+        }
+
+        if(event.type == WindowEventType::Resize && (event.x <= 0 || event.y <= 0))
+        {
+            LOG_ERROR("%.*s(%u): Resize size must be positive", STRING_VIEW_PRINTF_ARG(sourceName), lineNumber);
+            return false;
+        }
+
+        Add(event);
+    }
+
+    return true;
+}
+
+void Platform::WindowEventScript::Add(const WindowEvent& event)
+{
+    ASSERT(!m_playing, "Cannot add events to script during playback");
+
+    // Scripts are usually written in order, so insertion position is searched from the back.
+    u64 index = m_events.GetSize();
+    while(index > 0 && m_events[index - 1].time > event.time)
+    {
+        --index;
+    }
+
+    m_events.Insert(index, event);
+}
+
+void Platform::WindowEventScript::Clear()
+{
+    m_events.Clear();
+    m_nextEvent = 0;
+    m_time = 0.0;
+    m_playing = false;
+}
+
+void Platform::WindowEventScript::Start(const f32 timeStep)
+{
+    ASSERT(timeStep >= 0.0f);
+
+    m_nextEvent = 0;
+    m_startTick = Time::GetCurrentTick();
+    m_frameCount = 0;
+    m_time = 0.0;
+    m_timeStep = timeStep;
+    m_playing = true;
+}
+
+void Platform::WindowEventScript::Advance()
+{
+    if(!m_playing)
+        return;
+
+    if(m_timeStep > 0.0f)
+    {
+        // Multiplying frame count does not accumulate rounding errors like repeated addition.
+        ++m_frameCount;
+        m_time = static_cast<f64>(m_timeStep) * m_frameCount;
+    }
+    else
+    {
+        m_time = Time::ConvertTicksToSeconds(Time::GetCurrentTick() - m_startTick);
+    }
+}
+
+bool Platform::WindowEventScript::PopEvent(WindowEvent& event)
+{
+    if(!m_playing || IsFinished())
+        return false;
+
+    const WindowEvent& nextEvent = m_events[m_nextEvent];
+    // Compared at precision of event timestamps, so events land exactly on frames with matching time.
+    if(nextEvent.time > static_cast<f32>(m_time))
+        return false;
+
+    event = nextEvent;
+    ++m_nextEvent;
+    return true;
+}
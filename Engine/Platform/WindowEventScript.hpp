@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Platform/WindowEvents.hpp"
+
+namespace Platform
+{
+    // Timeline of window events played back in order of their timestamps. Playback clock either
+    // follows real time, or advances by fixed time step on every processed frame, which delivers
+    // the same events on the same frames no matter how fast frames are processed.
+    //
+    // Text format has one event per line, with # starting a comment:
+    //     <time> resize <width> <height>
+    //     <time> close
+    //     <time> key <code> <pressed>
+    //     <time> mouse_move <x> <y>
+    //     <time> mouse_button <button> <pressed>
+    class WindowEventScript final
+    {
+        HeapArray<WindowEvent> m_events;
+        u64 m_nextEvent = 0;
+        u64 m_startTick = 0;
+        u64 m_frameCount = 0;
+        f64 m_time = 0.0;
+        f32 m_timeStep = 0.0f;
+        bool m_playing = false;
+
+    public:
+        WindowEventScript() = default;
+
+        bool Load(const StringView& filePath);
+        bool Parse(const StringView& text, const StringView& sourceName = "<script>");
+
+        // Events with equal timestamps are played in order they were added.
+        void Add(const WindowEvent& event);
+        void Clear();
+
+        // Zero time step makes playback clock follow real time.
+        void Start(f32 timeStep = 0.0f);
+
+        // Advances playback clock by one frame.
+        void Advance();
+
+        // Returns events that are due at current playback time, one at a time.
+        bool PopEvent(WindowEvent& event);
+
+        u64 GetEventCount() const
+        {
+            return m_events.GetSize();
+        }
+
+        const WindowEvent& GetEvent(const u64 index) const
+        {
+            return m_events[index];
+        }
+
+        f64 GetTime() const
+        {
+            return m_time;
+        }
+
+        bool IsPlaying() const
+        {
+            return m_playing;
+        }
+
+        bool IsFinished() const
+        {
+            return m_nextEvent == m_events.GetSize();
+        }
+    };
+}
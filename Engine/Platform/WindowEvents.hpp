@@ -1,5 +1,29 @@
 #pragma once
 
+namespace Platform
+{
+    enum class WindowEventType : u8
+    {
+        Resize,
+        Close,
+        Key,
+        MouseMove,
+        MouseButton,
+    };
+
+    // Compact window event that can be scripted and replayed. Resize uses x and y as width and
+    // height, key and mouse button use code with x as pressed state, and mouse move uses x and y
+    // as cursor position.
+    struct WindowEvent
+    {
+        f32 time = 0.0f; // Seconds since start of playback
+        WindowEventType type = WindowEventType::Close;
+        u32 code = 0;
+        i32 x = 0;
+        i32 y = 0;
+    };
+}
+
 namespace Platform::Detail
 {
     using OnWindowCloseFunction = Function<void()>;
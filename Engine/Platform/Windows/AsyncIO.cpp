@@ -0,0 +1,77 @@
+#include "Shared.hpp"
+#include "Platform/AsyncIO.hpp"
+
+bool Platform::AsyncFile::Open(const StringView& filePath, const AsyncIOOperation access)
+{
+    Close();
+
+    const bool read = access == AsyncIOOperation::Read;
+    HANDLE file = CreateFileA(*filePath, read ? GENERIC_READ : GENERIC_WRITE, read ? FILE_SHARE_READ : 0,
+        nullptr, read ? OPEN_EXISTING : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE)
+    {
+        LOG_ERROR("Failed to open file for async access: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    m_handle = reinterpret_cast<i64>(file);
+    return true;
+}
+
+void Platform::AsyncFile::Close()
+{
+    if(m_handle != -1)
+    {
+        CloseHandle(reinterpret_cast<HANDLE>(m_handle));
+        m_handle = -1;
+    }
+}
+
+u64 Platform::AsyncFile::GetSize() const
+{
+    ASSERT(IsOpen());
+
+    LARGE_INTEGER size = {};
+    if(!GetFileSizeEx(reinterpret_cast<HANDLE>(m_handle), &size))
+        return 0;
+
+    return static_cast<u64>(size.QuadPart);
+}
+
+bool Platform::Detail::ExecuteRequest(const AsyncIORequest& request, u64& transferred)
+{
+    HANDLE file = reinterpret_cast<HANDLE>(request.file->GetHandle());
+    u8* buffer = static_cast<u8*>(request.buffer);
+
+    transferred = 0;
+    while(transferred < request.size)
+    {
+        // Offset in overlapped structure is respected by synchronous handles as well.
+        const u64 offset = request.offset + transferred;
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+        const DWORD chunkSize = static_cast<DWORD>(std::min<u64>(request.size - transferred, MAXDWORD));
+        DWORD chunkTransferred = 0;
+        const BOOL result = request.operation == AsyncIOOperation::Read ?
+            ReadFile(file, buffer + transferred, chunkSize, &chunkTransferred, &overlapped) :
+            WriteFile(file, buffer + transferred, chunkSize, &chunkTransferred, &overlapped);
+
+        if(!result)
+        {
+            // Reading past end of file is not an error and results in fewer bytes transferred.
+            if(GetLastError() == ERROR_HANDLE_EOF)
+                break;
+
+            return false;
+        }
+
+        if(chunkTransferred == 0)
+            break;
+
+        transferred += chunkTransferred;
+    }
+
+    return true;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+namespace Platform
+{
+    class AsyncIO;
+    class AsyncIORequest;
+}
+
+namespace Platform::Detail
+{
+    // Kernel queue is not used on Windows, where requests are
+    // always executed by worker threads or the submitting thread.
+    class AsyncIO final : NonCopyable
+    {
+    public:
+        AsyncIO() = default;
+        ~AsyncIO() = default;
+
+        bool Setup(Platform::AsyncIO*, u32)
+        {
+            return false;
+        }
+
+        void Shutdown()
+        {
+        }
+
+        void Flush()
+        {
+        }
+
+        bool IsSetup() const
+        {
+            return false;
+        }
+    };
+
+    bool ExecuteRequest(const AsyncIORequest& request, u64& transferred);
+}
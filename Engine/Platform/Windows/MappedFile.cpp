@@ -0,0 +1,83 @@
+#include "Shared.hpp"
+#include "Platform/MappedFile.hpp"
+
+bool Platform::MappedFile::Open(const StringView& filePath)
+{
+    Close();
+
+    HANDLE file = CreateFileA(*filePath, GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if(file == INVALID_HANDLE_VALUE)
+    {
+        LOG_ERROR("Failed to open file for mapping: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    SCOPE_GUARD
+    {
+        // Mapped view remains valid after file handle is closed.
+        CloseHandle(file);
+    };
+
+    // Regular files with known size are mapped, while pipes and
+    // other character devices are streamed in chunks instead.
+    LARGE_INTEGER fileSize = {};
+    if(GetFileType(file) == FILE_TYPE_DISK && GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+    {
+        const u64 size = static_cast<u64>(fileSize.QuadPart);
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(mapping != nullptr)
+        {
+            void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+
+            if(view != nullptr)
+            {
+                // Hint that contents will be read soon, so pages can be fetched ahead in large batches.
+                WIN32_MEMORY_RANGE_ENTRY range = { view, static_cast<SIZE_T>(size) };
+                PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+
+                m_data = static_cast<const u8*>(view);
+                m_size = size;
+                m_mapped = true;
+                m_open = true;
+                return true;
+            }
+        }
+
+        LOG_WARNING("Failed to map file, falling back to streaming: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+    }
+
+    while(true)
+    {
+        u8* chunk = m_buffer.AddUninitialized(StreamChunkSize);
+
+        DWORD bytesRead = 0;
+        const BOOL result = ReadFile(file, chunk, static_cast<DWORD>(StreamChunkSize), &bytesRead, nullptr);
+        m_buffer.Resize(m_buffer.GetSize() - StreamChunkSize + bytesRead);
+
+        if(!result)
+        {
+            if(GetLastError() == ERROR_BROKEN_PIPE)
+                break;
+
+            LOG_ERROR("Failed to stream file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+            m_buffer = {};
+            return false;
+        }
+
+        if(bytesRead == 0)
+            break;
+    }
+
+    m_data = m_buffer.GetData();
+    m_size = m_buffer.GetSize();
+    m_open = true;
+    return true;
+}
+
+void Platform::MappedFile::Unmap()
+{
+    ASSERT(m_mapped);
+    ASSERT_EVALUATE(UnmapViewOfFile(m_data));
+}
@@ -0,0 +1,17 @@
+#include "Shared.hpp"
+#include "Platform/Synchronization.hpp"
+
+void Thread::Detail::WaitOnAddress(std::atomic<u32>& address, const u32 expected)
+{
+    ::WaitOnAddress(&address, const_cast<u32*>(&expected), sizeof(u32), INFINITE);
+}
+
+void Thread::Detail::WakeOne(std::atomic<u32>& address)
+{
+    ::WakeByAddressSingle(&address);
+}
+
+void Thread::Detail::WakeAll(std::atomic<u32>& address)
+{
+    ::WakeByAddressAll(&address);
+}
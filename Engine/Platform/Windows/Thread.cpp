@@ -1,6 +1,59 @@
 #include "Shared.hpp"
 #include "Platform/Thread.hpp"
 
+namespace
+{
+    constexpr u64 MaxThreadNameLength = 63;
+
+    // Context is allocated by creating thread and owned by the new thread once
+    // created, so creating thread does not have to wait for it to start running.
+    struct ThreadStartContext
+    {
+        Function<void()> function;
+    };
+
+    DWORD WINAPI ThreadStart(LPVOID argument)
+    {
+        UniquePtr<ThreadStartContext> context(static_cast<ThreadStartContext*>(argument));
+        Function<void()> function = Move(context->function);
+        context.Reset();
+
+        function();
+        return 0;
+    }
+
+    void ApplyThreadConfig(const HANDLE thread, const Thread::Config& config)
+    {
+        if(!config.name.IsEmpty())
+        {
+            wchar_t name[MaxThreadNameLength + 1] = {};
+            const int nameLength = static_cast<int>(std::min(config.name.GetLength(), MaxThreadNameLength));
+            MultiByteToWideChar(CP_UTF8, 0, config.name.GetData(), nameLength, name, MaxThreadNameLength);
+            SetThreadDescription(thread, name);
+        }
+
+        if(config.affinityMask != 0)
+        {
+            if(SetThreadAffinityMask(thread, static_cast<DWORD_PTR>(config.affinityMask)) == 0)
+            {
+                LOG_WARNING("Failed to set affinity mask 0x%llx for thread \"%.*s\"",
+                    config.affinityMask, STRING_VIEW_PRINTF_ARG(config.name));
+            }
+        }
+
+        if(config.priority != Thread::Priority::Normal)
+        {
+            const int priority = config.priority == Thread::Priority::High ?
+                THREAD_PRIORITY_ABOVE_NORMAL : THREAD_PRIORITY_BELOW_NORMAL;
+            if(!SetThreadPriority(thread, priority))
+            {
+                LOG_DEBUG("Thread \"%.*s\" priority could not be changed (error %lu)",
+                    STRING_VIEW_PRINTF_ARG(config.name), GetLastError());
+            }
+        }
+    }
+}
+
 void Thread::Sleep(const u64 milliseconds)
 {
     ::Sleep(milliseconds);
@@ -8,10 +61,44 @@ void Thread::Sleep(const u64 milliseconds)
 
 void Thread::Pause()
 {
-    ::Sleep(INFINITE);
+    YieldProcessor();
 }
 
 void Thread::Yield()
 {
     ::SwitchToThread();
 }
+
+void Thread::Handle::Join()
+{
+    ASSERT(m_joinable);
+    const HANDLE thread = reinterpret_cast<HANDLE>(m_handle);
+    ASSERT_EVALUATE(WaitForSingleObject(thread, INFINITE) == WAIT_OBJECT_0);
+    CloseHandle(thread);
+    m_joinable = false;
+}
+
+Thread::Handle Thread::Create(const Config& config, Function<void()>&& function)
+{
+    ASSERT(function);
+
+    UniquePtr<ThreadStartContext> context(Memory::New<ThreadStartContext>());
+    context->function = Move(function);
+
+    // Thread is configured before it is allowed to run.
+    const HANDLE thread = CreateThread(nullptr, 0, &ThreadStart, context.Get(), CREATE_SUSPENDED, nullptr);
+    if(thread == nullptr)
+    {
+        LOG_ERROR("Failed to create thread \"%.*s\" (error %lu)", STRING_VIEW_PRINTF_ARG(config.name), GetLastError());
+        return {};
+    }
+
+    context.Detach();
+    ApplyThreadConfig(thread, config);
+    ResumeThread(thread);
+
+    Handle handle;
+    handle.m_handle = reinterpret_cast<u64>(thread);
+    handle.m_joinable = true;
+    return handle;
+}
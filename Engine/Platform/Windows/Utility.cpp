@@ -0,0 +1,176 @@
+#include "Shared.hpp"
+#include "Platform/Utility.hpp"
+
+namespace
+{
+    bool WriteStringBuilderChunks(HANDLE file, const StringBuilder& builder)
+    {
+        // Gathered writes with WriteFileGather() require unbuffered access with page sized and aligned
+        // segments, which chunks are not. Instead, consecutive chunks are staged into one buffer, so
+        // a single write call is issued per batch of chunks rather than one per chunk.
+        char staging[StringBuilder::MaxChunkCapacity];
+        u64 stagedLength = 0;
+        bool success = true;
+
+        auto writeData = [&](const char* data, u64 length)
+        {
+            while(success && length > 0)
+            {
+                DWORD written = 0;
+                const DWORD chunkSize = static_cast<DWORD>(std::min<u64>(length, MAXDWORD));
+                if(!WriteFile(file, data, chunkSize, &written, nullptr) || written == 0)
+                {
+                    success = false;
+                    break;
+                }
+
+                data += written;
+                length -= written;
+            }
+        };
+
+        builder.ForEachChunk([&](const StringView& chunk)
+        {
+            if(stagedLength + chunk.GetLength() > sizeof(staging))
+            {
+                writeData(staging, stagedLength);
+                stagedLength = 0;
+            }
+
+            // Chunks that do not fit into empty staging buffer are written directly.
+            if(chunk.GetLength() > sizeof(staging))
+            {
+                writeData(chunk.GetData(), chunk.GetLength());
+                return;
+            }
+
+            std::memcpy(staging + stagedLength, chunk.GetData(), chunk.GetLength());
+            stagedLength += chunk.GetLength();
+        });
+
+        writeData(staging, stagedLength);
+        return success;
+    }
+}
+
+u32 Platform::GetProcessId()
+{
+    return static_cast<u32>(GetCurrentProcessId());
+}
+
+bool Platform::WriteStringToFileSynced(const StringView& filePath, const StringView& contents)
+{
+    HANDLE file = CreateFileA(*filePath, GENERIC_WRITE, 0, nullptr,
+        CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE)
+    {
+        LOG_ERROR("Failed to open file for writing: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    bool success = false;
+    SCOPE_GUARD
+    {
+        CloseHandle(file);
+        if(!success)
+        {
+            DeleteFileA(*filePath);
+        }
+    };
+
+    const char* data = contents.GetData();
+    u64 remaining = contents.GetLength();
+    while(remaining > 0)
+    {
+        DWORD written = 0;
+        const DWORD chunkSize = static_cast<DWORD>(std::min<u64>(remaining, MAXDWORD));
+        if(!WriteFile(file, data, chunkSize, &written, nullptr))
+        {
+            LOG_ERROR("Failed to write file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+            return false;
+        }
+
+        data += written;
+        remaining -= written;
+    }
+
+    if(!FlushFileBuffers(file))
+    {
+        LOG_ERROR("Failed to flush file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    success = true;
+    return true;
+}
+
+bool Platform::ReplaceFileAtomic(const StringView& sourcePath, const StringView& destinationPath)
+{
+    if(!MoveFileExA(*sourcePath, *destinationPath, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+    {
+        LOG_ERROR("Failed to replace file: %.*s", STRING_VIEW_PRINTF_ARG(destinationPath));
+        return false;
+    }
+
+    return true;
+}
+
+bool Platform::WriteStringBuilderToFileSynced(const StringView& filePath, const StringBuilder& builder)
+{
+    HANDLE file = CreateFileA(*filePath, GENERIC_WRITE, 0, nullptr,
+        CREATE_NEW, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if(file == INVALID_HANDLE_VALUE)
+    {
+        LOG_ERROR("Failed to open file for writing: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    bool success = false;
+    SCOPE_GUARD
+    {
+        CloseHandle(file);
+        if(!success)
+        {
+            DeleteFileA(*filePath);
+        }
+    };
+
+    if(!WriteStringBuilderChunks(file, builder))
+    {
+        LOG_ERROR("Failed to write file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    if(!FlushFileBuffers(file))
+    {
+        LOG_ERROR("Failed to flush file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    success = true;
+    return true;
+}
+
+bool WriteStringBuilderToFile(const StringView& filePath, const StringBuilder& builder)
+{
+    HANDLE file = CreateFileA(*filePath, GENERIC_WRITE, 0, nullptr,
+        CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if(file == INVALID_HANDLE_VALUE)
+    {
+        LOG_ERROR("Failed to open file for writing: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    SCOPE_GUARD
+    {
+        CloseHandle(file);
+    };
+
+    if(!WriteStringBuilderChunks(file, builder))
+    {
+        LOG_ERROR("Failed to write file contents: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    return true;
+}
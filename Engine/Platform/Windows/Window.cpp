@@ -1,5 +1,6 @@
 #include "Shared.hpp"
 #include "Window.hpp"
+#include "Input/System.hpp"
 
 class WindowClass
 {
@@ -45,6 +46,54 @@ LRESULT CALLBACK Platform::Detail::Window::WndProc(HWND hwnd, UINT uMsg, WPARAM
         return 0;
     }
 
+    // Input messages are pushed into input system without interpreting them here.
+    Input::System* input = window ? window->m_input : nullptr;
+    if(input)
+    {
+        switch(uMsg)
+        {
+        case WM_KEYDOWN:
+        case WM_KEYUP:
+            input->PushKey(static_cast<u16>(wParam), uMsg == WM_KEYDOWN);
+            return 0;
+
+        case WM_SYSKEYDOWN:
+        case WM_SYSKEYUP:
+            // System keys still need default handling, such as Alt+F4 closing the window.
+            input->PushKey(static_cast<u16>(wParam), uMsg == WM_SYSKEYDOWN);
+            break;
+
+        case WM_MOUSEMOVE:
+            input->PushMouseMove(static_cast<i16>(LOWORD(lParam)), static_cast<i16>(HIWORD(lParam)));
+            return 0;
+
+        case WM_LBUTTONDOWN:
+        case WM_LBUTTONUP:
+            input->PushMouseButton(Input::MouseButton::Left, uMsg == WM_LBUTTONDOWN);
+            return 0;
+
+        case WM_RBUTTONDOWN:
+        case WM_RBUTTONUP:
+            input->PushMouseButton(Input::MouseButton::Right, uMsg == WM_RBUTTONDOWN);
+            return 0;
+
+        case WM_MBUTTONDOWN:
+        case WM_MBUTTONUP:
+            input->PushMouseButton(Input::MouseButton::Middle, uMsg == WM_MBUTTONDOWN);
+            return 0;
+
+        case WM_XBUTTONDOWN:
+        case WM_XBUTTONUP:
+            input->PushMouseButton(GET_XBUTTON_WPARAM(wParam) == XBUTTON1 ?
+                Input::MouseButton::Back : Input::MouseButton::Forward, uMsg == WM_XBUTTONDOWN);
+            return TRUE;
+
+        case WM_MOUSEWHEEL:
+            input->PushMouseWheel(GET_WHEEL_DELTA_WPARAM(wParam));
+            return 0;
+        }
+    }
+
     return DefWindowProc(hwnd, uMsg, wParam, lParam);
 }
 
@@ -61,6 +110,11 @@ void Platform::Detail::Window::SetOnCloseEvent(OnWindowCloseFunction&& function)
     m_onCloseFunction = Forward<OnWindowCloseFunction>(function);
 }
 
+void Platform::Detail::Window::SetInputSystem(Input::System* input)
+{
+    m_input = input;
+}
+
 bool Platform::Detail::Window::Setup(const StringView& title, u32& width, u32& height)
 {
     ASSERT(!m_handle);
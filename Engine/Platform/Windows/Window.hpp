@@ -2,6 +2,11 @@
 
 #include "Platform/WindowEvents.hpp"
 
+namespace Input
+{
+    class System;
+}
+
 namespace Platform
 {
     class Window;
@@ -13,12 +18,14 @@ namespace Platform::Detail
     {
         HWND m_handle = nullptr;
         OnWindowCloseFunction m_onCloseFunction;
+        Input::System* m_input = nullptr;
 
     public:
         Window() = default;
         ~Window();
 
         void SetOnCloseEvent(OnWindowCloseFunction&& function);
+        void SetInputSystem(Input::System* input);
         bool Setup(const StringView& title, u32& width, u32& height);
         void ProcessEvents();
 
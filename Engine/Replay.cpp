@@ -0,0 +1,253 @@
+#include "Shared.hpp"
+#include "Replay.hpp"
+#include "Config.hpp"
+#include "Input/System.hpp"
+#include "Platform/CommandLine.hpp"
+
+Replay::~Replay()
+{
+    Shutdown();
+}
+
+bool Replay::Setup(const ReplayConfig& config)
+{
+    ASSERT(m_mode == Mode::Disabled);
+
+    // Paths given on command line override config, so any session can be recorded or played back.
+    const Platform::CommandLine& commandLine = Platform::CommandLine::Get();
+    const Optional<StringView> recordArgument = commandLine.GetArgumentValue("RecordReplay");
+    const Optional<StringView> playArgument = commandLine.GetArgumentValue("PlayReplay");
+    const Optional<StringView> timingsArgument = commandLine.GetArgumentValue("ReplayTimings");
+    const StringView recordPath = recordArgument ? *recordArgument : StringView(config.recordPath);
+    const StringView playPath = playArgument ? *playArgument : StringView(config.playPath);
+    const StringView timingsPath = timingsArgument ? *timingsArgument : StringView(config.timingsPath);
+
+    if(!playPath.IsEmpty())
+    {
+        LOG_DEBUG("Setting up replay playback...");
+
+        if(!m_playFile.Open(playPath))
+        {
+            LOG_ERROR("Failed to open replay file: %.*s", STRING_VIEW_PRINTF_ARG(playPath));
+            return false;
+        }
+
+        ReplayHeader header;
+        if(m_playFile.GetSize() < sizeof(header))
+        {
+            LOG_ERROR("Replay file is too small: %.*s", STRING_VIEW_PRINTF_ARG(playPath));
+            m_playFile.Close();
+            return false;
+        }
+
+        std::memcpy(&header, m_playFile.GetData(), sizeof(header));
+        if(header.magic != ReplayHeader::Magic || header.version != ReplayHeader::Version)
+        {
+            LOG_ERROR("Replay file has unsupported format: %.*s", STRING_VIEW_PRINTF_ARG(playPath));
+            m_playFile.Close();
+            return false;
+        }
+
+        m_playOffset = sizeof(header);
+        m_timingsPath = timingsPath;
+        m_frameTimes.Reserve(header.frameCount);
+        m_mode = Mode::Play;
+
+        LOG_INFO("Playing replay with %llu frames: %.*s", header.frameCount,
+            STRING_VIEW_PRINTF_ARG(playPath));
+    }
+    else if(!recordPath.IsEmpty())
+    {
+        LOG_DEBUG("Setting up replay recording...");
+
+        m_recordFile = fopen(*recordPath, "wb");
+        if(!m_recordFile)
+        {
+            LOG_ERROR("Failed to open replay file for writing: %.*s", STRING_VIEW_PRINTF_ARG(recordPath));
+            return false;
+        }
+
+        // Frame count in header is filled in once recording ends.
+        const ReplayHeader header;
+        if(fwrite(&header, sizeof(header), 1, m_recordFile) != 1)
+        {
+            LOG_ERROR("Failed to write replay header: %.*s", STRING_VIEW_PRINTF_ARG(recordPath));
+            fclose(m_recordFile);
+            m_recordFile = nullptr;
+            return false;
+        }
+
+        m_mode = Mode::Record;
+        LOG_INFO("Recording replay: %.*s", STRING_VIEW_PRINTF_ARG(recordPath));
+    }
+
+    return true;
+}
+
+void Replay::Shutdown()
+{
+    if(m_mode == Mode::Record)
+    {
+        ReplayHeader header;
+        header.frameCount = m_frameCount;
+        if(fseek(m_recordFile, 0, SEEK_SET) != 0 || fwrite(&header, sizeof(header), 1, m_recordFile) != 1)
+        {
+            LOG_ERROR("Failed to finalize replay header");
+        }
+
+        fclose(m_recordFile);
+        m_recordFile = nullptr;
+        m_recordEvents.Clear();
+
+        LOG_INFO("Recorded %llu replay frames", m_frameCount);
+    }
+    else if(m_mode == Mode::Play)
+    {
+        PrintPlaybackStats();
+
+        if(!m_timingsPath.IsEmpty() && !WriteTimings())
+        {
+            LOG_ERROR("Failed to write replay frame timings");
+        }
+
+        m_playFile.Close();
+        m_playOffset = 0;
+        m_playFrame = {};
+        m_playEvents = nullptr;
+        m_frameTimes.Clear();
+        m_timingsPath.Clear();
+    }
+
+    m_frameCount = 0;
+    m_mode = Mode::Disabled;
+}
+
+void Replay::RecordEvent(const Input::Event& event)
+{
+    ASSERT_SLOW(IsRecording());
+    m_recordEvents.Add(event);
+}
+
+void Replay::RecordFrame(const f32 deltaTime, const u32 width, const u32 height)
+{
+    ASSERT_SLOW(IsRecording());
+
+    ReplayFrame frame;
+    frame.deltaTime = deltaTime;
+    frame.width = width;
+    frame.height = height;
+    frame.eventCount = static_cast<u32>(m_recordEvents.GetSize());
+
+    // Writes are buffered by the file stream, so each frame does not reach the disk on its own.
+    if(fwrite(&frame, sizeof(frame), 1, m_recordFile) != 1 ||
+        fwrite(m_recordEvents.GetData(), sizeof(Input::Event), frame.eventCount, m_recordFile) != frame.eventCount)
+    {
+        LOG_ERROR("Failed to write replay frame %llu", m_frameCount);
+    }
+
+    m_recordEvents.Clear();
+    ++m_frameCount;
+}
+
+bool Replay::PlayFrame(const f32 measuredDeltaTime)
+{
+    ASSERT_SLOW(IsPlaying());
+
+    // Measured time at the start of a frame belongs to the frame played before it.
+    if(m_frameCount > 0)
+    {
+        m_frameTimes.Add(measuredDeltaTime);
+    }
+
+    const u64 size = m_playFile.GetSize();
+    if(m_playOffset == size)
+        return false;
+
+    const u8* data = m_playFile.GetData();
+    if(size - m_playOffset < sizeof(ReplayFrame))
+    {
+        LOG_ERROR("Replay frame %llu is truncated", m_frameCount);
+        m_playOffset = size;
+        return false;
+    }
+
+    std::memcpy(&m_playFrame, data + m_playOffset, sizeof(ReplayFrame));
+    m_playOffset += sizeof(ReplayFrame);
+
+    const u64 eventsSize = static_cast<u64>(m_playFrame.eventCount) * sizeof(Input::Event);
+    if(size - m_playOffset < eventsSize)
+    {
+        LOG_ERROR("Replay frame %llu events are truncated", m_frameCount);
+        m_playOffset = size;
+        return false;
+    }
+
+    m_playEvents = reinterpret_cast<const Input::Event*>(data + m_playOffset);
+    ASSERT_SLOW(reinterpret_cast<uintptr_t>(m_playEvents) % alignof(Input::Event) == 0);
+    m_playOffset += eventsSize;
+
+    ++m_frameCount;
+    return true;
+}
+
+void Replay::PushEvents(Input::System& input) const
+{
+    ASSERT_SLOW(IsPlaying());
+
+    // Recorded timestamps are meaningless in current session and would break latency measurement.
+    const u64 currentTick = Time::GetCurrentTick();
+    for(u32 i = 0; i < m_playFrame.eventCount; ++i)
+    {
+        Input::Event event = m_playEvents[i];
+        event.tick = currentTick;
+
+        if(!input.Push(event))
+        {
+            LOG_WARNING("Replay frame %llu has more events than input queue can hold", m_frameCount - 1);
+        }
+    }
+}
+
+void Replay::PrintPlaybackStats() const
+{
+    if(m_frameTimes.IsEmpty())
+        return;
+
+    f32 totalTime = 0.0f;
+    f32 minimumTime = m_frameTimes[0];
+    f32 maximumTime = m_frameTimes[0];
+    for(const f32 frameTime : m_frameTimes)
+    {
+        totalTime += frameTime;
+        minimumTime = std::min(minimumTime, frameTime);
+        maximumTime = std::max(maximumTime, frameTime);
+    }
+
+    LOG_INFO("Played %llu replay frames in %.3fs (min: %.3fms, avg: %.3fms, max: %.3fms)",
+        m_frameTimes.GetSize(), totalTime, minimumTime * 1000.0f,
+        totalTime / m_frameTimes.GetSize() * 1000.0f, maximumTime * 1000.0f);
+}
+
+bool Replay::WriteTimings() const
+{
+    FILE* file = fopen(*m_timingsPath, "wb");
+    if(!file)
+    {
+        LOG_ERROR("Failed to open file for writing: %s", *m_timingsPath);
+        return false;
+    }
+
+    SCOPE_GUARD
+    {
+        fclose(file);
+    };
+
+    // One frame time in milliseconds per line, easy to diff and plot between builds.
+    for(const f32 frameTime : m_frameTimes)
+    {
+        if(fprintf(file, "%.4f\n", frameTime * 1000.0f) < 0)
+            return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Input/Events.hpp"
+#include "Platform/MappedFile.hpp"
+
+struct ReplayConfig;
+
+namespace Input
+{
+    class System;
+}
+
+// Replay stream starts with a header, followed by one record per frame made of a frame
+// header and input events drained during that frame. Every part is a multiple of eight
+// bytes in size, so events can be read in place from mapped file without copying them.
+// Values are stored in native byte order, as replays are meant to be played on the same
+// platform they were recorded on. Closing the window ends the stream, so the last frame
+// that is recorded is the last one that has been updated.
+struct ReplayHeader
+{
+    static constexpr u32 Magic = 0x4C505242; // "BRPL"
+    static constexpr u32 Version = 1;
+
+    u32 magic = Magic;
+    u32 version = Version;
+    u64 frameCount = 0;
+};
+
+struct ReplayFrame
+{
+    f32 deltaTime = 0.0f;
+    u32 width = 0;
+    u32 height = 0;
+    u32 eventCount = 0;
+};
+
+static_assert(sizeof(ReplayHeader) % 8 == 0);
+static_assert(sizeof(ReplayFrame) % 8 == 0);
+static_assert(sizeof(Input::Event) % 8 == 0);
+
+// Captures main loop inputs into replay stream, or plays them back in place of platform
+// timer, window and input. Delta time of every frame is taken from Time::Timer tick,
+// window size after processing window events, and input events as they are drained by
+// input system, so replaying them drives application update exactly as it was recorded.
+// Playback does not wait for frames, and measures real time of every played frame so
+// frame times of the same replay can be compared between builds.
+class Replay final : NonCopyable
+{
+public:
+    enum class Mode
+    {
+        Disabled,
+        Record,
+        Play,
+    };
+
+private:
+    Mode m_mode = Mode::Disabled;
+
+    // Recording writes every frame to file as soon as it ends.
+    FILE* m_recordFile = nullptr;
+    HeapArray<Input::Event> m_recordEvents;
+
+    // Playback reads frames in place from mapped file.
+    Platform::MappedFile m_playFile;
+    u64 m_playOffset = 0;
+    ReplayFrame m_playFrame;
+    const Input::Event* m_playEvents = nullptr;
+    HeapArray<f32> m_frameTimes;
+    HeapString m_timingsPath;
+
+    u64 m_frameCount = 0;
+
+public:
+    Replay() = default;
+    ~Replay();
+
+    bool Setup(const ReplayConfig& config);
+    void Shutdown();
+
+    // Recording hooks, called for every drained input event and once at the end of every frame.
+    void RecordEvent(const Input::Event& event);
+    void RecordFrame(f32 deltaTime, u32 width, u32 height);
+
+    // Playback hook called at the start of every frame with measured time of previous frame.
+    // Returns false once all recorded frames have been played or stream is malformed.
+    bool PlayFrame(f32 measuredDeltaTime);
+
+    // Pushes input events of current played frame, timestamped with current tick.
+    void PushEvents(Input::System& input) const;
+
+    const ReplayFrame& GetFrame() const
+    {
+        return m_playFrame;
+    }
+
+    u64 GetFrameCount() const
+    {
+        return m_frameCount;
+    }
+
+    const HeapArray<f32>& GetFrameTimes() const
+    {
+        return m_frameTimes;
+    }
+
+    Mode GetMode() const
+    {
+        return m_mode;
+    }
+
+    bool IsRecording() const
+    {
+        return m_mode == Mode::Record;
+    }
+
+    bool IsPlaying() const
+    {
+        return m_mode == Mode::Play;
+    }
+
+private:
+    void PrintPlaybackStats() const;
+    bool WriteTimings() const;
+};
@@ -0,0 +1,141 @@
+#include "Shared.hpp"
+#include "Resources/Archive.hpp"
+#include "Common/Utility/Compression.hpp"
+
+bool Resources::Archive::Open(const StringView& filePath)
+{
+    ASSERT(!IsOpen());
+    LOG_DEBUG("Opening archive: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+
+    if(!m_file.Open(filePath))
+    {
+        LOG_ERROR("Failed to open archive file: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    const u8* data = m_file.GetData();
+    const u64 size = m_file.GetSize();
+
+    ArchiveHeader header;
+    if(size < sizeof(header))
+    {
+        LOG_ERROR("Archive file is too small: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        Close();
+        return false;
+    }
+
+    std::memcpy(&header, data, sizeof(header));
+    if(header.magic != ArchiveHeader::Magic || header.version != ArchiveHeader::Version)
+    {
+        LOG_ERROR("Archive file has unsupported format: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        Close();
+        return false;
+    }
+
+    // Table and every entry are validated once here, so lookups can trust them afterwards.
+    // Sizes of compressed entries are bounded, so corrupted archive cannot request huge
+    // buffers for decompression that would only fail after they have been allocated.
+    const u64 tableSize = sizeof(header) + header.entryCount * sizeof(ArchiveEntry);
+    bool valid = header.entryCount <= size / sizeof(ArchiveEntry) && tableSize <= size
+        && header.namesOffset >= tableSize && header.namesSize <= size - std::min(header.namesOffset, size);
+
+    const ArchiveEntry* entries = reinterpret_cast<const ArchiveEntry*>(data + sizeof(header));
+    for(u64 i = 0; valid && i < header.entryCount; ++i)
+    {
+        const ArchiveEntry& entry = entries[i];
+        valid = entry.offset % ArchiveHeader::DataAlignment == 0
+            && entry.offset <= size && entry.storedSize <= size - entry.offset
+            && static_cast<u64>(entry.nameOffset) + entry.nameLength <= header.namesSize
+            && (entry.IsCompressed() || entry.storedSize == entry.size)
+            && entry.size <= ArchiveHeader::MaxEntrySize
+            && entry.size <= Compression::GetDecompressedBound(entry.storedSize)
+            && (i == 0 || entries[i - 1].hash < entry.hash);
+    }
+
+    if(!valid)
+    {
+        LOG_ERROR("Archive file is corrupted: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        Close();
+        return false;
+    }
+
+    m_entries = entries;
+    m_entryCount = header.entryCount;
+    m_names = reinterpret_cast<const char*>(data + header.namesOffset);
+
+    LOG_INFO("Opened archive with %llu entries: %.*s", m_entryCount, STRING_VIEW_PRINTF_ARG(filePath));
+    return true;
+}
+
+void Resources::Archive::Close()
+{
+    m_file.Close();
+    m_entries = nullptr;
+    m_entryCount = 0;
+    m_names = nullptr;
+}
+
+const Resources::ArchiveEntry* Resources::Archive::FindEntry(const StringView& path) const
+{
+    const u64 hash = StringId::Compute(path).GetHash();
+
+    u64 low = 0;
+    u64 high = m_entryCount;
+    while(low < high)
+    {
+        const u64 middle = low + (high - low) / 2;
+        if(m_entries[middle].hash < hash)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    // Hashes are unique within archive, so different name means path is not there.
+    if(low == m_entryCount || m_entries[low].hash != hash || GetName(m_entries[low]) != path)
+        return nullptr;
+
+    return &m_entries[low];
+}
+
+Optional<StringView> Resources::Archive::Read(const StringView& path, HeapArray<u8>& buffer) const
+{
+    const ArchiveEntry* entry = FindEntry(path);
+    if(entry == nullptr)
+        return {};
+
+    return Read(*entry, buffer);
+}
+
+Optional<StringView> Resources::Archive::Read(const ArchiveEntry& entry, HeapArray<u8>& buffer) const
+{
+    const StringView storedData = GetStoredData(entry);
+    if(!entry.IsCompressed())
+        return storedData;
+
+    buffer.Resize(entry.size);
+    if(!Compression::Decompress(reinterpret_cast<const u8*>(storedData.GetData()), storedData.GetLength(),
+        buffer.GetData(), buffer.GetSize()))
+    {
+        const StringView name = GetName(entry);
+        LOG_ERROR("Failed to decompress archive entry: %.*s", STRING_VIEW_PRINTF_ARG(name));
+        return {};
+    }
+
+    return StringView(reinterpret_cast<const char*>(buffer.GetData()), buffer.GetSize());
+}
+
+StringView Resources::Archive::GetStoredData(const ArchiveEntry& entry) const
+{
+    ASSERT(IsOpen());
+    return StringView(reinterpret_cast<const char*>(m_file.GetData() + entry.offset), entry.storedSize);
+}
+
+StringView Resources::Archive::GetName(const ArchiveEntry& entry) const
+{
+    ASSERT(IsOpen());
+    return StringView(m_names + entry.nameOffset, entry.nameLength);
+}
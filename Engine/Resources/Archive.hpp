@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Platform/MappedFile.hpp"
+
+namespace Resources
+{
+    // Archive starts with a header, followed by table of entries sorted by path hash, names
+    // of all entries and finally their data. Data of every entry starts at an offset aligned
+    // to sixteen bytes, so uncompressed data can be read in place from mapped archive as any
+    // type up to that alignment. Values are stored in native byte order, as archives are
+    // packed for the platform they are shipped with.
+    struct ArchiveHeader
+    {
+        static constexpr u32 Magic = 0x4B415042; // "BPAK"
+        static constexpr u32 Version = 1;
+        static constexpr u64 DataAlignment = 16;
+        static constexpr u64 MaxEntrySize = 1ull << 30;
+
+        u32 magic = Magic;
+        u32 version = Version;
+        u64 entryCount = 0;
+        u64 namesOffset = 0;
+        u64 namesSize = 0;
+    };
+
+    struct ArchiveEntry
+    {
+        enum Flags : u32
+        {
+            Compressed = 1 << 0,
+        };
+
+        u64 hash = 0; // Hash of path, same as its string identifier
+        u64 offset = 0;
+        u64 storedSize = 0;
+        u64 size = 0;
+        u32 nameOffset = 0;
+        u32 nameLength = 0;
+        u32 flags = 0;
+        u32 reserved = 0;
+
+        bool IsCompressed() const
+        {
+            return flags & Compressed;
+        }
+    };
+
+    static_assert(sizeof(ArchiveHeader) % ArchiveHeader::DataAlignment == 0);
+    static_assert(sizeof(ArchiveEntry) % ArchiveHeader::DataAlignment == 0);
+
+    // Read-only archive mapped into memory as a whole, which replaces opening many loose files
+    // with a single mapping. Paths are resolved with binary search over table of path hashes,
+    // without touching the file system. Archive can be read from any thread once opened.
+    class Archive final : NonCopyable
+    {
+        Platform::MappedFile m_file;
+        const ArchiveEntry* m_entries = nullptr;
+        u64 m_entryCount = 0;
+        const char* m_names = nullptr;
+
+    public:
+        Archive() = default;
+
+        bool Open(const StringView& filePath);
+        void Close();
+
+        // Returns null when path is not part of archive.
+        const ArchiveEntry* FindEntry(const StringView& path) const;
+
+        // Returns data of entry in place for uncompressed entry, while compressed entry is
+        // decompressed into buffer first. Returns nothing when path is not part of archive.
+        Optional<StringView> Read(const StringView& path, HeapArray<u8>& buffer) const;
+        Optional<StringView> Read(const ArchiveEntry& entry, HeapArray<u8>& buffer) const;
+
+        // Data as stored in archive, which is compressed for compressed entries.
+        StringView GetStoredData(const ArchiveEntry& entry) const;
+        StringView GetName(const ArchiveEntry& entry) const;
+
+        const ArchiveEntry* GetEntries() const
+        {
+            return m_entries;
+        }
+
+        u64 GetEntryCount() const
+        {
+            return m_entryCount;
+        }
+
+        bool IsOpen() const
+        {
+            return m_file.IsOpen();
+        }
+    };
+}
@@ -0,0 +1,162 @@
+#include "Shared.hpp"
+#include "Resources/ArchiveWriter.hpp"
+#include "Resources/Archive.hpp"
+#include "Common/Algorithms/Sorting.hpp"
+#include "Common/Utility/Compression.hpp"
+
+bool Resources::ArchiveWriter::AddFile(const StringView& path, const StringView& contents, const bool compress)
+{
+    ASSERT(!path.IsEmpty());
+
+    if(contents.GetLength() > ArchiveHeader::MaxEntrySize)
+    {
+        LOG_ERROR("Archive file \"%.*s\" is too large", STRING_VIEW_PRINTF_ARG(path));
+        return false;
+    }
+
+    File& file = m_files.Add();
+    file.hash = StringId::Compute(path).GetHash();
+    file.path = path;
+    file.size = contents.GetLength();
+
+    const u8* data = reinterpret_cast<const u8*>(contents.GetData());
+    if(compress && !contents.IsEmpty())
+    {
+        file.data.Resize(Compression::GetCompressedBound(file.size));
+        const u64 compressedSize = Compression::Compress(data, file.size, file.data.GetData(), file.data.GetSize());
+        if(compressedSize != 0 && compressedSize < file.size)
+        {
+            file.data.Resize(compressedSize);
+            file.compressed = true;
+            return true;
+        }
+
+        file.data.Clear();
+    }
+
+    file.data.Resize(file.size);
+    std::memcpy(file.data.GetData(), data, file.size);
+    return true;
+}
+
+bool Resources::ArchiveWriter::Write(const StringView& filePath)
+{
+    LOG_DEBUG("Writing archive: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+
+    // Entries are sorted by hash for binary search at runtime.
+    HeapArray<const File*> files;
+    HeapArray<const File*> scratch;
+    files.Reserve(m_files.GetSize());
+    scratch.Resize(m_files.GetSize(), nullptr);
+    for(const File& file : m_files)
+    {
+        files.Add(&file);
+    }
+
+    RadixSort(files.GetBeginPtr(), files.GetEndPtr(), scratch.GetBeginPtr(), [](const File* file)
+    {
+        return file->hash;
+    });
+
+    // Equal hashes end up next to each other after sorting.
+    for(u64 i = 1; i < files.GetSize(); ++i)
+    {
+        if(files[i - 1]->hash == files[i]->hash)
+        {
+            LOG_ERROR("Archive path \"%s\" collides with \"%s\"", *files[i]->path, *files[i - 1]->path);
+            return false;
+        }
+    }
+
+    ArchiveHeader header;
+    header.entryCount = files.GetSize();
+    header.namesOffset = sizeof(ArchiveHeader) + files.GetSize() * sizeof(ArchiveEntry);
+    for(const File* file : files)
+    {
+        header.namesSize += file->path.GetLength();
+    }
+
+    if(header.namesSize > std::numeric_limits<u32>::max())
+    {
+        LOG_ERROR("Archive paths exceed maximum total length: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    auto AlignOffset = [](const u64 offset)
+    {
+        return (offset + ArchiveHeader::DataAlignment - 1) & ~(ArchiveHeader::DataAlignment - 1);
+    };
+
+    u64 archiveSize = AlignOffset(header.namesOffset + header.namesSize);
+    for(const File* file : files)
+    {
+        archiveSize = AlignOffset(archiveSize + file->data.GetSize());
+    }
+
+    HeapArray<u8> archive;
+    archive.Resize(archiveSize, static_cast<u8>(0));
+    std::memcpy(archive.GetData(), &header, sizeof(header));
+
+    ArchiveEntry* entries = reinterpret_cast<ArchiveEntry*>(archive.GetData() + sizeof(header));
+    u64 nameOffset = 0;
+    u64 dataOffset = AlignOffset(header.namesOffset + header.namesSize);
+    for(u64 i = 0; i < files.GetSize(); ++i)
+    {
+        const File& file = *files[i];
+        ArchiveEntry& entry = entries[i];
+        entry.hash = file.hash;
+        entry.offset = dataOffset;
+        entry.storedSize = file.data.GetSize();
+        entry.size = file.size;
+        entry.nameOffset = static_cast<u32>(nameOffset);
+        entry.nameLength = static_cast<u32>(file.path.GetLength());
+        entry.flags = file.compressed ? ArchiveEntry::Compressed : 0;
+
+        std::memcpy(archive.GetData() + header.namesOffset + nameOffset, file.path.GetData(), file.path.GetLength());
+        std::memcpy(archive.GetData() + dataOffset, file.data.GetData(), file.data.GetSize());
+        nameOffset += file.path.GetLength();
+        dataOffset = AlignOffset(dataOffset + file.data.GetSize());
+    }
+
+    ASSERT(dataOffset == archiveSize);
+    if(!WriteStringToFileAtomic(filePath, StringView(reinterpret_cast<const char*>(archive.GetData()), archive.GetSize())))
+    {
+        LOG_ERROR("Failed to write archive file: %.*s", STRING_VIEW_PRINTF_ARG(filePath));
+        return false;
+    }
+
+    return true;
+}
+
+u64 Resources::ArchiveWriter::GetCompressedCount() const
+{
+    u64 count = 0;
+    for(const File& file : m_files)
+    {
+        count += file.compressed ? 1 : 0;
+    }
+
+    return count;
+}
+
+u64 Resources::ArchiveWriter::GetStoredSize() const
+{
+    u64 size = 0;
+    for(const File& file : m_files)
+    {
+        size += file.data.GetSize();
+    }
+
+    return size;
+}
+
+u64 Resources::ArchiveWriter::GetSize() const
+{
+    u64 size = 0;
+    for(const File& file : m_files)
+    {
+        size += file.size;
+    }
+
+    return size;
+}
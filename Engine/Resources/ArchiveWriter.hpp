@@ -0,0 +1,38 @@
+#pragma once
+
+namespace Resources
+{
+    // Collects files in memory and writes them out as an archive in one go.
+    // Used offline by packer tool, and by tests to create archives on the fly.
+    class ArchiveWriter final : NonCopyable
+    {
+        struct File
+        {
+            u64 hash = 0;
+            HeapString path;
+            HeapArray<u8> data;
+            u64 size = 0;
+            bool compressed = false;
+        };
+
+        HeapArray<File> m_files;
+
+    public:
+        ArchiveWriter() = default;
+
+        // Compressed data is only kept if it is smaller than original contents.
+        bool AddFile(const StringView& path, const StringView& contents, bool compress);
+
+        // Fails for paths that are added more than once or collide with hash of another path.
+        bool Write(const StringView& filePath);
+
+        u64 GetFileCount() const
+        {
+            return m_files.GetSize();
+        }
+
+        u64 GetCompressedCount() const;
+        u64 GetStoredSize() const;
+        u64 GetSize() const;
+    };
+}
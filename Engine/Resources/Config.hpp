@@ -0,0 +1,13 @@
+#pragma once
+
+namespace Resources
+{
+    struct ManagerConfig
+    {
+        // Memory used by loaded resources above which unused ones are evicted.
+        u64 memoryBudget = 256 * 1024 * 1024;
+
+        // Threads that read files and create resources in the background, zero loads on main thread.
+        u32 workerCount = 2;
+    };
+}
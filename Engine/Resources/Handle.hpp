@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Resources/Resource.hpp"
+
+namespace Resources
+{
+    // Typed reference to cached resource, which keeps it from being evicted. Handles are
+    // returned immediately while resource is still loading, and must only be used from
+    // the main thread, as resource manager updates their entries there.
+    template<typename Type>
+    class Handle final
+    {
+        friend class Manager;
+
+        Entry* m_entry = nullptr;
+
+        explicit Handle(Entry* entry)
+            : m_entry(entry)
+        {
+            ASSERT(m_entry);
+            m_entry->AddHandle();
+        }
+
+    public:
+        Handle() = default;
+
+        Handle(const Handle& other)
+            : m_entry(other.m_entry)
+        {
+            if(m_entry)
+            {
+                m_entry->AddHandle();
+            }
+        }
+
+        Handle(Handle&& other) noexcept
+            : m_entry(other.m_entry)
+        {
+            other.m_entry = nullptr;
+        }
+
+        ~Handle()
+        {
+            Reset();
+        }
+
+        Handle& operator=(const Handle& other)
+        {
+            Handle(other).Swap(*this);
+            return *this;
+        }
+
+        Handle& operator=(Handle&& other) noexcept
+        {
+            Handle(Move(other)).Swap(*this);
+            return *this;
+        }
+
+        bool operator==(const Handle& other) const
+        {
+            return m_entry == other.m_entry;
+        }
+
+        bool operator!=(const Handle& other) const
+        {
+            return m_entry != other.m_entry;
+        }
+
+        Type* operator->() const
+        {
+            ASSERT(IsLoaded());
+            return Get();
+        }
+
+        // Returns null until resource has been loaded.
+        Type* Get() const
+        {
+            return IsLoaded() ? static_cast<Type*>(m_entry->m_resource.Get()) : nullptr;
+        }
+
+        void Reset()
+        {
+            if(m_entry)
+            {
+                Entry* entry = m_entry;
+                m_entry = nullptr;
+                entry->ReleaseHandle();
+            }
+        }
+
+        void Swap(Handle& other)
+        {
+            Entry* entry = m_entry;
+            m_entry = other.m_entry;
+            other.m_entry = entry;
+        }
+
+        StringId GetId() const
+        {
+            ASSERT(IsValid());
+            return m_entry->m_id;
+        }
+
+        Status GetStatus() const
+        {
+            ASSERT(IsValid());
+            return m_entry->m_status;
+        }
+
+        bool IsLoaded() const
+        {
+            return m_entry && m_entry->m_status == Status::Loaded;
+        }
+
+        bool IsValid() const
+        {
+            return m_entry != nullptr;
+        }
+    };
+}
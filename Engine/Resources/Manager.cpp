@@ -0,0 +1,508 @@
+#include "Shared.hpp"
+#include "Resources/Manager.hpp"
+#include "Resources/Config.hpp"
+#include "Resources/Archive.hpp"
+#include "Platform/MappedFile.hpp"
+#include "Platform/Time.hpp"
+
+void Resources::Entry::AddHandle()
+{
+    if(m_handleCount++ == 0)
+    {
+        m_manager->OnHandlesAdded(this);
+    }
+}
+
+void Resources::Entry::ReleaseHandle()
+{
+    ASSERT(m_handleCount > 0);
+    if(--m_handleCount == 0)
+    {
+        m_manager->OnHandlesReleased(this);
+    }
+}
+
+void Resources::Stats::Print() const
+{
+    LOG_INFO("Resource stats:");
+    LOG_NO_SOURCE_LINE_SCOPE();
+    LOG_INFO("  Requests: %llu (hit rate: %.1f%%, in-flight dedups: %llu)",
+        requestCount, GetHitRate() * 100.0f, dedupCount);
+    LOG_INFO("  Loads: %llu (failed: %llu, evicted: %llu)", loadCount, failCount, evictCount);
+    LOG_INFO("  Load latency: %.2fms average, %.2fms max", GetAverageLatency() * 1000.0f, maxLatency * 1000.0f);
+}
+
+Resources::Manager::~Manager()
+{
+    Shutdown();
+}
+
+bool Resources::Manager::Setup(const ManagerConfig& config)
+{
+    ASSERT(!m_setup);
+    LOG_DEBUG("Setting up resource manager...");
+
+    m_memoryBudget = config.memoryBudget;
+    m_table.Resize(InitialTableCapacity, nullptr);
+
+    if(config.workerCount > 0)
+    {
+        Thread::Config workerConfig;
+        workerConfig.name = "Resource Worker";
+
+        m_workers.Reserve(config.workerCount);
+        for(u32 i = 0; i < config.workerCount; ++i)
+        {
+            m_workers.Add(Thread::Create(workerConfig, [this]()
+            {
+                WorkerThread();
+            }));
+        }
+
+        LOG_INFO("Using %u worker thread(s) for resource loading", config.workerCount);
+    }
+    else
+    {
+        LOG_INFO("Using main thread for resource loading");
+    }
+
+    LOG_SUCCESS("Resource manager setup complete");
+    return m_setup = true;
+}
+
+void Resources::Manager::Shutdown()
+{
+    if(!m_setup)
+        return;
+
+    // Loads already queued are finished before workers exit.
+    {
+        Thread::ScopedLock lock(m_loadMutex);
+        m_exiting = true;
+    }
+
+    m_loadCondition.NotifyAll();
+    for(Thread::Handle& worker : m_workers)
+    {
+        worker.Join();
+    }
+
+    m_workers.Clear();
+    m_archives.Clear();
+    Update();
+
+    for(Entry*& entry : m_table)
+    {
+        if(entry)
+        {
+            ASSERT(entry->m_handleCount == 0, "Resource handle outlives resource manager");
+            m_memoryUsage -= entry->m_memorySize;
+            Memory::Delete(entry);
+            entry = nullptr;
+        }
+    }
+
+    ASSERT(m_memoryUsage == 0);
+    ASSERT(m_loadingCount == 0);
+    m_entryCount = 0;
+    m_unusedHead = nullptr;
+    m_unusedTail = nullptr;
+    m_exiting = false;
+    m_setup = false;
+}
+
+void Resources::Manager::Update()
+{
+    Entry* entry;
+    {
+        Thread::ScopedLock lock(m_completionMutex);
+        entry = m_completionHead;
+        m_completionHead = nullptr;
+        m_completionTail = nullptr;
+    }
+
+    while(entry != nullptr)
+    {
+        Entry* next = entry->m_next;
+        entry->m_next = nullptr;
+        FinishLoad(entry);
+        entry = next;
+    }
+
+    EvictUnused();
+}
+
+void Resources::Manager::WaitAll()
+{
+    while(m_loadingCount > 0)
+    {
+        {
+            Thread::ScopedLock lock(m_completionMutex);
+            m_completionCondition.Wait(m_completionMutex, [this]()
+            {
+                return m_completionHead != nullptr;
+            });
+        }
+
+        Update();
+    }
+}
+
+void Resources::Manager::MountArchive(const Archive* archive)
+{
+    ASSERT(archive && archive->IsOpen());
+    ASSERT(m_loadingCount == 0, "Archive mounted while workers may be reading mounted archives");
+    m_archives.Add(archive);
+}
+
+void Resources::Manager::SetMemoryBudget(const u64 memoryBudget)
+{
+    m_memoryBudget = memoryBudget;
+    EvictUnused();
+}
+
+Resources::Entry* Resources::Manager::Request(const StringView& path, const Entry::CreateFunction createFunction)
+{
+    ASSERT(m_setup);
+    ASSERT(!path.IsEmpty());
+
+    const StringId id = StringId::Compute(path);
+    ++m_stats.requestCount;
+
+    if(Entry* entry = FindEntry(id))
+    {
+        ASSERT(entry->m_createFunction == createFunction, "Resource path requested with different type");
+        ASSERT_SLOW(entry->m_path == path, "Resource path hash collision");
+
+        if(entry->m_status == Status::Loading)
+        {
+            ++m_stats.dedupCount;
+        }
+        else
+        {
+            ++m_stats.hitCount;
+        }
+
+        return entry;
+    }
+
+    Entry* entry = Memory::New<Entry>();
+    entry->m_manager = this;
+    entry->m_id = id;
+    entry->m_path = path;
+    entry->m_createFunction = createFunction;
+    entry->m_requestTick = Time::GetCurrentTick();
+    InsertEntry(entry);
+    ++m_loadingCount;
+
+    // Without workers entry is loaded right away, but still finished during next update.
+    if(m_workers.IsEmpty())
+    {
+        LoadEntry(entry);
+        CompleteEntry(entry);
+        return entry;
+    }
+
+    {
+        Thread::ScopedLock lock(m_loadMutex);
+        if(m_loadTail != nullptr)
+        {
+            m_loadTail->m_next = entry;
+        }
+        else
+        {
+            m_loadHead = entry;
+        }
+
+        m_loadTail = entry;
+    }
+
+    m_loadCondition.NotifyOne();
+    return entry;
+}
+
+void Resources::Manager::WaitForEntry(const Entry* entry)
+{
+    while(entry->m_status == Status::Loading)
+    {
+        {
+            Thread::ScopedLock lock(m_completionMutex);
+            m_completionCondition.Wait(m_completionMutex, [this]()
+            {
+                return m_completionHead != nullptr;
+            });
+        }
+
+        Update();
+    }
+}
+
+void Resources::Manager::FinishLoad(Entry* entry)
+{
+    ASSERT(entry->m_status == Status::Loading);
+    ASSERT(m_loadingCount > 0);
+    --m_loadingCount;
+
+    const f32 latency = Time::ConvertTicksToSeconds(entry->m_completeTick - entry->m_requestTick);
+    m_stats.totalLatency += latency;
+    m_stats.maxLatency = std::max(m_stats.maxLatency, latency);
+
+    if(entry->m_loadSucceeded)
+    {
+        entry->m_status = Status::Loaded;
+        entry->m_memorySize = entry->m_resource->GetMemorySize();
+        m_memoryUsage += entry->m_memorySize;
+        ++m_stats.loadCount;
+    }
+    else
+    {
+        // Failed entry stays cached only while it has handles, so the path can be loaded again.
+        LOG_ERROR("Failed to load resource: %s", *entry->m_path);
+        entry->m_status = Status::Failed;
+        ++m_stats.failCount;
+    }
+
+    if(entry->m_handleCount == 0)
+    {
+        OnHandlesReleased(entry);
+    }
+}
+
+void Resources::Manager::EvictUnused()
+{
+    while(m_memoryUsage > m_memoryBudget && m_unusedHead != nullptr)
+    {
+        Entry* entry = m_unusedHead;
+        UnlinkUnused(entry);
+        RemoveEntry(entry);
+        DestroyEntry(entry);
+        ++m_stats.evictCount;
+    }
+}
+
+void Resources::Manager::OnHandlesAdded(Entry* entry)
+{
+    if(entry->m_status == Status::Loaded)
+    {
+        UnlinkUnused(entry);
+    }
+}
+
+void Resources::Manager::OnHandlesReleased(Entry* entry)
+{
+    // Entry still loading is handled once its load finishes.
+    if(entry->m_status == Status::Loaded)
+    {
+        LinkUnused(entry);
+    }
+    else if(entry->m_status == Status::Failed)
+    {
+        RemoveEntry(entry);
+        DestroyEntry(entry);
+    }
+}
+
+void Resources::Manager::LinkUnused(Entry* entry)
+{
+    ASSERT_SLOW(entry->m_previous == nullptr && entry->m_next == nullptr);
+
+    entry->m_previous = m_unusedTail;
+    if(m_unusedTail != nullptr)
+    {
+        m_unusedTail->m_next = entry;
+    }
+    else
+    {
+        m_unusedHead = entry;
+    }
+
+    m_unusedTail = entry;
+}
+
+void Resources::Manager::UnlinkUnused(Entry* entry)
+{
+    if(entry->m_previous != nullptr)
+    {
+        entry->m_previous->m_next = entry->m_next;
+    }
+    else
+    {
+        ASSERT_SLOW(m_unusedHead == entry);
+        m_unusedHead = entry->m_next;
+    }
+
+    if(entry->m_next != nullptr)
+    {
+        entry->m_next->m_previous = entry->m_previous;
+    }
+    else
+    {
+        ASSERT_SLOW(m_unusedTail == entry);
+        m_unusedTail = entry->m_previous;
+    }
+
+    entry->m_previous = nullptr;
+    entry->m_next = nullptr;
+}
+
+Resources::Entry* Resources::Manager::FindEntry(const StringId id) const
+{
+    if(m_table.IsEmpty())
+        return nullptr;
+
+    const u64 mask = m_table.GetSize() - 1;
+    for(u64 index = id.GetHash() & mask;; index = (index + 1) & mask)
+    {
+        Entry* entry = m_table[index];
+        if(entry == nullptr || entry->m_id == id)
+            return entry;
+    }
+}
+
+void Resources::Manager::InsertEntry(Entry* entry)
+{
+    // Table is kept at most three quarters full, so probe sequences stay short.
+    if((m_entryCount + 1) * 4 > m_table.GetSize() * 3)
+    {
+        HeapArray<Entry*> oldTable = Move(m_table);
+        m_table.Resize(oldTable.GetSize() * 2, nullptr);
+        m_entryCount = 0;
+
+        for(Entry* oldEntry : oldTable)
+        {
+            if(oldEntry)
+            {
+                InsertEntry(oldEntry);
+            }
+        }
+    }
+
+    const u64 mask = m_table.GetSize() - 1;
+    u64 index = entry->m_id.GetHash() & mask;
+    while(m_table[index] != nullptr)
+    {
+        index = (index + 1) & mask;
+    }
+
+    m_table[index] = entry;
+    ++m_entryCount;
+}
+
+void Resources::Manager::RemoveEntry(Entry* entry)
+{
+    const u64 mask = m_table.GetSize() - 1;
+    u64 index = entry->m_id.GetHash() & mask;
+    while(m_table[index] != entry)
+    {
+        index = (index + 1) & mask;
+    }
+
+    // Following entries are shifted back into the hole if it lies on their probe sequence,
+    // which keeps every entry reachable without leaving tombstones behind.
+    u64 next = index;
+    while(true)
+    {
+        next = (next + 1) & mask;
+        Entry* nextEntry = m_table[next];
+        if(nextEntry == nullptr)
+            break;
+
+        const u64 home = nextEntry->m_id.GetHash() & mask;
+        if(((next - home) & mask) >= ((next - index) & mask))
+        {
+            m_table[index] = nextEntry;
+            index = next;
+        }
+    }
+
+    m_table[index] = nullptr;
+    --m_entryCount;
+}
+
+void Resources::Manager::DestroyEntry(Entry* entry)
+{
+    ASSERT(entry->m_handleCount == 0);
+    ASSERT(entry->m_status != Status::Loading);
+
+    ASSERT(m_memoryUsage >= entry->m_memorySize);
+    m_memoryUsage -= entry->m_memorySize;
+    Memory::Delete(entry);
+}
+
+void Resources::Manager::LoadEntry(Entry* entry)
+{
+    // Entry is not touched by main thread until it is completed.
+    Optional<StringView> contents;
+    HeapArray<u8> buffer;
+    bool archived = false;
+    for(const Archive* archive : m_archives)
+    {
+        if(const ArchiveEntry* archiveEntry = archive->FindEntry(entry->m_path))
+        {
+            contents = archive->Read(*archiveEntry, buffer);
+            archived = true;
+            break;
+        }
+    }
+
+    Platform::MappedFile file;
+    if(!archived && file.Open(entry->m_path))
+    {
+        contents = file.GetStringView();
+    }
+
+    UniquePtr<Resource> resource = entry->m_createFunction();
+    entry->m_loadSucceeded = contents && resource->Load(
+        reinterpret_cast<const u8*>(contents->GetData()), contents->GetLength());
+    entry->m_resource = entry->m_loadSucceeded ? Move(resource) : nullptr;
+    entry->m_completeTick = Time::GetCurrentTick();
+}
+
+void Resources::Manager::CompleteEntry(Entry* entry)
+{
+    {
+        Thread::ScopedLock lock(m_completionMutex);
+        if(m_completionTail != nullptr)
+        {
+            m_completionTail->m_next = entry;
+        }
+        else
+        {
+            m_completionHead = entry;
+        }
+
+        m_completionTail = entry;
+    }
+
+    m_completionCondition.NotifyAll();
+}
+
+void Resources::Manager::WorkerThread()
+{
+    while(true)
+    {
+        Entry* entry;
+        {
+            Thread::ScopedLock lock(m_loadMutex);
+            m_loadCondition.Wait(m_loadMutex, [this]()
+            {
+                return m_loadHead != nullptr || m_exiting;
+            });
+
+            entry = m_loadHead;
+            if(entry == nullptr)
+                return;
+
+            m_loadHead = entry->m_next;
+            if(m_loadHead == nullptr)
+            {
+                m_loadTail = nullptr;
+            }
+
+            entry->m_next = nullptr;
+        }
+
+        LoadEntry(entry);
+        CompleteEntry(entry);
+    }
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Resources/Handle.hpp"
+
+namespace Resources
+{
+    struct ManagerConfig;
+    class Archive;
+
+    struct Stats
+    {
+        u64 requestCount = 0;
+        u64 hitCount = 0; // Requests for already loaded resources
+        u64 dedupCount = 0; // Requests joining load already in flight
+        u64 loadCount = 0;
+        u64 failCount = 0;
+        u64 evictCount = 0;
+        f32 totalLatency = 0.0f;
+        f32 maxLatency = 0.0f;
+
+        // Share of requests served without starting a new load.
+        f32 GetHitRate() const
+        {
+            return requestCount > 0 ? static_cast<f32>(hitCount + dedupCount) / requestCount : 0.0f;
+        }
+
+        // Time from request until worker finished loading, over all finished loads.
+        f32 GetAverageLatency() const
+        {
+            const u64 finishedCount = loadCount + failCount;
+            return finishedCount > 0 ? totalLatency / finishedCount : 0.0f;
+        }
+
+        void Print() const;
+    };
+
+    // Caches resources keyed by hash of their path, loading them in the background on worker
+    // threads, or right away on the main thread when there are no workers. Requests for a path
+    // that is already cached or loading share the same entry, so every path is loaded only once.
+    // Resources without any handles stay cached in least recently used order, and are evicted
+    // oldest first while memory budget is exceeded. Failed loads are dropped once unused,
+    // so the path is loaded again on next request.
+    // All functions must be called from the main thread, while workers only load resources
+    // and hand them back to be finished during the next update.
+    class Manager final : NonCopyable
+    {
+        // Open addressing table with linear probing, where each entry is placed
+        // as close as possible after the slot its path hash maps to.
+        HeapArray<Entry*> m_table;
+        u64 m_entryCount = 0;
+
+        Entry* m_unusedHead = nullptr;
+        Entry* m_unusedTail = nullptr;
+        u64 m_memoryBudget = 0;
+        u64 m_memoryUsage = 0;
+        u64 m_loadingCount = 0;
+
+        Thread::Mutex m_loadMutex;
+        Thread::ConditionVariable m_loadCondition;
+        Entry* m_loadHead = nullptr;
+        Entry* m_loadTail = nullptr;
+        bool m_exiting = false;
+
+        Thread::Mutex m_completionMutex;
+        Thread::ConditionVariable m_completionCondition;
+        Entry* m_completionHead = nullptr;
+        Entry* m_completionTail = nullptr;
+
+        HeapArray<const Archive*> m_archives;
+        HeapArray<Thread::Handle> m_workers;
+        Stats m_stats;
+        bool m_setup = false;
+
+    public:
+        static constexpr u64 InitialTableCapacity = 64;
+
+        Manager() = default;
+        ~Manager();
+
+        bool Setup(const ManagerConfig& config);
+        void Shutdown();
+
+        // Returns handle right away, while resource may still be loading.
+        template<typename Type>
+        Handle<Type> Load(const StringView& path)
+        {
+            static_assert(std::is_base_of_v<Resource, Type>, "Type must derive from resource");
+            return Handle<Type>(Request(path, &CreateResource<Type>));
+        }
+
+        // Finishes loads completed by workers, and evicts unused resources over budget.
+        void Update();
+
+        // Blocks until resource has finished loading, also finishing other loads on the way.
+        template<typename Type>
+        void Wait(const Handle<Type>& handle)
+        {
+            ASSERT(handle.IsValid());
+            WaitForEntry(handle.m_entry);
+        }
+
+        void WaitAll();
+
+        // Mounted archives are searched in mounting order before falling back to loose files.
+        // Archive must outlive the manager, and can only be mounted while nothing is loading.
+        void MountArchive(const Archive* archive);
+
+        void SetMemoryBudget(u64 memoryBudget);
+
+        u64 GetMemoryBudget() const
+        {
+            return m_memoryBudget;
+        }
+
+        u64 GetMemoryUsage() const
+        {
+            return m_memoryUsage;
+        }
+
+        u64 GetEntryCount() const
+        {
+            return m_entryCount;
+        }
+
+        const Stats& GetStats() const
+        {
+            return m_stats;
+        }
+
+        bool IsCached(StringId id) const
+        {
+            return FindEntry(id) != nullptr;
+        }
+
+    private:
+        friend class Entry;
+
+        template<typename Type>
+        static UniquePtr<Resource> CreateResource()
+        {
+            return UniquePtr<Resource>(Memory::New<Type>());
+        }
+
+        Entry* Request(const StringView& path, Entry::CreateFunction createFunction);
+        void WaitForEntry(const Entry* entry);
+        void FinishLoad(Entry* entry);
+        void EvictUnused();
+
+        void OnHandlesAdded(Entry* entry);
+        void OnHandlesReleased(Entry* entry);
+        void LinkUnused(Entry* entry);
+        void UnlinkUnused(Entry* entry);
+
+        Entry* FindEntry(StringId id) const;
+        void InsertEntry(Entry* entry);
+        void RemoveEntry(Entry* entry);
+        void DestroyEntry(Entry* entry);
+
+        void LoadEntry(Entry* entry);
+        void CompleteEntry(Entry* entry);
+        void WorkerThread();
+    };
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+namespace Resources
+{
+    class Manager;
+
+    template<typename Type>
+    class Handle;
+
+    enum class Status : u8
+    {
+        Loading,
+        Loaded,
+        Failed,
+    };
+
+    // Base of all resource types, which create themselves from file contents. Loading runs
+    // on worker thread, so it must not touch any state shared with the rest of the engine.
+    // Contents are only valid for the duration of the call and must be copied if needed.
+    class Resource : NonCopyable
+    {
+    public:
+        virtual ~Resource() = default;
+
+        virtual bool Load(const u8* data, u64 size) = 0;
+
+        // Memory owned by the resource, which counts towards budget of resource manager.
+        virtual u64 GetMemorySize() const = 0;
+    };
+
+    // Cache entry of a single resource path, owned by resource manager. Entry is shared
+    // by all handles to the same path and stays cached after the last handle is released,
+    // until it gets evicted. All members are only accessed from the main thread, except
+    // for loading results, which are handed over together with the entry under a lock.
+    class Entry final : NonCopyable
+    {
+        friend class Manager;
+
+        template<typename Type>
+        friend class Handle;
+
+        using CreateFunction = UniquePtr<Resource>(*)();
+
+        Manager* m_manager = nullptr;
+        StringId m_id;
+        ImmutableString m_path;
+        CreateFunction m_createFunction = nullptr;
+        UniquePtr<Resource> m_resource;
+        Status m_status = Status::Loading;
+        u64 m_memorySize = 0;
+        u32 m_handleCount = 0;
+
+        // Written by worker thread once loading finishes.
+        bool m_loadSucceeded = false;
+        u64 m_requestTick = 0;
+        u64 m_completeTick = 0;
+
+        // Links of either load queue or completion queue while loading, and of least
+        // recently used list while loaded without any handles.
+        Entry* m_previous = nullptr;
+        Entry* m_next = nullptr;
+
+    public:
+        Entry() = default;
+
+    private:
+        void AddHandle();
+        void ReleaseHandle();
+    };
+}
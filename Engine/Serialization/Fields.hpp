@@ -0,0 +1,64 @@
+#pragma once
+
+// Declares fields of a type for serialization and other visitors, resolved at compile time:
+//
+//     struct SaveGame
+//     {
+//         u32 level = 0;
+//         HeapString name;
+//         HeapArray<u32> items;
+//
+//         SERIALIZATION_FIELDS()
+//         {
+//             SERIALIZATION_FIELD(level);
+//             SERIALIZATION_FIELD(name);
+//             SERIALIZATION_FIELD_SINCE(items, 2);
+//         }
+//     };
+//
+// Fields are visited in declaration order, which also defines their order in binary archive.
+// Fields added in later archive versions are left untouched when reading older archives.
+// Visitor receives name of every field, so the same declaration can also drive debug printing.
+#define SERIALIZATION_FIELDS() \
+    template<typename Self, typename Visitor> \
+    static void VisitFields(Self& self, Visitor& visitor)
+
+#define SERIALIZATION_FIELD(field) \
+    visitor.Field(#field, self.field, 0)
+
+#define SERIALIZATION_FIELD_SINCE(field, version) \
+    visitor.Field(#field, self.field, version)
+
+namespace Serialization
+{
+    template<typename Type, typename Visitor>
+    concept HasFields = requires(Type& value, Visitor& visitor)
+    {
+        Type::VisitFields(value, visitor);
+    };
+
+    // Plain elements of arrays and spans are aligned to this many bytes at most.
+    constexpr u64 MaxElementAlignment = 16;
+
+    template<typename Type>
+    constexpr bool IsArray = false;
+
+    template<typename Type, typename Allocator>
+    constexpr bool IsArray<Array<Type, Allocator>> = true;
+
+    template<typename Type>
+    constexpr bool IsString = false;
+
+    template<typename Allocator>
+    constexpr bool IsString<StringBase<char, Allocator>> = true;
+
+    template<typename Type>
+    constexpr bool IsSpan = false;
+
+    template<typename Type>
+    constexpr bool IsSpan<Span<const Type>> = true;
+
+    // Elements that are stored as raw fixed-width bytes in arrays and spans.
+    template<typename Type>
+    constexpr bool IsPlainElement = std::is_arithmetic_v<Type> || std::is_enum_v<Type>;
+}
@@ -0,0 +1,114 @@
+#include "Shared.hpp"
+#include "Serialization/Reader.hpp"
+
+Serialization::Reader::Reader(const u8* data, const u64 size)
+    : m_data(data)
+    , m_size(size)
+{
+    ASSERT(m_data || m_size == 0);
+}
+
+Serialization::Reader::Reader(const StringView& data)
+    : Reader(reinterpret_cast<const u8*>(data.GetData()), data.GetLength())
+{
+}
+
+Serialization::Reader::Reader(const HeapArray<u8>& data)
+    : Reader(data.GetData(), data.GetSize())
+{
+}
+
+bool Serialization::Reader::ReadHeader(const u32 magic, const u32 maxVersion)
+{
+    ASSERT(m_offset == 0, "Header must be read first");
+    const u32 readMagic = ReadFixed<u32>();
+    const u32 readVersion = ReadFixed<u32>();
+    if(m_failed || readMagic != magic || readVersion > maxVersion)
+    {
+        Fail();
+        return false;
+    }
+
+    m_version = readVersion;
+    return true;
+}
+
+bool Serialization::Reader::ReadBytes(void* data, const u64 size)
+{
+    const u8* bytes = Consume(size, 1);
+    if(m_failed)
+        return false;
+
+    if(size != 0)
+    {
+        std::memcpy(data, bytes, size);
+    }
+
+    return true;
+}
+
+u64 Serialization::Reader::ReadVarUInt()
+{
+    u64 value = 0;
+    for(u32 shift = 0; shift < 64; shift += 7)
+    {
+        if(m_failed || m_offset == m_size)
+            break;
+
+        const u8 byte = m_data[m_offset++];
+        value |= static_cast<u64>(byte & 0x7F) << shift;
+        if((byte & 0x80) == 0)
+        {
+            // Last of ten bytes can only carry the highest bit.
+            if(shift == 63 && byte > 1)
+                break;
+
+            return value;
+        }
+    }
+
+    Fail();
+    return 0;
+}
+
+i64 Serialization::Reader::ReadVarInt()
+{
+    const u64 value = ReadVarUInt();
+    return static_cast<i64>(value >> 1) ^ -static_cast<i64>(value & 1);
+}
+
+StringView Serialization::Reader::ReadString()
+{
+    const u64 length = ReadVarUInt();
+    const u8* characters = Consume(length, 1);
+    if(m_failed || length == 0)
+        return {};
+
+    return StringView(reinterpret_cast<const char*>(characters), length);
+}
+
+void Serialization::Reader::Align(const u64 alignment)
+{
+    ASSERT(IsPow2(alignment) && alignment <= MaxElementAlignment);
+    const u64 padding = (alignment - m_offset % alignment) % alignment;
+    Consume(padding, 1);
+}
+
+void Serialization::Reader::Fail()
+{
+    m_failed = true;
+    m_offset = m_size;
+}
+
+const u8* Serialization::Reader::Consume(const u64 count, const u64 elementSize)
+{
+    if(m_failed || count > GetRemainingSize() / elementSize)
+    {
+        Fail();
+        return nullptr;
+    }
+
+    const u8* bytes = m_data + m_offset;
+    m_offset += count * elementSize;
+    return bytes;
+}
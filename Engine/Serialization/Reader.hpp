@@ -0,0 +1,202 @@
+#pragma once
+
+#include "Common/Containers/Span.hpp"
+#include "Serialization/Fields.hpp"
+
+namespace Serialization
+{
+    // Reads values written by writer directly from source bytes, returning strings and spans
+    // that point into source without copying, so source must outlive anything read from it.
+    // Source must start at an address aligned to element alignment for spans to be read in
+    // place, which holds for mapped files and heap allocations. Any read past end of source
+    // or malformed value fails the reader, after which all reads return default values.
+    // Errors are not logged, so reading untrusted data only needs a single check at the end.
+    class Reader final : NonCopyable
+    {
+        const u8* m_data = nullptr;
+        u64 m_size = 0;
+        u64 m_offset = 0;
+        u32 m_version = 0;
+        bool m_failed = false;
+
+    public:
+        Reader(const u8* data, u64 size);
+        explicit Reader(const StringView& data);
+        explicit Reader(const HeapArray<u8>& data);
+
+        // Fails unless magic matches and version is not newer than supported one.
+        bool ReadHeader(u32 magic, u32 maxVersion);
+
+        bool ReadBytes(void* data, u64 size);
+        u64 ReadVarUInt();
+        i64 ReadVarInt();
+        StringView ReadString();
+
+        void Align(u64 alignment);
+
+        template<typename Type>
+        Type ReadFixed()
+        {
+            static_assert(IsPlainElement<Type>, "Only arithmetic and enum values have fixed width");
+            Type value{};
+            ReadBytes(&value, sizeof(Type));
+            return value;
+        }
+
+        template<typename Type>
+        Span<const Type> ReadSpan()
+        {
+            static_assert(IsPlainElement<Type>, "Only arithmetic and enum elements can be read as span");
+            static_assert(alignof(Type) <= MaxElementAlignment);
+
+            const u64 count = ReadVarUInt();
+            Align(alignof(Type));
+
+            const u8* elements = Consume(count, sizeof(Type));
+            if(m_failed || count == 0)
+                return {};
+
+            ASSERT(reinterpret_cast<uintptr_t>(elements) % alignof(Type) == 0, "Source data is not aligned");
+            return Span<const Type>(reinterpret_cast<const Type*>(elements), count);
+        }
+
+        template<typename Type>
+        void Read(Type& value)
+        {
+            if constexpr(std::is_same_v<Type, bool>)
+            {
+                const u8 byte = ReadFixed<u8>();
+                if(byte > 1)
+                {
+                    Fail();
+                }
+
+                value = byte != 0;
+            }
+            else if constexpr((std::is_integral_v<Type> && sizeof(Type) == 1) || std::is_floating_point_v<Type>)
+            {
+                value = ReadFixed<Type>();
+            }
+            else if constexpr(std::is_integral_v<Type> && std::is_signed_v<Type>)
+            {
+                const i64 result = ReadVarInt();
+                if constexpr(sizeof(Type) < sizeof(i64))
+                {
+                    if(result < std::numeric_limits<Type>::min() || result > std::numeric_limits<Type>::max())
+                    {
+                        Fail();
+                    }
+                }
+
+                value = static_cast<Type>(result);
+            }
+            else if constexpr(std::is_integral_v<Type>)
+            {
+                const u64 result = ReadVarUInt();
+                if constexpr(sizeof(Type) < sizeof(u64))
+                {
+                    if(result > std::numeric_limits<Type>::max())
+                    {
+                        Fail();
+                    }
+                }
+
+                value = static_cast<Type>(result);
+            }
+            else if constexpr(std::is_enum_v<Type>)
+            {
+                std::underlying_type_t<Type> underlying{};
+                Read(underlying);
+                value = static_cast<Type>(underlying);
+            }
+            else if constexpr(std::is_same_v<Type, StringView> || IsString<Type>)
+            {
+                value = ReadString();
+            }
+            else if constexpr(IsSpan<Type>)
+            {
+                value = ReadSpan<std::remove_const_t<typename Type::ElementType>>();
+            }
+            else if constexpr(IsArray<Type>)
+            {
+                ReadArray(value);
+            }
+            else if constexpr(HasFields<Type, Reader>)
+            {
+                Type::VisitFields(value, *this);
+            }
+            else
+            {
+                static_assert(sizeof(Type) == 0, "Type cannot be deserialized");
+            }
+        }
+
+        // Fields newer than archive version keep their current value.
+        template<typename Type>
+        void Field([[maybe_unused]] const char* name, Type& value, const u32 sinceVersion)
+        {
+            if(sinceVersion <= m_version)
+            {
+                Read(value);
+            }
+        }
+
+        void Fail();
+
+        u64 GetOffset() const
+        {
+            return m_offset;
+        }
+
+        u64 GetRemainingSize() const
+        {
+            return m_size - m_offset;
+        }
+
+        u32 GetVersion() const
+        {
+            return m_version;
+        }
+
+        bool IsFailed() const
+        {
+            return m_failed;
+        }
+
+        // Succeeded and consumed all source bytes.
+        bool IsFinished() const
+        {
+            return !m_failed && m_offset == m_size;
+        }
+
+    private:
+        const u8* Consume(u64 count, u64 elementSize);
+
+        template<typename Type, typename Allocator>
+        void ReadArray(Array<Type, Allocator>& array)
+        {
+            array.Clear();
+            if constexpr(IsPlainElement<Type>)
+            {
+                const Span<const Type> elements = ReadSpan<Type>();
+                array.AppendRange(elements.GetData(), elements.GetSize());
+            }
+            else
+            {
+                // Every element takes at least one byte, which bounds count of malformed data.
+                const u64 count = ReadVarUInt();
+                if(count > GetRemainingSize())
+                {
+                    Fail();
+                    return;
+                }
+
+                array.Reserve(count);
+                for(u64 i = 0; i < count && !m_failed; ++i)
+                {
+                    Read(array.Add());
+                }
+            }
+        }
+    };
+}
@@ -0,0 +1,59 @@
+#include "Shared.hpp"
+#include "Serialization/Writer.hpp"
+
+Serialization::Writer::Writer(HeapArray<u8>& buffer)
+    : m_buffer(buffer)
+    , m_start(buffer.GetSize())
+{
+}
+
+void Serialization::Writer::WriteHeader(const u32 magic, const u32 version)
+{
+    ASSERT(GetSize() == 0, "Header must be written first");
+    m_version = version;
+    WriteFixed(magic);
+    WriteFixed(version);
+}
+
+void Serialization::Writer::WriteBytes(const void* data, const u64 size)
+{
+    if(size == 0)
+        return;
+
+    std::memcpy(m_buffer.AddUninitialized(size), data, size);
+}
+
+void Serialization::Writer::WriteVarUInt(u64 value)
+{
+    // Seven bits per byte starting from the lowest, with high bit set on all but the last byte.
+    u8 bytes[10];
+    u64 count = 0;
+    while(value >= 0x80)
+    {
+        bytes[count++] = static_cast<u8>(value | 0x80);
+        value >>= 7;
+    }
+
+    bytes[count++] = static_cast<u8>(value);
+    WriteBytes(bytes, count);
+}
+
+void Serialization::Writer::WriteVarInt(const i64 value)
+{
+    // Zigzag encoding interleaves signs, so small negative values also take few bytes.
+    WriteVarUInt((static_cast<u64>(value) << 1) ^ static_cast<u64>(value >> 63));
+}
+
+void Serialization::Writer::WriteString(const StringView& string)
+{
+    WriteVarUInt(string.GetLength());
+    WriteBytes(string.GetData(), string.GetLength());
+}
+
+void Serialization::Writer::Align(const u64 alignment)
+{
+    ASSERT(IsPow2(alignment) && alignment <= MaxElementAlignment);
+    const u64 padding = (alignment - GetSize() % alignment) % alignment;
+    const u8 zeros[MaxElementAlignment] = {};
+    WriteBytes(zeros, padding);
+}
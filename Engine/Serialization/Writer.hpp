@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Common/Containers/Span.hpp"
+#include "Serialization/Fields.hpp"
+
+namespace Serialization
+{
+    // Streams values into byte array, appending to whatever it already contains. Integers
+    // are written as variable length integers taking fewer bytes for smaller values, while
+    // floats and arrays of plain elements are written as fixed-width bytes that can be read
+    // in place. Values are stored in native byte order, which is little endian on all
+    // supported platforms.
+    class Writer final : NonCopyable
+    {
+        HeapArray<u8>& m_buffer;
+        u64 m_start = 0;
+        u32 m_version = 0;
+
+    public:
+        explicit Writer(HeapArray<u8>& buffer);
+
+        // Header identifies format of archive and its version, which lets readers reject
+        // unrelated data and keep defaults for fields added in later versions.
+        void WriteHeader(u32 magic, u32 version);
+        void WriteBytes(const void* data, u64 size);
+        void WriteVarUInt(u64 value);
+        void WriteVarInt(i64 value);
+        void WriteString(const StringView& string);
+
+        // Pads with zeros to alignment relative to where writer started.
+        void Align(u64 alignment);
+
+        template<typename Type>
+        void WriteFixed(const Type value)
+        {
+            static_assert(IsPlainElement<Type>, "Only arithmetic and enum values have fixed width");
+            WriteBytes(&value, sizeof(Type));
+        }
+
+        // Elements are aligned to their type, so they can be read in place as a span.
+        template<typename Type>
+        void WriteSpan(const Type* elements, const u64 count)
+        {
+            static_assert(IsPlainElement<Type>, "Only arithmetic and enum elements can be written as span");
+            static_assert(alignof(Type) <= MaxElementAlignment);
+            WriteVarUInt(count);
+            Align(alignof(Type));
+            WriteBytes(elements, count * sizeof(Type));
+        }
+
+        template<typename Type>
+        void Write(const Type& value)
+        {
+            if constexpr(std::is_same_v<Type, bool> || (std::is_integral_v<Type> && sizeof(Type) == 1)
+                || std::is_floating_point_v<Type>)
+            {
+                WriteFixed(value);
+            }
+            else if constexpr(std::is_integral_v<Type> && std::is_signed_v<Type>)
+            {
+                WriteVarInt(value);
+            }
+            else if constexpr(std::is_integral_v<Type>)
+            {
+                WriteVarUInt(value);
+            }
+            else if constexpr(std::is_enum_v<Type>)
+            {
+                Write(static_cast<std::underlying_type_t<Type>>(value));
+            }
+            else if constexpr(std::is_same_v<Type, StringView> || IsString<Type>)
+            {
+                WriteString(value);
+            }
+            else if constexpr(IsSpan<Type>)
+            {
+                WriteSpan(value.GetData(), value.GetSize());
+            }
+            else if constexpr(IsArray<Type>)
+            {
+                WriteArray(value);
+            }
+            else if constexpr(HasFields<const Type, Writer>)
+            {
+                Type::VisitFields(value, *this);
+            }
+            else
+            {
+                static_assert(sizeof(Type) == 0, "Type cannot be serialized");
+            }
+        }
+
+        // Fields newer than archive version are left out, so older versions can still be written.
+        template<typename Type>
+        void Field([[maybe_unused]] const char* name, const Type& value, const u32 sinceVersion)
+        {
+            if(sinceVersion <= m_version)
+            {
+                Write(value);
+            }
+        }
+
+        u64 GetSize() const
+        {
+            return m_buffer.GetSize() - m_start;
+        }
+
+        u32 GetVersion() const
+        {
+            return m_version;
+        }
+
+    private:
+        template<typename Type, typename Allocator>
+        void WriteArray(const Array<Type, Allocator>& array)
+        {
+            if constexpr(IsPlainElement<Type>)
+            {
+                WriteSpan(array.GetData(), array.GetSize());
+            }
+            else
+            {
+                WriteVarUInt(array.GetSize());
+                for(const Type& element : array)
+                {
+                    Write(element);
+                }
+            }
+        }
+    };
+}
@@ -8,6 +8,7 @@
 #include <cmath> // std::floor, std::ceil
 #include <atomic> // std::atomic
 #include <mutex> // std::mutex
+#include <thread> // std::thread
 #include <utility> // std::as_const
 #include <tuple> // std::tuple
 #include <variant> // std::variant
@@ -37,8 +38,13 @@
 #include "Common/Utility/Function.hpp"
 #include "Common/Utility/Delegate.hpp"
 #include "Common/Utility/UniquePtr.hpp"
+#include "Common/Utility/SharedPtr.hpp"
 #include "Common/Containers/Array.hpp"
 #include "Common/Containers/String.hpp"
 #include "Common/Containers/StringView.hpp"
+#include "Common/Containers/StringBuilder.hpp"
+#include "Common/Containers/ImmutableString.hpp"
+#include "Common/Utility/StringId.hpp"
 #include "Platform/Thread.hpp"
+#include "Platform/Synchronization.hpp"
 #include "Platform/Utility.hpp"
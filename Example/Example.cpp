@@ -7,8 +7,8 @@ public:
     Config GetConfig() override;
 
     bool OnSetup() override;
-    void OnUpdate(float deltaTime) override;
-    void OnDraw(float alphaTime) override;
+    void OnUpdate(float deltaTime, const Input::State& input) override;
+    void OnDraw(const FramePacket& packet) override;
 };
 
 DEFINE_PRIMARY_APPLICATION("Bourne Engine Example", ExampleApplication);
@@ -19,6 +19,7 @@ Config ExampleApplication::GetConfig()
     config.window.width = 1024;
     config.window.height = 576;
     config.render.software = false;
+    config.pipeline.renderThread = true;
     return config;
 }
 
@@ -27,11 +28,11 @@ bool ExampleApplication::OnSetup()
     return true;
 }
 
-void ExampleApplication::OnUpdate(float deltaTime)
+void ExampleApplication::OnUpdate(float deltaTime, const Input::State& input)
 {
 }
 
-void ExampleApplication::OnDraw(float alphaTime)
+void ExampleApplication::OnDraw(const FramePacket& packet)
 {
     // #todo: Draw a triangle.
 }
@@ -1,5 +1,44 @@
 #include "Shared.hpp"
 
+namespace
+{
+    // Object that stores pointer to itself, which is invalidated when memory is copied.
+    // Containers must relocate it with move construction instead of memcpy.
+    class SelfReference
+    {
+        const SelfReference* m_self = this;
+        u64 m_value = 0;
+
+    public:
+        SelfReference(const u64 value = 0)
+            : m_value(value)
+        {
+        }
+
+        SelfReference(const SelfReference& other)
+            : m_value(other.m_value)
+        {
+        }
+
+        SelfReference(SelfReference&& other) noexcept
+            : m_value(other.m_value)
+        {
+        }
+
+        bool IsValid() const
+        {
+            return m_self == this;
+        }
+
+        u64 GetValue() const
+        {
+            return m_value;
+        }
+    };
+
+    static_assert(!Memory::IsTriviallyRelocatable<SelfReference>);
+}
+
 TEST_DEFINE("Common.Array", "Empty")
 {
     Array<u32> array;
@@ -527,3 +566,235 @@ TEST_DEFINE("Common.Array", "AddUniqueImplicit")
     TEST_TRUE(memoryGuard.ValidateTotalAllocations(1, sizeof(Test::Object) * 4));
     TEST_TRUE(objectGuard.ValidateTotalCounts(3, 2, 0, 0));
 }
+
+TEST_DEFINE("Common.Array", "Insert")
+{
+    Array<Test::Object> array;
+    array.Add(1);
+    array.Add(3);
+    array.Insert(1, 2);
+    array.Insert(0, 0);
+    array.Insert(4, 4);
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1, sizeof(Test::Object) * 8));
+    TEST_TRUE(objectGuard.ValidateCurrentInstances(5));
+
+    TEST_TRUE(array.GetSize() == 5);
+    TEST_TRUE(array[0].GetControlValue() == 0);
+    TEST_TRUE(array[1].GetControlValue() == 1);
+    TEST_TRUE(array[2].GetControlValue() == 2);
+    TEST_TRUE(array[3].GetControlValue() == 3);
+    TEST_TRUE(array[4].GetControlValue() == 4);
+
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1, sizeof(Test::Object) * 8));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(5, 0, 0, 0));
+}
+
+TEST_DEFINE("Common.Array", "InsertRange")
+{
+    const u32 elements[] = { 7, 8, 9 };
+
+    Array<u32> array = { 1, 2, 3 };
+    array.InsertRange(1, elements, ArraySize(elements));
+    array.InsertRange(6, elements, 1);
+    array.InsertRange(0, elements, 0);
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1, sizeof(u32) * 8));
+
+    TEST_TRUE(array.GetSize() == 7);
+    TEST_TRUE(array[0] == 1);
+    TEST_TRUE(array[1] == 7);
+    TEST_TRUE(array[2] == 8);
+    TEST_TRUE(array[3] == 9);
+    TEST_TRUE(array[4] == 2);
+    TEST_TRUE(array[5] == 3);
+    TEST_TRUE(array[6] == 7);
+
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1, sizeof(u32) * 8));
+}
+
+TEST_DEFINE("Common.Array", "AppendRange")
+{
+    Array<u32> source = { 1, 2, 3, 4, 5 };
+
+    Array<u32> array;
+    array.AppendRange(source);
+    array.AppendRange(source.GetData(), 2);
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(2, sizeof(u32) * (5 + 8)));
+
+    TEST_TRUE(array.GetSize() == 7);
+    TEST_TRUE(array[0] == 1);
+    TEST_TRUE(array[4] == 5);
+    TEST_TRUE(array[5] == 1);
+    TEST_TRUE(array[6] == 2);
+
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(2, sizeof(u32) * (5 + 8)));
+}
+
+TEST_DEFINE("Common.Array", "AppendRangeObject")
+{
+    Array<Test::Object> source;
+    source.Resize(3, 42);
+
+    Array<Test::Object> array;
+    array.AppendRange(source);
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(2, sizeof(Test::Object) * (3 + 4)));
+    TEST_TRUE(objectGuard.ValidateCurrentInstances(6));
+
+    TEST_TRUE(array.GetSize() == 3);
+    TEST_TRUE(array[0].GetControlValue() == 42);
+    TEST_TRUE(array[2].GetControlValue() == 42);
+
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(2, sizeof(Test::Object) * (3 + 4)));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(6, 0, 3, 0));
+}
+
+TEST_DEFINE("Common.Array", "AddUninitialized")
+{
+    Array<u32> array;
+    array.Add(1);
+
+    u32* elements = array.AddUninitialized(4);
+    for(u32 i = 0; i < 4; ++i)
+    {
+        elements[i] = i + 2;
+    }
+
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1, sizeof(u32) * 8));
+    TEST_TRUE(array.GetSize() == 5);
+    TEST_TRUE(elements == array.GetData() + 1);
+
+    for(u32 i = 0; i < 5; ++i)
+    {
+        TEST_TRUE(array[i] == i + 1);
+    }
+
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1, sizeof(u32) * 8));
+}
+
+TEST_DEFINE("Common.Array", "RemoveAt")
+{
+    Array<Test::Object> array;
+    array.Add(0);
+    array.Add(1);
+    array.Add(2);
+    array.Add(3);
+    array.Add(4);
+
+    array.RemoveAt(1);
+    array.RemoveAt(3);
+    array.RemoveAt(0, 2);
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1, sizeof(Test::Object) * 8));
+    TEST_TRUE(objectGuard.ValidateCurrentInstances(1));
+
+    TEST_TRUE(array.GetSize() == 1);
+    TEST_TRUE(array[0].GetControlValue() == 3);
+
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1, sizeof(Test::Object) * 8));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(5, 4, 0, 0));
+}
+
+TEST_DEFINE("Common.Array", "RemoveAtSwap")
+{
+    Array<Test::Object> array;
+    array.Add(0);
+    array.Add(1);
+    array.Add(2);
+    array.Add(3);
+
+    array.RemoveAtSwap(0);
+    array.RemoveAtSwap(2);
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1, sizeof(Test::Object) * 4));
+    TEST_TRUE(objectGuard.ValidateCurrentInstances(2));
+
+    TEST_TRUE(array.GetSize() == 2);
+    TEST_TRUE(array[0].GetControlValue() == 3);
+    TEST_TRUE(array[1].GetControlValue() == 1);
+
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1, sizeof(Test::Object) * 4));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(4, 2, 0, 0));
+}
+
+TEST_DEFINE("Common.Array", "RemoveIf")
+{
+    Array<Test::Object> array;
+    for(u32 i = 0; i < 8; ++i)
+    {
+        array.Add(i);
+    }
+
+    const u64 removedCount = array.RemoveIf([](const Test::Object& object)
+    {
+        return object.GetControlValue() % 3 == 0;
+    });
+
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1, sizeof(Test::Object) * 8));
+    TEST_TRUE(objectGuard.ValidateCurrentInstances(5));
+
+    TEST_TRUE(removedCount == 3);
+    TEST_TRUE(array.GetSize() == 5);
+    TEST_TRUE(array[0].GetControlValue() == 1);
+    TEST_TRUE(array[1].GetControlValue() == 2);
+    TEST_TRUE(array[2].GetControlValue() == 4);
+    TEST_TRUE(array[3].GetControlValue() == 5);
+    TEST_TRUE(array[4].GetControlValue() == 7);
+
+    TEST_TRUE(array.RemoveIf([](const Test::Object& object) { return false; }) == 0);
+    TEST_TRUE(array.GetSize() == 5);
+
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1, sizeof(Test::Object) * 8));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(8, 3, 0, 0));
+}
+
+TEST_DEFINE("Common.Array", "Relocatable")
+{
+    static_assert(Memory::IsTriviallyRelocatable<u32>);
+    static_assert(Memory::IsTriviallyRelocatable<String>);
+    static_assert(Memory::IsTriviallyRelocatable<StringView>);
+    static_assert(Memory::IsTriviallyRelocatable<Array<Test::Object>>);
+    static_assert(Memory::IsTriviallyRelocatable<Array<SelfReference>>);
+    static_assert(!Memory::IsTriviallyRelocatable<InlineArray<SelfReference, 4>>);
+    static_assert(Memory::IsTriviallyRelocatable<UniquePtr<Test::Object>>);
+    static_assert(Memory::IsTriviallyRelocatable<Function<void()>>);
+    static_assert(Memory::IsTriviallyRelocatable<Optional<String>>);
+    static_assert(!Memory::IsTriviallyRelocatable<Optional<SelfReference>>);
+
+    Array<String> array;
+    for(u32 i = 0; i < 5; ++i)
+    {
+        array.Add(String::Format("String number %u", i));
+    }
+
+    array.Insert(0, "First");
+    array.RemoveAt(1);
+    TEST_TRUE(array.GetSize() == 5);
+    TEST_TRUE(array[0] == "First");
+    TEST_TRUE(array[1] == "String number 1");
+    TEST_TRUE(array[4] == "String number 4");
+}
+
+TEST_DEFINE("Common.Array", "NonRelocatable")
+{
+    Array<SelfReference> array;
+    for(u32 i = 0; i < 5; ++i)
+    {
+        array.Add(i);
+    }
+
+    array.Insert(0, 42);
+    array.RemoveAt(1);
+    array.RemoveAtSwap(1);
+    array.RemoveIf([](const SelfReference& element)
+    {
+        return element.GetValue() == 3;
+    });
+
+    array.ShrinkToFit();
+    TEST_TRUE(array.GetSize() == 3);
+    TEST_TRUE(array[0].GetValue() == 42);
+    TEST_TRUE(array[1].GetValue() == 4);
+    TEST_TRUE(array[2].GetValue() == 2);
+
+    for(const SelfReference& element : array)
+    {
+        TEST_TRUE(element.IsValid());
+    }
+}
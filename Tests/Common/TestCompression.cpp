@@ -0,0 +1,126 @@
+#include "Shared.hpp"
+#include "Common/Utility/Compression.hpp"
+
+namespace
+{
+    bool CompressRoundTrip(const HeapArray<u8>& data, u64* compressedSize = nullptr)
+    {
+        HeapArray<u8> compressed;
+        compressed.Resize(Compression::GetCompressedBound(data.GetSize()));
+        const u64 size = Compression::Compress(data.GetData(), data.GetSize(), compressed.GetData(), compressed.GetSize());
+        if(size == 0)
+            return false;
+
+        if(compressedSize)
+        {
+            *compressedSize = size;
+        }
+
+        HeapArray<u8> decompressed;
+        decompressed.Resize(data.GetSize());
+        if(!Compression::Decompress(compressed.GetData(), size, decompressed.GetData(), decompressed.GetSize()))
+            return false;
+
+        return data.GetSize() == 0 || std::memcmp(data.GetData(), decompressed.GetData(), data.GetSize()) == 0;
+    }
+}
+
+TEST_DEFINE("Common.Compression", "RoundTrip")
+{
+    HeapArray<u8> empty;
+    TEST_TRUE(CompressRoundTrip(empty));
+
+    HeapArray<u8> tiny = { 'a', 'b', 'c' };
+    TEST_TRUE(CompressRoundTrip(tiny));
+
+    // Repeated pattern compresses into matches overlapping bytes they produce.
+    HeapArray<u8> repeated;
+    for(u32 i = 0; i < 10000; ++i)
+    {
+        repeated.Add(static_cast<u8>("abc"[i % 3]));
+    }
+
+    u64 repeatedSize = 0;
+    TEST_TRUE(CompressRoundTrip(repeated, &repeatedSize));
+    TEST_TRUE(repeatedSize < 100);
+
+    // Pseudo random bytes do not compress, but must still fit within bound.
+    HeapArray<u8> noise;
+    u32 state = 12345;
+    for(u32 i = 0; i < 70000; ++i)
+    {
+        state = state * 1664525u + 1013904223u;
+        noise.Add(static_cast<u8>(state >> 24));
+    }
+
+    u64 noiseSize = 0;
+    TEST_TRUE(CompressRoundTrip(noise, &noiseSize));
+    TEST_TRUE(noiseSize > noise.GetSize());
+    TEST_TRUE(noiseSize <= Compression::GetCompressedBound(noise.GetSize()));
+
+    // Mixed text with long literal runs and matches further apart than the last ones.
+    HeapArray<u8> text;
+    for(u32 i = 0; i < 2000; ++i)
+    {
+        const auto line = InlineString<64>::Format("Line %u of some text to be packed\n", i * 7919 % 1000);
+        for(u64 j = 0; j < line.GetLength(); ++j)
+        {
+            text.Add(static_cast<u8>(line.GetData()[j]));
+        }
+    }
+
+    u64 textSize = 0;
+    TEST_TRUE(CompressRoundTrip(text, &textSize));
+    TEST_TRUE(textSize < text.GetSize() / 2);
+}
+
+TEST_DEFINE("Common.Compression", "Format")
+{
+    // Compressed data follows standard block format produced by other implementations.
+    const u8 compressed[] = { 0x11, 'a', 0x01, 0x00, 0x50, 'b', 'c', 'd', 'e', 'f' };
+    u8 decompressed[11] = {};
+    TEST_TRUE(Compression::Decompress(compressed, sizeof(compressed), decompressed, sizeof(decompressed)));
+    TEST_TRUE(std::memcmp(decompressed, "aaaaaabcdef", sizeof(decompressed)) == 0);
+}
+
+TEST_DEFINE("Common.Compression", "Malformed")
+{
+    HeapArray<u8> data;
+    for(u32 i = 0; i < 1000; ++i)
+    {
+        data.Add(static_cast<u8>(i % 10));
+    }
+
+    HeapArray<u8> compressed;
+    compressed.Resize(Compression::GetCompressedBound(data.GetSize()));
+    const u64 size = Compression::Compress(data.GetData(), data.GetSize(), compressed.GetData(), compressed.GetSize());
+    TEST_TRUE(size != 0);
+
+    // Destination too small to hold compressed data.
+    u8 small[8];
+    TEST_TRUE(Compression::Compress(data.GetData(), data.GetSize(), small, sizeof(small)) == 0);
+
+    // Size of decompressed data must match exactly.
+    HeapArray<u8> decompressed;
+    decompressed.Resize(data.GetSize() + 1);
+    TEST_FALSE(Compression::Decompress(compressed.GetData(), size, decompressed.GetData(), data.GetSize() - 1));
+    TEST_FALSE(Compression::Decompress(compressed.GetData(), size, decompressed.GetData(), data.GetSize() + 1));
+
+    // Truncated input and match offsets pointing before start of output are rejected.
+    TEST_FALSE(Compression::Decompress(compressed.GetData(), size - 1, decompressed.GetData(), data.GetSize()));
+    const u8 badOffset[] = { 0x10, 'a', 0x02, 0x00, 0x00 };
+    TEST_FALSE(Compression::Decompress(badOffset, sizeof(badOffset), decompressed.GetData(), 5));
+    const u8 zeroOffset[] = { 0x10, 'a', 0x00, 0x00, 0x00 };
+    TEST_FALSE(Compression::Decompress(zeroOffset, sizeof(zeroOffset), decompressed.GetData(), 5));
+
+    // Every truncation and corruption of valid data fails safely without crashing.
+    for(u64 i = 0; i < size; ++i)
+    {
+        Compression::Decompress(compressed.GetData(), i, decompressed.GetData(), data.GetSize());
+
+        const u8 original = compressed[i];
+        compressed[i] = static_cast<u8>(original ^ 0xA5);
+        Compression::Decompress(compressed.GetData(), size, decompressed.GetData(), data.GetSize());
+        compressed[i] = original;
+    }
+}
@@ -0,0 +1,129 @@
+#include "Shared.hpp"
+#include "Common/Utility/Hash.hpp"
+
+TEST_DEFINE("Common.ImmutableString", "Empty")
+{
+    ImmutableString string;
+    TEST_TRUE(string.IsEmpty());
+    TEST_TRUE(string.GetLength() == 0);
+    TEST_TRUE(string.GetRefCount() == 0);
+    TEST_TRUE(std::strcmp(*string, "") == 0);
+    TEST_TRUE(string.GetHash() == Hash::Fnv1a64("", 0));
+
+    const ImmutableString fromText("");
+    TEST_TRUE(fromText.IsEmpty());
+    TEST_TRUE(fromText == string);
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(0, 0));
+}
+
+TEST_DEFINE("Common.ImmutableString", "Construct")
+{
+    const ImmutableString fromText("Textures/Player.png");
+    TEST_TRUE(fromText.GetLength() == 19);
+    TEST_TRUE(fromText == "Textures/Player.png");
+    TEST_TRUE(fromText.IsNullTerminated());
+    TEST_TRUE(fromText.GetData()[fromText.GetLength()] == '\0');
+    TEST_TRUE(fromText.GetRefCount() == 1);
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1));
+
+    const StringView text = "Textures/Player.png.meta";
+    const ImmutableString fromView(text.SubStringLeftAt(19));
+    TEST_TRUE(fromView == fromText);
+    TEST_TRUE(fromView.GetData() != fromText.GetData());
+
+    const HeapString string = "Textures/Enemy.png";
+    const ImmutableString fromString(string);
+    TEST_TRUE(fromString == string);
+    TEST_TRUE(string == fromString);
+    TEST_TRUE(fromString != fromText);
+    TEST_TRUE(fromString.StartsWith("Textures/"));
+    TEST_TRUE(fromString.FindIndex("Enemy").GetValue() == 9);
+
+    const StringView view = fromString;
+    TEST_TRUE(view.GetData() == fromString.GetData());
+    TEST_TRUE(view == "Textures/Enemy.png");
+}
+
+TEST_DEFINE("Common.ImmutableString", "Copy")
+{
+    ImmutableString string("Shared characters");
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1));
+
+    // Copies share characters with a single allocation.
+    {
+        const ImmutableString copy = string;
+        ImmutableString assigned;
+        assigned = copy;
+        TEST_TRUE(copy.GetData() == string.GetData());
+        TEST_TRUE(assigned.GetData() == string.GetData());
+        TEST_TRUE(string.GetRefCount() == 3);
+        TEST_TRUE(memoryGuard.ValidateTotalAllocations(1));
+    }
+
+    TEST_TRUE(string.GetRefCount() == 1);
+
+    ImmutableString moved = Move(string);
+    TEST_TRUE(string.IsEmpty());
+    TEST_TRUE(moved == "Shared characters");
+    TEST_TRUE(moved.GetRefCount() == 1);
+
+    moved = moved;
+    TEST_TRUE(moved == "Shared characters");
+
+    moved = ImmutableString("Other");
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1));
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(2));
+
+    moved = ImmutableString();
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(0));
+}
+
+TEST_DEFINE("Common.ImmutableString", "Hash")
+{
+    const ImmutableString first("Models/Level.mesh");
+    const ImmutableString second("Models/Level.mesh");
+    const ImmutableString other("Models/Other.mesh");
+
+    TEST_TRUE(first.GetHash() == Hash::Fnv1a64("Models/Level.mesh", 17));
+    TEST_TRUE(first.GetHash() == first.GetHash());
+    TEST_TRUE(first.GetHash() == StringId::Compute(first).GetHash());
+
+    // Equality does not depend on whether hashes have been cached.
+    TEST_TRUE(first == second);
+    TEST_TRUE(second.GetHash() == first.GetHash());
+    TEST_TRUE(first == second);
+    TEST_TRUE(first != other);
+    TEST_TRUE(other.GetHash() != first.GetHash());
+    TEST_TRUE(first != other);
+}
+
+TEST_DEFINE("Common.ImmutableString", "Threads")
+{
+    // Copies are made and released on many threads at once.
+    const ImmutableString string("Shared between threads");
+    std::atomic<u32> failures = 0;
+    std::thread threads[4];
+    for(std::thread& thread : threads)
+    {
+        thread = std::thread([&string, &failures]()
+        {
+            for(u32 i = 0; i < 10000; ++i)
+            {
+                const ImmutableString copy = string;
+                if(copy.GetHash() != Hash::Fnv1a64("Shared between threads", 22))
+                {
+                    ++failures;
+                }
+            }
+        });
+    }
+
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    TEST_TRUE(failures == 0);
+    TEST_TRUE(string.GetRefCount() == 1);
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1));
+}
@@ -0,0 +1,177 @@
+#include "Shared.hpp"
+#include "Common/Containers/MpmcRingQueue.hpp"
+#include "Platform/Time.hpp"
+
+TEST_DEFINE("Common.MpmcRingQueue", "Empty")
+{
+    MpmcRingQueue<u32> queue(1);
+    TEST_TRUE(queue.GetCapacity() == 2);
+    TEST_TRUE(queue.GetSize() == 0);
+    TEST_TRUE(queue.IsEmpty());
+
+    u32 value = 0;
+    TEST_TRUE(!queue.Pop(value));
+    TEST_TRUE(queue.PopBatch(&value, 1) == 0);
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1));
+}
+
+TEST_DEFINE("Common.MpmcRingQueue", "PushPop")
+{
+    MpmcRingQueue<u32> queue(4);
+
+    // Cell sequences advance by one lap each time indices wrap around.
+    u32 value = 0;
+    for(u32 lap = 0; lap < 3; ++lap)
+    {
+        for(u32 i = 0; i < 4; ++i)
+        {
+            TEST_TRUE(queue.Push(lap * 10 + i));
+        }
+
+        TEST_TRUE(!queue.Push(100u));
+        TEST_TRUE(queue.GetSize() == 4);
+
+        for(u32 i = 0; i < 4; ++i)
+        {
+            TEST_TRUE(queue.Pop(value));
+            TEST_TRUE(value == lap * 10 + i);
+        }
+
+        TEST_TRUE(!queue.Pop(value));
+    }
+}
+
+TEST_DEFINE("Common.MpmcRingQueue", "Batch")
+{
+    MpmcRingQueue<u32> queue(8);
+
+    const u32 input[] = { 0, 1, 2, 3, 4, 5 };
+    TEST_TRUE(queue.PushBatch(input, 6) == 6);
+    TEST_TRUE(queue.PushBatch(input, 6) == 2);
+    TEST_TRUE(queue.PushBatch(input, 6) == 0);
+
+    u32 output[8] = {};
+    TEST_TRUE(queue.PopBatch(output, 4) == 4);
+    TEST_TRUE(output[0] == 0 && output[3] == 3);
+
+    TEST_TRUE(queue.Push(6u));
+    TEST_TRUE(queue.PopBatch(output, 8) == 5);
+    TEST_TRUE(output[0] == 4 && output[1] == 5 && output[2] == 0 && output[3] == 1 && output[4] == 6);
+    TEST_TRUE(queue.IsEmpty());
+}
+
+TEST_DEFINE("Common.MpmcRingQueue", "Objects")
+{
+    {
+        MpmcRingQueue<Test::Object> queue(4);
+        TEST_TRUE(queue.Push(1u));
+        TEST_TRUE(queue.Push(Test::Object(2)));
+        TEST_TRUE(queue.Push(3u));
+        TEST_TRUE(objectGuard.ValidateCurrentInstances(3));
+
+        Test::Object object;
+        TEST_TRUE(queue.Pop(object));
+        TEST_TRUE(object == 1u);
+        TEST_TRUE(objectGuard.ValidateCurrentInstances(3));
+    }
+
+    // Elements left in the queue are destroyed with it.
+    TEST_TRUE(objectGuard.ValidateCurrentInstances(0));
+    TEST_TRUE(objectGuard.ValidateTotalCopies(0));
+}
+
+TEST_DEFINE("Common.MpmcRingQueue", "Inline")
+{
+    InlineMpmcRingQueue<u64, 16> queue;
+    TEST_TRUE(queue.GetCapacity() == 16);
+
+    for(u64 i = 0; i < 16; ++i)
+    {
+        TEST_TRUE(queue.Push(i));
+    }
+
+    TEST_TRUE(!queue.Push(16ull));
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(0, 0));
+}
+
+TEST_DEFINE("Common.MpmcRingQueue", "Throughput")
+{
+    // Multiple producers and consumers contend on both ends of the queue.
+    // Every item must be received exactly once, which is checked with sums.
+    const u64 threadCount = 4;
+    const u64 itemsPerProducer = 25000;
+    const u64 batchSize = 8;
+    MpmcRingQueue<u64> queue(1024);
+
+    std::atomic<u64> receivedCount = 0;
+    std::atomic<u64> receivedSum = 0;
+    InlineArray<std::thread, threadCount * 2> threads;
+
+    const u64 startTick = Time::GetCurrentTick();
+    for(u64 producerIndex = 0; producerIndex < threadCount; ++producerIndex)
+    {
+        threads.Add([&queue, producerIndex, itemsPerProducer, batchSize]()
+        {
+            u64 batch[batchSize];
+            u64 next = 0;
+            while(next < itemsPerProducer)
+            {
+                // Odd producers push single items to mix both code paths.
+                const u64 count = producerIndex % 2 == 0 ? std::min(batchSize, itemsPerProducer - next) : 1;
+                for(u64 i = 0; i < count; ++i)
+                {
+                    batch[i] = producerIndex * itemsPerProducer + next + i + 1;
+                }
+
+                const u64 pushed = count == 1 ? (queue.Push(batch[0]) ? 1 : 0) : queue.PushBatch(batch, count);
+                if(pushed == 0)
+                {
+                    Thread::Yield();
+                }
+
+                next += pushed;
+            }
+        });
+    }
+
+    const u64 totalCount = threadCount * itemsPerProducer;
+    for(u64 consumerIndex = 0; consumerIndex < threadCount; ++consumerIndex)
+    {
+        threads.Add([&queue, &receivedCount, &receivedSum, consumerIndex, totalCount, batchSize]()
+        {
+            u64 batch[batchSize];
+            u64 sum = 0;
+            while(receivedCount.load(std::memory_order_relaxed) < totalCount)
+            {
+                const u64 count = consumerIndex % 2 == 0 ? queue.PopBatch(batch, batchSize) : (queue.Pop(batch[0]) ? 1 : 0);
+                if(count == 0)
+                {
+                    Thread::Yield();
+                    continue;
+                }
+
+                for(u64 i = 0; i < count; ++i)
+                {
+                    sum += batch[i];
+                }
+
+                receivedCount.fetch_add(count, std::memory_order_relaxed);
+            }
+
+            receivedSum.fetch_add(sum, std::memory_order_relaxed);
+        });
+    }
+
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    const f32 seconds = Time::ConvertTicksToSeconds(Time::GetCurrentTick() - startTick);
+
+    TEST_TRUE(receivedCount == totalCount);
+    TEST_TRUE(receivedSum == totalCount * (totalCount + 1) / 2);
+    TEST_TRUE(queue.IsEmpty());
+    LOG_INFO("MPMC ring queue throughput with %llu producers and %llu consumers: %.2f million items per second",
+        threadCount, threadCount, totalCount / std::max(seconds, 0.000001f) / 1000000.0f);
+}
@@ -0,0 +1,422 @@
+#include "Shared.hpp"
+#include "Common/Utility/NumberConversion.hpp"
+#include "Platform/Time.hpp"
+
+namespace
+{
+    u64 NextTestNumber(u64& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    bool IsFiniteDouble(const f64 value)
+    {
+        return (std::bit_cast<u64>(value) & 0x7FF0000000000000) != 0x7FF0000000000000;
+    }
+
+    bool IsFiniteFloat(const f32 value)
+    {
+        return (std::bit_cast<u32>(value) & 0x7F800000) != 0x7F800000;
+    }
+
+    bool ParsesAsDouble(const char* text, const f64 expected)
+    {
+        const Optional<f64> value = NumberConversion::ParseFloat<f64>(text);
+        return value && std::bit_cast<u64>(*value) == std::bit_cast<u64>(expected);
+    }
+
+    bool ParsesAsStandardDouble(const char* text)
+    {
+        return ParsesAsDouble(text, std::strtod(text, nullptr));
+    }
+
+    bool ParsesAsStandardFloat(const char* text)
+    {
+        const f32 expected = std::strtof(text, nullptr);
+        const Optional<f32> value = NumberConversion::ParseFloat<f32>(text);
+        if(!IsFiniteFloat(expected))
+            return !value;
+
+        return value && std::bit_cast<u32>(*value) == std::bit_cast<u32>(expected);
+    }
+
+    template<typename Type>
+    bool FormatsAs(const Type value, const char* expected)
+    {
+        char buffer[NumberConversion::MaxFloatChars];
+        const u64 length = NumberConversion::ToChars(buffer, value);
+        return StringView(buffer, length) == expected;
+    }
+
+    // Shortest length is the lowest precision at which correctly rounded text parses back.
+    u64 GetShortestDoubleLength(const f64 value)
+    {
+        char buffer[64];
+        for(int precision = 0; precision < 17; ++precision)
+        {
+            std::snprintf(buffer, sizeof(buffer), "%.*e", precision, value);
+            if(std::bit_cast<u64>(std::strtod(buffer, nullptr)) == std::bit_cast<u64>(value))
+                return precision + 1;
+        }
+
+        return 17;
+    }
+
+    u64 GetShortestFloatLength(const f32 value)
+    {
+        char buffer[64];
+        for(int precision = 0; precision < 9; ++precision)
+        {
+            std::snprintf(buffer, sizeof(buffer), "%.*e", precision, static_cast<f64>(value));
+            if(std::bit_cast<u32>(std::strtof(buffer, nullptr)) == std::bit_cast<u32>(value))
+                return precision + 1;
+        }
+
+        return 9;
+    }
+
+    u64 CountSignificantDigits(const StringView& text)
+    {
+        u64 count = 0;
+        bool leading = true;
+        u64 trailingZeros = 0;
+        for(const char character : text)
+        {
+            if(character == 'e')
+                break;
+
+            if(character < '0' || character > '9' || (leading && character == '0'))
+                continue;
+
+            leading = false;
+            ++count;
+            trailingZeros = character == '0' ? trailingZeros + 1 : 0;
+        }
+
+        return count == 0 ? 1 : count - trailingZeros;
+    }
+}
+
+TEST_DEFINE("Common.NumberConversion", "ParseInt")
+{
+    TEST_TRUE(NumberConversion::ParseInt("0").GetValue() == 0);
+    TEST_TRUE(NumberConversion::ParseInt("-0").GetValue() == 0);
+    TEST_TRUE(NumberConversion::ParseInt("+42").GetValue() == 42);
+    TEST_TRUE(NumberConversion::ParseInt("-1234567890123").GetValue() == -1234567890123);
+    TEST_TRUE(NumberConversion::ParseInt("9223372036854775807").GetValue() == std::numeric_limits<i64>::max());
+    TEST_TRUE(NumberConversion::ParseInt("-9223372036854775808").GetValue() == std::numeric_limits<i64>::min());
+    TEST_TRUE(NumberConversion::ParseInt("-00000000000000000000000000042").GetValue() == -42);
+    TEST_FALSE(NumberConversion::ParseInt("9223372036854775808"));
+    TEST_FALSE(NumberConversion::ParseInt("-9223372036854775809"));
+    TEST_FALSE(NumberConversion::ParseInt("100000000000000000000"));
+
+    TEST_TRUE(NumberConversion::ParseUInt("18446744073709551615").GetValue() == std::numeric_limits<u64>::max());
+    TEST_TRUE(NumberConversion::ParseUInt("12345678").GetValue() == 12345678);
+    TEST_TRUE(NumberConversion::ParseUInt("1234567812345678").GetValue() == 1234567812345678);
+    TEST_FALSE(NumberConversion::ParseUInt("18446744073709551616"));
+    TEST_FALSE(NumberConversion::ParseUInt("36893488147419103232"));
+    TEST_FALSE(NumberConversion::ParseUInt("-1"));
+    TEST_FALSE(NumberConversion::ParseUInt("+1"));
+
+    // Narrower types check their own range.
+    TEST_TRUE(NumberConversion::ParseInt<i8>("-128").GetValue() == -128);
+    TEST_FALSE(NumberConversion::ParseInt<i8>("128"));
+    TEST_TRUE(NumberConversion::ParseUInt<u16>("65535").GetValue() == 65535);
+    TEST_FALSE(NumberConversion::ParseUInt<u16>("65536"));
+    TEST_FALSE(NumberConversion::ParseUInt<u32>("4294967296"));
+
+    // Whole text must be a number, including within eight digit chunks.
+    const char* invalid[] = { "", "-", "+", " 1", "1 ", "1.0", "0x10", "12345678a", "1234567a12345678", "1e3" };
+    for(const char* text : invalid)
+    {
+        TEST_FALSE(NumberConversion::ParseInt(text));
+        TEST_FALSE(NumberConversion::ParseUInt(text));
+    }
+
+    // Views into longer text do not read past their end.
+    const StringView digits = "123456789";
+    TEST_TRUE(NumberConversion::ParseUInt(StringView(digits.GetData(), 8)).GetValue() == 12345678);
+}
+
+TEST_DEFINE("Common.NumberConversion", "ParseFloat")
+{
+    TEST_TRUE(ParsesAsDouble("0", 0.0));
+    TEST_TRUE(ParsesAsDouble("-0", -0.0));
+    TEST_TRUE(ParsesAsDouble("1.5", 1.5));
+    TEST_TRUE(ParsesAsDouble("+.5", 0.5));
+    TEST_TRUE(ParsesAsDouble("2.", 2.0));
+    TEST_TRUE(ParsesAsDouble("1E3", 1000.0));
+    TEST_TRUE(ParsesAsDouble("0.1", 0.1));
+    TEST_TRUE(ParsesAsDouble("1e-400", 0.0));
+    TEST_TRUE(ParsesAsDouble("-1e-400", -0.0));
+    TEST_TRUE(ParsesAsDouble("0e999999999999", 0.0));
+    TEST_TRUE(ParsesAsDouble("1.7976931348623157e308", std::numeric_limits<f64>::max()));
+    TEST_TRUE(ParsesAsDouble("2.2250738585072014e-308", std::numeric_limits<f64>::min()));
+    TEST_TRUE(ParsesAsDouble("4.9406564584124654e-324", std::numeric_limits<f64>::denorm_min()));
+
+    // Values that are hard to round correctly, including halfway between two doubles.
+    const char* tricky[] =
+    {
+        "9007199254740993",
+        "9007199254740995",
+        "2.4703282292062327e-324",
+        "2.4703282292062328e-324",
+        "2.2250738585072011e-308",
+        "1.7976931348623158e308",
+        "7.038531e-26",
+        "3.141592653589793238462643383279502884197169399375105820974944",
+        "0.000000000000000000000000000000000000000000001e45",
+        "123456789012345678901234567890",
+        "1.00000000000000011102230246251565404236316680908203125",
+        "1.00000000000000011102230246251565404236316680908203124",
+        "1.00000000000000011102230246251565404236316680908203126",
+        "4503599627370496.5",
+        "4503599627370497.5",
+        "1448997445238699",
+        "8.98846567431158e307",
+    };
+
+    for(const char* text : tricky)
+    {
+        TEST_TRUE(ParsesAsStandardDouble(text));
+        TEST_TRUE(ParsesAsStandardFloat(text));
+    }
+
+    TEST_TRUE(NumberConversion::ParseFloat<f32>("3.4028235e38").GetValue() == std::numeric_limits<f32>::max());
+    TEST_TRUE(NumberConversion::ParseFloat<f32>("1.4e-45").GetValue() == std::numeric_limits<f32>::denorm_min());
+    TEST_TRUE(NumberConversion::ParseFloat<f32>("0.1").GetValue() == 0.1f);
+
+    // Overflow fails instead of returning infinity.
+    TEST_FALSE(NumberConversion::ParseFloat<f64>("1.8e308"));
+    TEST_FALSE(NumberConversion::ParseFloat<f64>("1e999999999999"));
+    TEST_FALSE(NumberConversion::ParseFloat<f32>("3.5e38"));
+
+    const char* invalid[] = { "", "-", ".", "e5", "1e", "1e+", "1.2.3", "1,5", " 1", "1 ", "inf", "nan", "0x1p3", "--1" };
+    for(const char* text : invalid)
+    {
+        TEST_FALSE(NumberConversion::ParseFloat<f64>(text));
+        TEST_FALSE(NumberConversion::ParseFloat<f32>(text));
+    }
+
+    // Random digits of varying length and exponent, many beyond 19 significant digits.
+    u64 state = 0x9E3779B97F4A7C15;
+    for(u32 i = 0; i < 20000; ++i)
+    {
+        InlineString<64> text;
+        const u64 digitCount = 1 + NextTestNumber(state) % 30;
+        const u64 pointPosition = NextTestNumber(state) % (digitCount + 1);
+        for(u64 digit = 0; digit < digitCount; ++digit)
+        {
+            if(digit == pointPosition)
+            {
+                text += ".";
+            }
+
+            const char character = static_cast<char>('0' + NextTestNumber(state) % 10);
+            text += StringView(&character, 1);
+        }
+
+        text.Append("e%d", static_cast<i32>(NextTestNumber(state) % 700) - 350);
+
+        const f64 expected = std::strtod(*text, nullptr);
+        const Optional<f64> value = NumberConversion::ParseFloat<f64>(text);
+        TEST_TRUE(value.HasValue() == IsFiniteDouble(expected));
+        TEST_TRUE(!value || std::bit_cast<u64>(*value) == std::bit_cast<u64>(expected));
+
+        const f32 expectedFloat = std::strtof(*text, nullptr);
+        const Optional<f32> floatValue = NumberConversion::ParseFloat<f32>(text);
+        TEST_TRUE(floatValue.HasValue() == IsFiniteFloat(expectedFloat));
+        TEST_TRUE(!floatValue || std::bit_cast<u32>(*floatValue) == std::bit_cast<u32>(expectedFloat));
+    }
+}
+
+TEST_DEFINE("Common.NumberConversion", "ToChars")
+{
+    TEST_TRUE(FormatsAs(0, "0"));
+    TEST_TRUE(FormatsAs(-7, "-7"));
+    TEST_TRUE(FormatsAs(u8(255), "255"));
+    TEST_TRUE(FormatsAs(std::numeric_limits<i64>::min(), "-9223372036854775808"));
+    TEST_TRUE(FormatsAs(std::numeric_limits<u64>::max(), "18446744073709551615"));
+
+    TEST_TRUE(FormatsAs(0.0, "0"));
+    TEST_TRUE(FormatsAs(-0.0, "-0"));
+    TEST_TRUE(FormatsAs(1.5, "1.5"));
+    TEST_TRUE(FormatsAs(-100.0, "-100"));
+    TEST_TRUE(FormatsAs(0.1, "0.1"));
+    TEST_TRUE(FormatsAs(0.1 + 0.2, "0.30000000000000004"));
+    TEST_TRUE(FormatsAs(123.456, "123.456"));
+    TEST_TRUE(FormatsAs(1e20, "100000000000000000000"));
+    TEST_TRUE(FormatsAs(1e21, "1e+21"));
+    TEST_TRUE(FormatsAs(0.000001, "0.000001"));
+    TEST_TRUE(FormatsAs(1.5e-7, "1.5e-7"));
+    TEST_TRUE(FormatsAs(9007199254740993.0, "9007199254740992"));
+    TEST_TRUE(FormatsAs(std::numeric_limits<f64>::max(), "1.7976931348623157e+308"));
+    TEST_TRUE(FormatsAs(std::numeric_limits<f64>::min(), "2.2250738585072014e-308"));
+    TEST_TRUE(FormatsAs(std::numeric_limits<f64>::denorm_min(), "5e-324"));
+    TEST_TRUE(FormatsAs(std::bit_cast<f64>(2ull), "1e-323"));
+    TEST_TRUE(FormatsAs(-std::numeric_limits<f64>::lowest(), "1.7976931348623157e+308"));
+
+    TEST_TRUE(FormatsAs(0.1f, "0.1"));
+    TEST_TRUE(FormatsAs(1.0f / 3.0f, "0.33333334"));
+    TEST_TRUE(FormatsAs(16777216.0f, "16777216"));
+    TEST_TRUE(FormatsAs(std::numeric_limits<f32>::max(), "3.4028235e+38"));
+    TEST_TRUE(FormatsAs(std::numeric_limits<f32>::min(), "1.1754944e-38"));
+    TEST_TRUE(FormatsAs(std::numeric_limits<f32>::denorm_min(), "1e-45"));
+    TEST_TRUE(FormatsAs(std::bit_cast<f32>(2u), "3e-45"));
+
+    // Characters are appended in place after existing ones.
+    InlineString<16> text = "Value: ";
+    NumberConversion::ToChars(text, 42);
+    text += ", ";
+    NumberConversion::ToChars(text, -2.5);
+    text += ", ";
+    NumberConversion::ToChars(text, 0.25f);
+    TEST_TRUE(text == "Value: 42, -2.5, 0.25");
+    TEST_TRUE(text.GetData()[text.GetLength()] == '\0');
+
+    HeapString empty;
+    NumberConversion::ToChars(empty, 0u);
+    TEST_TRUE(empty == "0");
+}
+
+TEST_DEFINE("Common.NumberConversion", "RoundTrip")
+{
+    // Random bit patterns cover every exponent, including subnormals.
+    u64 state = 0x2545F4914F6CDD1D;
+    for(u32 i = 0; i < 20000; ++i)
+    {
+        const f64 value = std::bit_cast<f64>(NextTestNumber(state));
+        if(!IsFiniteDouble(value))
+            continue;
+
+        char buffer[NumberConversion::MaxFloatChars];
+        const u64 length = NumberConversion::ToChars(buffer, value);
+        const StringView text(buffer, length);
+
+        const Optional<f64> parsed = NumberConversion::ParseFloat<f64>(text);
+        TEST_TRUE(parsed && std::bit_cast<u64>(*parsed) == std::bit_cast<u64>(value));
+
+        const InlineString<64> terminated(text);
+        TEST_TRUE(std::bit_cast<u64>(std::strtod(*terminated, nullptr)) == std::bit_cast<u64>(value));
+
+        if(i % 10 == 0)
+        {
+            TEST_TRUE(CountSignificantDigits(text) == GetShortestDoubleLength(value));
+        }
+    }
+
+    for(u32 i = 0; i < 20000; ++i)
+    {
+        const f32 value = std::bit_cast<f32>(static_cast<u32>(NextTestNumber(state)));
+        if(!IsFiniteFloat(value))
+            continue;
+
+        char buffer[NumberConversion::MaxFloatChars];
+        const u64 length = NumberConversion::ToChars(buffer, value);
+        const StringView text(buffer, length);
+
+        const Optional<f32> parsed = NumberConversion::ParseFloat<f32>(text);
+        TEST_TRUE(parsed && std::bit_cast<u32>(*parsed) == std::bit_cast<u32>(value));
+
+        // Reference conversion to double flushes subnormals to zero with fast math.
+        const bool subnormal = (std::bit_cast<u32>(value) & 0x7F800000) == 0;
+        if(i % 10 == 0 && !subnormal)
+        {
+            TEST_TRUE(CountSignificantDigits(text) == GetShortestFloatLength(value));
+        }
+    }
+
+    // Integers around chunk boundaries of digit parsing.
+    for(u64 value = 1; value != 0 && value < std::numeric_limits<u64>::max() / 3; value = value * 3 + 1)
+    {
+        char buffer[NumberConversion::MaxIntegerChars];
+        const u64 length = NumberConversion::ToChars(buffer, value);
+        TEST_TRUE(NumberConversion::ParseUInt(StringView(buffer, length)).GetValue() == value);
+        TEST_TRUE(NumberConversion::ParseInt(StringView(buffer, length)).GetValue() == static_cast<i64>(value));
+    }
+}
+
+TEST_DEFINE("Common.NumberConversion", "Throughput")
+{
+    // Compares against standard library on the same text, which is prepared upfront.
+    const u64 valueCount = 100000;
+    HeapArray<f64> values;
+    values.Reserve(valueCount);
+
+    u64 state = 0x5DEECE66D;
+    for(u64 i = 0; i < valueCount; ++i)
+    {
+        const f64 mantissa = static_cast<f64>(NextTestNumber(state) % 1000000000) / 1000.0;
+        values.Add(mantissa * std::pow(10.0, static_cast<f64>(NextTestNumber(state) % 20) - 10.0));
+    }
+
+    HeapString text;
+    HeapArray<StringView> texts;
+    HeapArray<u64> offsets;
+    text.Reserve(valueCount * NumberConversion::MaxFloatChars);
+    for(const f64 value : values)
+    {
+        offsets.Add(text.GetLength());
+        NumberConversion::ToChars(text, value);
+        text += " ";
+    }
+
+    for(u64 i = 0; i < valueCount; ++i)
+    {
+        const u64 end = i + 1 < valueCount ? offsets[i + 1] - 1 : text.GetLength() - 1;
+        texts.Add(StringView(text.GetData() + offsets[i], end - offsets[i]));
+    }
+
+    f64 sum = 0.0;
+    u64 startTick = Time::GetCurrentTick();
+    for(const StringView& value : texts)
+    {
+        sum += NumberConversion::ParseFloat<f64>(value).GetValue();
+    }
+
+    const f32 parseSeconds = Time::ConvertTicksToSeconds(Time::GetCurrentTick() - startTick);
+
+    f64 standardSum = 0.0;
+    startTick = Time::GetCurrentTick();
+    for(const u64 offset : offsets)
+    {
+        // Parsing stops at separating space.
+        standardSum += std::strtod(text.GetData() + offset, nullptr);
+    }
+
+    const f32 standardParseSeconds = Time::ConvertTicksToSeconds(Time::GetCurrentTick() - startTick);
+    TEST_TRUE(std::bit_cast<u64>(sum) == std::bit_cast<u64>(standardSum));
+
+    u64 length = 0;
+    char buffer[64];
+    startTick = Time::GetCurrentTick();
+    for(const f64 value : values)
+    {
+        length += NumberConversion::ToChars(buffer, value);
+    }
+
+    const f32 formatSeconds = Time::ConvertTicksToSeconds(Time::GetCurrentTick() - startTick);
+
+    u64 standardLength = 0;
+    startTick = Time::GetCurrentTick();
+    for(const f64 value : values)
+    {
+        standardLength += std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+    }
+
+    const f32 standardFormatSeconds = Time::ConvertTicksToSeconds(Time::GetCurrentTick() - startTick);
+    TEST_TRUE(length <= standardLength);
+
+    const auto perSecond = [valueCount](const f32 seconds)
+    {
+        return valueCount / std::max(seconds, 0.000001f) / 1000000.0f;
+    };
+
+    LOG_INFO("Float parsing: %.2f million values per second (strtod: %.2f)",
+        perSecond(parseSeconds), perSecond(standardParseSeconds));
+    LOG_INFO("Float formatting: %.2f million values per second (snprintf: %.2f)",
+        perSecond(formatSeconds), perSecond(standardFormatSeconds));
+}
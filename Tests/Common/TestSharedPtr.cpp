@@ -0,0 +1,201 @@
+#include "Shared.hpp"
+
+namespace
+{
+    class SharedTestCounted final : public RefCounted<SharedTestCounted>
+    {
+    public:
+        static inline u64 s_destroyCount = 0;
+        u64 value = 0;
+
+        explicit SharedTestCounted(const u64 value)
+            : value(value)
+        {}
+
+        ~SharedTestCounted()
+        {
+            ++s_destroyCount;
+        }
+    };
+}
+
+TEST_DEFINE("Common.SharedPtr", "Empty")
+{
+    SharedPtr<Test::Object> ptr;
+    TEST_FALSE(ptr);
+    TEST_TRUE(ptr == nullptr);
+    TEST_TRUE(ptr.Get() == nullptr);
+    TEST_TRUE(ptr.GetRefCount() == 0);
+
+    WeakPtr<Test::Object> weak(ptr);
+    TEST_TRUE(weak.IsExpired());
+    TEST_FALSE(weak.Lock());
+
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(0, 0));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(0, 0, 0, 0));
+}
+
+TEST_DEFINE("Common.SharedPtr", "MakeShared")
+{
+    {
+        SharedPtr ptr = MakeShared<Test::Object>(64);
+        TEST_TRUE(ptr);
+        TEST_TRUE(ptr->GetControlValue() == 64);
+        TEST_TRUE(ptr.GetRefCount() == 1);
+
+        // Control block and object share a single allocation.
+        TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1));
+        TEST_TRUE(objectGuard.ValidateCurrentInstances(1));
+
+        SharedPtr<Test::Object> copy = ptr;
+        TEST_TRUE(copy == ptr);
+        TEST_TRUE(ptr.GetRefCount() == 2);
+
+        SharedPtr<Test::Object> moved = Move(copy);
+        TEST_FALSE(copy);
+        TEST_TRUE(moved == ptr);
+        TEST_TRUE(ptr.GetRefCount() == 2);
+
+        moved.Reset();
+        TEST_TRUE(ptr.GetRefCount() == 1);
+        TEST_TRUE(objectGuard.ValidateCurrentInstances(1));
+    }
+
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(0));
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(1, 1, 0, 0));
+}
+
+TEST_DEFINE("Common.SharedPtr", "Inheritance")
+{
+    SharedPtr ptrDerived = MakeShared<Test::ObjectDerived>(64);
+    SharedPtr<Test::Object> ptrBase = ptrDerived;
+    TEST_TRUE(ptrBase->IsDerived());
+    TEST_TRUE(ptrBase.GetRefCount() == 2);
+
+    ptrDerived.Reset();
+    TEST_TRUE(objectGuard.ValidateCurrentInstances(1));
+
+    ptrBase = nullptr;
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(0));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(1, 1, 0, 0));
+}
+
+TEST_DEFINE("Common.SharedPtr", "WeakPtr")
+{
+    SharedPtr ptr = MakeShared<Test::Object>(64);
+    WeakPtr<Test::Object> weak = ptr;
+    WeakPtr<Test::Object> weakCopy = weak;
+    TEST_FALSE(weak.IsExpired());
+    TEST_TRUE(ptr.GetRefCount() == 1);
+
+    {
+        SharedPtr<Test::Object> locked = weakCopy.Lock();
+        TEST_TRUE(locked == ptr);
+        TEST_TRUE(locked->GetControlValue() == 64);
+        TEST_TRUE(ptr.GetRefCount() == 2);
+    }
+
+    // Object is destroyed with last strong reference, while its memory waits for weak references.
+    ptr.Reset();
+    TEST_TRUE(objectGuard.ValidateCurrentInstances(0));
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1));
+    TEST_TRUE(weak.IsExpired());
+    TEST_FALSE(weak.Lock());
+
+    weak.Reset();
+    weakCopy.Reset();
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(0));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(1, 1, 0, 0));
+}
+
+TEST_DEFINE("Common.SharedPtr", "FromUniquePtr")
+{
+    SharedPtr<Test::Object> ptr = UniquePtr(Memory::New<Test::ObjectDerived>(64));
+    TEST_TRUE(ptr->IsDerived());
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(2));
+
+    SharedPtr<Test::Object> empty = UniquePtr<Test::Object>();
+    TEST_FALSE(empty);
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(2));
+
+    ptr.Reset();
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(0));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(1, 1, 0, 0));
+}
+
+TEST_DEFINE("Common.SharedPtr", "Local")
+{
+    static_assert(sizeof(LocalSharedPtr<Test::Object>) == sizeof(SharedPtr<Test::Object>));
+
+    LocalSharedPtr<Test::Object> ptr = MakeLocalShared<Test::Object>(64);
+    LocalWeakPtr<Test::Object> weak = ptr;
+    LocalSharedPtr<Test::Object> copy = weak.Lock();
+    TEST_TRUE(copy.GetRefCount() == 2);
+
+    ptr.Reset();
+    copy.Reset();
+    TEST_TRUE(weak.IsExpired());
+    TEST_TRUE(objectGuard.ValidateCurrentInstances(0));
+}
+
+TEST_DEFINE("Common.SharedPtr", "Concurrent")
+{
+    // Threads copy and release references while main thread drops its own.
+    const u32 threadCount = 4;
+    const u32 iterationCount = 10000;
+
+    SharedPtr ptr = MakeShared<Test::Object>(64);
+    WeakPtr<Test::Object> weak = ptr;
+    Thread::Handle threads[threadCount];
+    for(Thread::Handle& thread : threads)
+    {
+        thread = Thread::Create(Thread::Config(), [ptr, iterationCount]()
+        {
+            for(u32 i = 0; i < iterationCount; ++i)
+            {
+                SharedPtr<Test::Object> copy = ptr;
+                WeakPtr<Test::Object> weakCopy = copy;
+                TEST_TRUE(weakCopy.Lock()->GetControlValue() == 64);
+            }
+        });
+    }
+
+    ptr.Reset();
+    for(Thread::Handle& thread : threads)
+    {
+        thread.Join();
+    }
+
+    TEST_TRUE(weak.IsExpired());
+    TEST_TRUE(objectGuard.ValidateCurrentInstances(0));
+}
+
+TEST_DEFINE("Common.SharedPtr", "RefCounted")
+{
+    SharedTestCounted::s_destroyCount = 0;
+    static_assert(sizeof(RefPtr<SharedTestCounted>) == sizeof(SharedTestCounted*));
+
+    {
+        RefPtr ptr = MakeRef<SharedTestCounted>(64);
+        TEST_TRUE(ptr->value == 64);
+        TEST_TRUE(ptr->GetRefCount() == 1);
+        TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1, sizeof(SharedTestCounted)));
+
+        // Reference can be recreated from raw pointer, as count lives in the object.
+        RefPtr<SharedTestCounted> fromRaw = ptr.Get();
+        TEST_TRUE(ptr->GetRefCount() == 2);
+
+        RefPtr<SharedTestCounted> moved = Move(fromRaw);
+        TEST_FALSE(fromRaw);
+        TEST_TRUE(ptr->GetRefCount() == 2);
+
+        moved = ptr;
+        moved = moved;
+        TEST_TRUE(ptr->GetRefCount() == 2);
+        TEST_TRUE(SharedTestCounted::s_destroyCount == 0);
+    }
+
+    TEST_TRUE(SharedTestCounted::s_destroyCount == 1);
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(0));
+}
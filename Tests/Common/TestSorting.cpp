@@ -10,3 +10,42 @@ TEST_DEFINE("Common.Sorting", "InsertionSort")
     TEST_TRUE(array[2] == 3);
     TEST_TRUE(array[3] == 4);
 }
+
+TEST_DEFINE("Common.Sorting", "RadixSort")
+{
+    struct Element
+    {
+        u64 key;
+        u32 order;
+    };
+
+    // Keys differ in low and high bytes, and equal keys must keep their original order.
+    const u64 keys[] = { 0x0300000000000001, 0x0100000000000002, 0x0300000000000001, 0x0000000000000005, 0x0100000000000002, 0x0300000000000000 };
+    HeapArray<Element> elements;
+    HeapArray<Element> scratch;
+    scratch.Resize(std::size(keys));
+    for(u32 i = 0; i < std::size(keys); ++i)
+    {
+        elements.Add(Element{ keys[i], i });
+    }
+
+    RadixSort(elements.GetBeginPtr(), elements.GetEndPtr(), scratch.GetBeginPtr(), [](const Element& element)
+    {
+        return element.key;
+    });
+
+    const u32 expectedOrder[] = { 3, 1, 4, 5, 0, 2 };
+    for(u32 i = 0; i < std::size(expectedOrder); ++i)
+    {
+        TEST_TRUE(elements[i].order == expectedOrder[i]);
+    }
+
+    // Already uniform keys skip all passes and leave elements in place.
+    HeapArray<u64> uniform = { 7, 7, 7 };
+    u64 uniformScratch[3];
+    RadixSort(uniform.GetBeginPtr(), uniform.GetEndPtr(), uniformScratch, [](const u64 value)
+    {
+        return value;
+    });
+    TEST_TRUE(uniform[0] == 7 && uniform[2] == 7);
+}
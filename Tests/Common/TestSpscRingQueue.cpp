@@ -0,0 +1,157 @@
+#include "Shared.hpp"
+#include "Common/Containers/SpscRingQueue.hpp"
+#include "Platform/Time.hpp"
+
+TEST_DEFINE("Common.SpscRingQueue", "Empty")
+{
+    SpscRingQueue<u32> queue(5);
+    TEST_TRUE(queue.GetCapacity() == 8);
+    TEST_TRUE(queue.GetSize() == 0);
+    TEST_TRUE(queue.IsEmpty());
+
+    u32 value = 0;
+    TEST_TRUE(!queue.Pop(value));
+    TEST_TRUE(queue.PopBatch(&value, 1) == 0);
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1, sizeof(u32) * 8));
+}
+
+TEST_DEFINE("Common.SpscRingQueue", "PushPop")
+{
+    SpscRingQueue<u32> queue(4);
+
+    // Indices wrap around the ring multiple times.
+    u32 value = 0;
+    for(u32 lap = 0; lap < 3; ++lap)
+    {
+        for(u32 i = 0; i < 4; ++i)
+        {
+            TEST_TRUE(queue.Push(lap * 10 + i));
+        }
+
+        TEST_TRUE(!queue.Push(100u));
+        TEST_TRUE(queue.GetSize() == 4);
+
+        for(u32 i = 0; i < 4; ++i)
+        {
+            TEST_TRUE(queue.Pop(value));
+            TEST_TRUE(value == lap * 10 + i);
+        }
+
+        TEST_TRUE(!queue.Pop(value));
+    }
+}
+
+TEST_DEFINE("Common.SpscRingQueue", "Batch")
+{
+    SpscRingQueue<u32> queue(8);
+
+    const u32 input[] = { 0, 1, 2, 3, 4, 5 };
+    TEST_TRUE(queue.PushBatch(input, 6) == 6);
+    TEST_TRUE(queue.PushBatch(input, 6) == 2);
+    TEST_TRUE(queue.PushBatch(input, 6) == 0);
+
+    u32 output[8] = {};
+    TEST_TRUE(queue.PopBatch(output, 4) == 4);
+    TEST_TRUE(output[0] == 0 && output[3] == 3);
+
+    TEST_TRUE(queue.PopBatch(output, 8) == 4);
+    TEST_TRUE(output[0] == 4 && output[1] == 5 && output[2] == 0 && output[3] == 1);
+    TEST_TRUE(queue.IsEmpty());
+}
+
+TEST_DEFINE("Common.SpscRingQueue", "Objects")
+{
+    {
+        SpscRingQueue<Test::Object> queue(4);
+        TEST_TRUE(queue.Push(1u));
+        TEST_TRUE(queue.Push(Test::Object(2)));
+        TEST_TRUE(queue.Push(3u));
+        TEST_TRUE(objectGuard.ValidateCurrentInstances(3));
+
+        Test::Object object;
+        TEST_TRUE(queue.Pop(object));
+        TEST_TRUE(object == 1u);
+        TEST_TRUE(objectGuard.ValidateCurrentInstances(3));
+    }
+
+    // Elements left in the queue are destroyed with it.
+    TEST_TRUE(objectGuard.ValidateCurrentInstances(0));
+    TEST_TRUE(objectGuard.ValidateTotalCopies(0));
+}
+
+TEST_DEFINE("Common.SpscRingQueue", "Inline")
+{
+    InlineSpscRingQueue<u64, 16> queue;
+    TEST_TRUE(queue.GetCapacity() == 16);
+
+    for(u64 i = 0; i < 16; ++i)
+    {
+        TEST_TRUE(queue.Push(i));
+    }
+
+    TEST_TRUE(!queue.Push(16ull));
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(0, 0));
+}
+
+TEST_DEFINE("Common.SpscRingQueue", "Throughput")
+{
+    // Producer and consumer run on separate threads and
+    // spin whenever the queue is full or empty.
+    const u64 itemCount = 100000;
+    const u64 batchSize = 32;
+    SpscRingQueue<u64> queue(1024);
+
+    const u64 startTick = Time::GetCurrentTick();
+    std::thread producer([&queue, itemCount, batchSize]()
+    {
+        u64 batch[batchSize];
+        u64 next = 0;
+        while(next < itemCount)
+        {
+            const u64 count = std::min(batchSize, itemCount - next);
+            for(u64 i = 0; i < count; ++i)
+            {
+                batch[i] = next + i;
+            }
+
+            u64 pushed = 0;
+            while(pushed < count)
+            {
+                const u64 result = queue.PushBatch(batch + pushed, count - pushed);
+                if(result == 0)
+                {
+                    Thread::Yield();
+                }
+
+                pushed += result;
+            }
+
+            next += count;
+        }
+    });
+
+    u64 batch[batchSize];
+    u64 expected = 0;
+    bool ordered = true;
+    while(expected < itemCount)
+    {
+        const u64 count = queue.PopBatch(batch, batchSize);
+        if(count == 0)
+        {
+            Thread::Yield();
+            continue;
+        }
+
+        for(u64 i = 0; i < count; ++i)
+        {
+            ordered &= batch[i] == expected++;
+        }
+    }
+
+    producer.join();
+    const f32 seconds = Time::ConvertTicksToSeconds(Time::GetCurrentTick() - startTick);
+
+    TEST_TRUE(ordered);
+    TEST_TRUE(queue.IsEmpty());
+    LOG_INFO("SPSC ring queue throughput: %.2f million items per second", itemCount / std::max(seconds, 0.000001f) / 1000000.0f);
+}
@@ -0,0 +1,171 @@
+#include "Shared.hpp"
+
+TEST_DEFINE("Common.StringBuilder", "Empty")
+{
+    StringBuilder builder;
+    TEST_TRUE(builder.IsEmpty());
+    TEST_TRUE(builder.GetLength() == 0);
+    TEST_TRUE(builder.GetChunkCount() == 0);
+    TEST_TRUE(builder.Build().IsEmpty());
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(0, 0));
+}
+
+TEST_DEFINE("Common.StringBuilder", "Append")
+{
+    StringBuilder builder;
+    builder.Append("Hello %s", "world");
+    builder.AppendText("!");
+    builder.Append(" %u + %u = %u", 2, 2, 4);
+
+    TEST_TRUE(builder.GetLength() == 22);
+    TEST_TRUE(builder.GetChunkCount() == 1);
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1));
+
+    const String result = builder.Build();
+    TEST_TRUE(result == "Hello world! 2 + 2 = 4");
+    TEST_TRUE(result.IsNullTerminated());
+}
+
+TEST_DEFINE("Common.StringBuilder", "Chunks")
+{
+    // Content never moves once appended, new chunks are added instead.
+    StringBuilder builder;
+    HeapString expected;
+    for(u32 i = 0; i < 1000; ++i)
+    {
+        builder.Append("Line %u\n", i);
+        expected.Append("Line %u\n", i);
+    }
+
+    const StringView largeText = "0123456789";
+    for(u32 i = 0; i < 100; ++i)
+    {
+        builder.AppendText(largeText);
+        expected += largeText;
+    }
+
+    TEST_TRUE(builder.GetLength() == expected.GetLength());
+    TEST_TRUE(builder.GetChunkCount() > 1);
+
+    u64 chunkCount = 0;
+    u64 chunkLength = 0;
+    builder.ForEachChunk([&](const StringView& chunk)
+    {
+        ++chunkCount;
+        chunkLength += chunk.GetLength();
+    });
+
+    TEST_TRUE(chunkCount == builder.GetChunkCount());
+    TEST_TRUE(chunkLength == expected.GetLength());
+    TEST_TRUE(builder.Build<Memory::Allocators::Default>() == expected);
+}
+
+TEST_DEFINE("Common.StringBuilder", "LargeAppend")
+{
+    // Appends larger than maximum chunk capacity receive chunk of their own.
+    StringBuilder builder;
+    builder.AppendText("Prefix");
+
+    HeapString largeText;
+    largeText.Resize(StringBuilder::MaxChunkCapacity * 2, 'x');
+    builder.AppendText(largeText);
+    builder.Append("%s", *largeText);
+
+    TEST_TRUE(builder.GetLength() == 6 + largeText.GetLength() * 2);
+    TEST_TRUE(builder.GetChunkCount() == 3);
+
+    const HeapString result = builder.Build<Memory::Allocators::Default>();
+    TEST_TRUE(result.StartsWith("Prefixxxx"));
+    TEST_TRUE(result.GetLength() == builder.GetLength());
+}
+
+TEST_DEFINE("Common.StringBuilder", "MoveAndClear")
+{
+    StringBuilder builder;
+    builder.AppendText("Hello");
+
+    StringBuilder moved(Move(builder));
+    TEST_TRUE(builder.IsEmpty());
+    TEST_TRUE(builder.GetChunkCount() == 0);
+    TEST_TRUE(moved.GetLength() == 5);
+
+    moved.Clear();
+    TEST_TRUE(moved.IsEmpty());
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(0));
+}
+
+TEST_DEFINE("Common.StringBuilder", "WriteToFile")
+{
+    const StringView filePath = "TestStringBuilder.txt";
+
+    SCOPE_GUARD
+    {
+        std::remove(*filePath);
+    };
+
+    StringBuilder builder;
+    for(u32 i = 0; i < 300000; ++i)
+    {
+        builder.Append("add_test(Test.%u)\n", i);
+    }
+
+    // Enough chunks to require multiple vectored writes.
+    TEST_TRUE(builder.GetChunkCount() > 64);
+    TEST_TRUE(WriteStringBuilderToFile(filePath, builder));
+    TEST_TRUE(CheckFileEqualsString(filePath, builder.Build<Memory::Allocators::Default>()));
+}
+
+TEST_DEFINE("Common.StringBuilder", "WriteToFileIfDifferent")
+{
+    const StringView filePath = "TestStringBuilderIfDifferent.txt";
+
+    SCOPE_GUARD
+    {
+        std::remove(*filePath);
+    };
+
+    StringBuilder builder;
+    for(u32 i = 0; i < 10000; ++i)
+    {
+        builder.Append("add_test(Test.%u)\n", i);
+    }
+
+    TEST_FALSE(CheckFileEqualsStringBuilder(filePath, builder));
+    TEST_TRUE(WriteStringBuilderToFileIfDifferent(filePath, builder));
+    TEST_TRUE(CheckFileEqualsStringBuilder(filePath, builder));
+    TEST_TRUE(CheckFileEqualsString(filePath, builder.Build<Memory::Allocators::Default>()));
+    TEST_TRUE(WriteStringBuilderToFileIfDifferent(filePath, builder));
+
+    // Text that differs only in last chunk is still detected.
+    builder.Append("add_test(Test.Last)\n");
+    TEST_FALSE(CheckFileEqualsStringBuilder(filePath, builder));
+    TEST_TRUE(WriteStringBuilderToFileIfDifferent(filePath, builder));
+    TEST_TRUE(CheckFileEqualsStringBuilder(filePath, builder));
+}
+
+TEST_DEFINE("Common.StringBuilder", "WriteToFileSynced")
+{
+    const StringView filePath = "TestStringBuilderSynced.txt";
+
+    SCOPE_GUARD
+    {
+        std::remove(*filePath);
+    };
+
+    StringBuilder builder;
+    builder.Append("Synced contents\n");
+
+    TEST_TRUE(Platform::WriteStringBuilderToFileSynced(filePath, builder));
+    TEST_TRUE(CheckFileEqualsStringBuilder(filePath, builder));
+
+    // Existing file is never overwritten, and is left untouched.
+    StringBuilder otherBuilder;
+    otherBuilder.Append("Other contents\n");
+
+    {
+        LOG_MINIMUM_SEVERITY_SCOPE(Logger::Severity::Fatal);
+        TEST_FALSE(Platform::WriteStringBuilderToFileSynced(filePath, otherBuilder));
+    }
+
+    TEST_TRUE(CheckFileEqualsStringBuilder(filePath, builder));
+}
@@ -0,0 +1,111 @@
+#include "Shared.hpp"
+
+TEST_DEFINE("Common.StringId", "Invalid")
+{
+    StringId id;
+    TEST_FALSE(id.IsValid());
+    TEST_TRUE(id.GetHash() == 0);
+    TEST_TRUE(id.GetString().IsEmpty());
+    TEST_TRUE(StringId("") == id);
+    TEST_TRUE(""_sid == id);
+}
+
+TEST_DEFINE("Common.StringId", "CompileTime")
+{
+    constexpr StringId id = "Common.StringId.CompileTime"_sid;
+    static_assert(id.IsValid());
+    static_assert(id == StringId::Compute("Common.StringId.CompileTime", 27));
+    static_assert(id != "Common.StringId.Other"_sid);
+
+    TEST_TRUE(id == StringId::Compute(StringView("Common.StringId.CompileTime")));
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(0, 0));
+}
+
+TEST_DEFINE("Common.StringId", "Intern")
+{
+    const StringView text = "Common.StringId.InternedText";
+    TEST_TRUE(StringId::Compute(text).GetString().IsEmpty());
+
+    const StringId id(text);
+    TEST_TRUE(id.IsValid());
+    TEST_TRUE(id == "Common.StringId.InternedText"_sid);
+    TEST_TRUE(id.GetString() == text);
+    TEST_TRUE(id.GetString().GetData() != text.GetData());
+    TEST_TRUE(id.GetString().IsNullTerminated());
+
+    // Interning same string again returns same identifier and storage.
+    const InlineString<32> copy = text;
+    const StringId other(copy);
+    TEST_TRUE(other == id);
+    TEST_TRUE(other.GetString().GetData() == id.GetString().GetData());
+    TEST_TRUE(StringId::Compute(text).GetString() == text);
+
+    // Table storage lives until process exit and is not tracked.
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(0, 0));
+}
+
+TEST_DEFINE("Common.StringId", "Grow")
+{
+    const u32 count = 4096;
+    for(u32 i = 0; i < count; ++i)
+    {
+        StringId(InlineString<64>::Format("Common.StringId.Grow.%u", i));
+    }
+
+    for(u32 i = 0; i < count; ++i)
+    {
+        const auto text = InlineString<64>::Format("Common.StringId.Grow.%u", i);
+        TEST_TRUE(StringId::Compute(text).GetString() == text);
+    }
+}
+
+TEST_DEFINE("Common.StringId", "Concurrent")
+{
+    // Readers resolve identifiers while writers keep growing the table.
+    const u32 threadCount = 4;
+    const u32 count = 2048;
+    const StringId resolved("Common.StringId.Concurrent");
+
+    std::atomic<u32> failures = 0;
+    std::atomic<bool> writing = true;
+    std::thread reader([&]()
+    {
+        while(writing.load(std::memory_order_relaxed))
+        {
+            if(resolved.GetString() != "Common.StringId.Concurrent")
+            {
+                failures.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    std::thread writers[threadCount];
+    for(u32 thread = 0; thread < threadCount; ++thread)
+    {
+        writers[thread] = std::thread([&failures, thread]()
+        {
+            for(u32 i = 0; i < count; ++i)
+            {
+                // Half of the strings are shared between threads.
+                const auto text = InlineString<64>::Format("Common.StringId.Concurrent.%u.%u",
+                    i % 2 == 0 ? 0 : thread, i);
+
+                const StringId id(text);
+                if(id.GetString() != text)
+                {
+                    failures.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    for(std::thread& writer : writers)
+    {
+        writer.join();
+    }
+
+    writing.store(false, std::memory_order_relaxed);
+    reader.join();
+
+    TEST_TRUE(failures.load() == 0);
+}
@@ -143,3 +143,27 @@ TEST_DEFINE("Common.StringShared", "Accessors")
 
     TEST_TRUE(memoryGuard.ValidateTotalAllocations(0, 0));
 }
+
+TEST_DEFINE("Common.StringShared", "WideCharacters")
+{
+    String16 string(u"Hello world!");
+    TEST_TRUE(string.GetLength() == 12);
+    TEST_TRUE(string == u"Hello world!");
+    TEST_TRUE(string.FindIndex(u"world").GetValue() == 6);
+    TEST_FALSE(string.FindIndex(u"missing"));
+    TEST_TRUE(string.StartsWith(u"Hello"));
+    TEST_FALSE(string.StartsWith(u"Help"));
+    TEST_TRUE(string.EndsWith(u"world!"));
+    TEST_FALSE(string.EndsWith(u"word!"));
+
+    // Bytes of needle appear in text, but only across character boundary.
+    const String32 boundary(U"\x00000100\x00000001");
+    TEST_FALSE(boundary.FindIndex(U"\x00010000"));
+    TEST_TRUE(boundary.FindIndex(U"\x00000001").GetValue() == 1);
+
+    StringView32 view;
+    TEST_TRUE(view.IsEmpty());
+    TEST_TRUE(view.IsNullTerminated());
+    view = StringView32(boundary);
+    TEST_TRUE(view == boundary.GetData());
+}
@@ -202,6 +202,16 @@ TEST_DEFINE("Common.StringView", "ComparisonOperators")
     TEST_FALSE(string1 == string2);
     TEST_FALSE(string2 == string1);
 
+    StringView string3 = "Hello!";
+    StringView string4 = "Jello";
+    TEST_TRUE(string1 != string3);
+    TEST_TRUE(string3 != string1);
+    TEST_TRUE(string1 != string4);
+    TEST_TRUE(string1 != "Hello!");
+    TEST_TRUE(string1 != "Jello");
+    TEST_FALSE(string1 != "Hello");
+    TEST_FALSE(string1 != string1);
+
     TEST_TRUE(memoryGuard.ValidateTotalAllocations(0, 0));
 }
 
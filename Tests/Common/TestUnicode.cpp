@@ -0,0 +1,263 @@
+#include "Shared.hpp"
+#include "Common/Utility/Unicode.hpp"
+#include "Platform/Time.hpp"
+
+namespace
+{
+    u64 NextTestCodepoint(u64& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    const char* const ValidUtf8Samples[] =
+    {
+        "",
+        "Hello world!",
+        "Za\xC5\xBC\xC3\xB3\xC5\x82\xC4\x87 g\xC4\x99\xC5\x9Bl\xC4\x85 ja\xC5\xBA\xC5\x84",
+        "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E",
+        "\xF0\x9F\x98\x80",
+        "\x7F\xC2\x80\xDF\xBF\xE0\xA0\x80\xEF\xBF\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF",
+    };
+
+    const char* const InvalidUtf8Samples[] =
+    {
+        "\x80",
+        "\xBF",
+        "\xC0\xAF",
+        "\xC1\xBF",
+        "\xC2",
+        "\xC2\x41",
+        "\xE0\x80\xAF",
+        "\xE0\x9F\xBF",
+        "\xED\xA0\x80",
+        "\xED\xBF\xBF",
+        "\xE6\x97",
+        "\xF0\x8F\xBF\xBF",
+        "\xF4\x90\x80\x80",
+        "\xF5\x80\x80\x80",
+        "\xF0\x9F\x98",
+        "\xFE",
+        "\xFF",
+    };
+}
+
+TEST_DEFINE("Common.Unicode", "Validation")
+{
+    for(const char* sample : ValidUtf8Samples)
+    {
+        TEST_TRUE(Unicode::IsValidUtf8(sample));
+    }
+
+    for(const char* sample : InvalidUtf8Samples)
+    {
+        TEST_FALSE(Unicode::IsValidUtf8(sample));
+    }
+
+    // Errors are found at every position relative to blocks scanned for ASCII characters.
+    for(u64 offset = 0; offset < 40; ++offset)
+    {
+        for(const char* sample : InvalidUtf8Samples)
+        {
+            HeapString text;
+            text.Resize(offset, 'a');
+            text += sample;
+            text += "bcdefghijklmnopqrstuvwxyz";
+            TEST_FALSE(Unicode::IsValidUtf8(text));
+        }
+
+        HeapString text;
+        text.Resize(offset, 'a');
+        text += ValidUtf8Samples[5];
+        TEST_TRUE(Unicode::IsValidUtf8(text));
+        TEST_FALSE(Unicode::IsValidUtf8(StringView(text.GetData(), text.GetLength() - 1)));
+    }
+
+    TEST_TRUE(Unicode::IsValidUtf16(u"日本\U0001F600"));
+    TEST_FALSE(Unicode::IsValidUtf16(StringView16(u"\xD83D", 1)));
+    TEST_FALSE(Unicode::IsValidUtf16(u"\xDE00\xD83D"));
+    TEST_FALSE(Unicode::IsValidUtf16(u"\xD83D" u"a"));
+
+    TEST_TRUE(Unicode::IsValidUtf32(U"\U0010FFFF"));
+    TEST_FALSE(Unicode::IsValidUtf32(StringView32(U"\x110000", 1)));
+    TEST_FALSE(Unicode::IsValidUtf32(StringView32(U"\xD800", 1)));
+}
+
+TEST_DEFINE("Common.Unicode", "Codepoints")
+{
+    const char* text = "a\xC5\xBC\xE6\x97\xA5\xF0\x9F\x98\x80";
+    const char32_t expected[] = { U'a', 0x017C, 0x65E5, 0x1F600 };
+
+    u64 index = 0;
+    for(const char32_t codepoint : Unicode::Codepoints(text))
+    {
+        TEST_TRUE(index < std::size(expected) && codepoint == expected[index]);
+        ++index;
+    }
+
+    TEST_TRUE(index == std::size(expected));
+    TEST_TRUE(Unicode::CountCodepoints(text) == 4);
+    TEST_TRUE(Unicode::CountCodepoints("") == 0);
+
+    // Each maximal invalid prefix becomes single replacement.
+    const char* invalid = "\xE6\x97" "A\xF0\x80\xC0\xAF\xED\xA0\x80" "B";
+    const char32_t replacement = Unicode::ReplacementCodepoint;
+    const char32_t expectedInvalid[] =
+    {
+        replacement, U'A', replacement, replacement, replacement, replacement,
+        replacement, replacement, replacement, U'B'
+    };
+
+    index = 0;
+    for(const char32_t codepoint : Unicode::Codepoints(invalid))
+    {
+        TEST_TRUE(index < std::size(expectedInvalid) && codepoint == expectedInvalid[index]);
+        ++index;
+    }
+
+    TEST_TRUE(index == std::size(expectedInvalid));
+
+    char buffer[Unicode::MaxUtf8Units];
+    TEST_TRUE(StringView(buffer, Unicode::EncodeUtf8(U'a', buffer)) == "a");
+    TEST_TRUE(StringView(buffer, Unicode::EncodeUtf8(0x017C, buffer)) == "\xC5\xBC");
+    TEST_TRUE(StringView(buffer, Unicode::EncodeUtf8(0x65E5, buffer)) == "\xE6\x97\xA5");
+    TEST_TRUE(StringView(buffer, Unicode::EncodeUtf8(0x1F600, buffer)) == "\xF0\x9F\x98\x80");
+    TEST_TRUE(StringView(buffer, Unicode::EncodeUtf8(0xD800, buffer)) == "\xEF\xBF\xBD");
+    TEST_TRUE(StringView(buffer, Unicode::EncodeUtf8(0x110000, buffer)) == "\xEF\xBF\xBD");
+}
+
+TEST_DEFINE("Common.Unicode", "Conversion")
+{
+    const StringView text = "Za\xC5\xBC\xC3\xB3\xC5\x82\xC4\x87 g\xC4\x99\xC5\x9Bl\xC4\x85 "
+        "ja\xC5\xBA\xC5\x84, \xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E \xF0\x9F\x98\x80 and plain ASCII text";
+    const char16_t* text16 = u"Zażółć gęślą jaźń, "
+        u"日本語 \U0001F600 and plain ASCII text";
+    const char32_t* text32 = U"Zażółć gęślą jaźń, "
+        U"日本語 \U0001F600 and plain ASCII text";
+
+    String16 utf16;
+    TEST_TRUE(Unicode::Convert(text, utf16));
+    TEST_TRUE(utf16 == text16);
+    TEST_TRUE(utf16.GetData()[utf16.GetLength()] == u'\0');
+
+    String32 utf32;
+    TEST_TRUE(Unicode::Convert(text, utf32));
+    TEST_TRUE(utf32 == text32);
+    TEST_TRUE(utf32.GetLength() == Unicode::CountCodepoints(text));
+
+    HeapString utf8;
+    TEST_TRUE(Unicode::Convert(utf16, utf8));
+    TEST_TRUE(utf8 == text);
+
+    // Conversion appends to existing characters.
+    TEST_TRUE(Unicode::Convert(utf32, utf8));
+    TEST_TRUE(utf8.GetLength() == 2 * text.GetLength());
+    TEST_TRUE(utf8.SubStringRightAt(text.GetLength()) == text);
+
+    // Invalid text leaves string unchanged.
+    const u64 length = utf16.GetLength();
+    TEST_FALSE(Unicode::Convert(StringView("0123456789abcdef\xED\xA0\x80"), utf16));
+    TEST_TRUE(utf16.GetLength() == length);
+    TEST_TRUE(utf16 == text16);
+    TEST_FALSE(Unicode::Convert(StringView16(u"\xDC00"), utf8));
+    TEST_FALSE(Unicode::Convert(StringView32(U"\x110000", 1), utf8));
+    TEST_TRUE(utf8.GetLength() == 2 * text.GetLength());
+
+    String16 empty;
+    TEST_TRUE(Unicode::Convert(StringView(""), empty));
+    TEST_TRUE(empty.IsEmpty());
+
+    // Random codepoints of every encoded length.
+    u64 state = 0x9E3779B97F4A7C15;
+    for(u32 iteration = 0; iteration < 200; ++iteration)
+    {
+        HeapString original;
+        String32 codepoints;
+        const u64 count = NextTestCodepoint(state) % 200;
+        for(u64 i = 0; i < count; ++i)
+        {
+            const u64 kind = NextTestCodepoint(state) % 4;
+            char32_t codepoint = static_cast<char32_t>(NextTestCodepoint(state));
+            if(kind == 0)
+                codepoint %= 0x80;
+            else if(kind == 1)
+                codepoint %= 0x800;
+            else if(kind == 2)
+                codepoint %= 0x10000;
+            else
+                codepoint %= Unicode::MaxCodepoint + 1;
+
+            if(codepoint >= 0xD800 && codepoint <= 0xDFFF)
+            {
+                codepoint = U'x';
+            }
+
+            char buffer[Unicode::MaxUtf8Units];
+            original += StringView(buffer, Unicode::EncodeUtf8(codepoint, buffer));
+            codepoints += StringView32(&codepoint, 1);
+        }
+
+        TEST_TRUE(Unicode::IsValidUtf8(original));
+
+        String32 converted32;
+        TEST_TRUE(Unicode::Convert(original, converted32));
+        TEST_TRUE(converted32 == codepoints);
+
+        String16 converted16;
+        TEST_TRUE(Unicode::Convert(original, converted16));
+        TEST_TRUE(Unicode::IsValidUtf16(converted16));
+
+        HeapString back;
+        TEST_TRUE(Unicode::Convert(converted16, back));
+        TEST_TRUE(back == original);
+
+        back.Clear();
+        TEST_TRUE(Unicode::Convert(converted32, back));
+        TEST_TRUE(back == original);
+    }
+}
+
+TEST_DEFINE("Common.Unicode", "Throughput")
+{
+    // Compares text that is mostly ASCII with text of mostly three byte characters.
+    const u64 repeatCount = 20000;
+    HeapString asciiText;
+    HeapString mixedText;
+    for(u64 i = 0; i < repeatCount; ++i)
+    {
+        asciiText += "The quick brown fox jumps over the lazy dog. ";
+        mixedText += "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0 ";
+    }
+
+    const auto measure = [](const char* name, const HeapString& text)
+    {
+        u64 startTick = Time::GetCurrentTick();
+        const bool valid = Unicode::IsValidUtf8(text);
+        const f32 validateSeconds = Time::ConvertTicksToSeconds(Time::GetCurrentTick() - startTick);
+
+        String16 converted;
+        startTick = Time::GetCurrentTick();
+        const bool convertedValid = Unicode::Convert(StringView(text), converted);
+        const f32 convertSeconds = Time::ConvertTicksToSeconds(Time::GetCurrentTick() - startTick);
+
+        HeapString back;
+        startTick = Time::GetCurrentTick();
+        const bool backValid = Unicode::Convert(converted, back);
+        const f32 backSeconds = Time::ConvertTicksToSeconds(Time::GetCurrentTick() - startTick);
+
+        const auto megabytesPerSecond = [&text](const f32 seconds)
+        {
+            return text.GetLength() / std::max(seconds, 0.000001f) / (1024.0f * 1024.0f);
+        };
+
+        LOG_INFO("%s text: validation %.0f MB/s, UTF-8 to UTF-16 %.0f MB/s, UTF-16 to UTF-8 %.0f MB/s", name,
+            megabytesPerSecond(validateSeconds), megabytesPerSecond(convertSeconds), megabytesPerSecond(backSeconds));
+
+        return valid && convertedValid && backValid && back == text;
+    };
+
+    TEST_TRUE(measure("ASCII", asciiText));
+    TEST_TRUE(measure("Mixed", mixedText));
+}
@@ -7,6 +7,26 @@ class TestDeleter
     void operator()(void* pointer) const {}
 };
 
+// Stateless allocator that forwards to default allocator and counts calls routed through it.
+class CountingTestAllocator final
+{
+public:
+    static inline u64 allocateCount = 0;
+    static inline u64 deallocateCount = 0;
+
+    static void* Allocate(const u64 size, const u32 alignment)
+    {
+        ++allocateCount;
+        return Memory::Allocators::Default::Allocate(size, alignment);
+    }
+
+    static void Deallocate(void* allocation, const u64 size, const u32 alignment)
+    {
+        ++deallocateCount;
+        Memory::Allocators::Default::Deallocate(allocation, size, alignment);
+    }
+};
+
 TEST_DEFINE("Common.UniquePtr", "Empty")
 {
     UniquePtr<Test::Object> ptr;
@@ -189,6 +209,135 @@ TEST_DEFINE("Common.UniquePtr", "SizedDeleter")
     static_assert(sizeof(UniquePtr<u8, TestDeleter<32>>) == 40);
 }
 
+TEST_DEFINE("Common.UniquePtr", "CompressedDeleter")
+{
+    // Stateless deleters take no space, while function pointers still need to be stored.
+    auto lambdaDeleter = [](u8* pointer)
+    {
+        Memory::Delete(pointer);
+    };
+
+    static_assert(sizeof(UniquePtr<u8, decltype(lambdaDeleter)>) == sizeof(u8*));
+    static_assert(sizeof(UniquePtr<u8, Memory::AllocationDeleter<u8, CountingTestAllocator>>) == sizeof(u8*));
+    static_assert(sizeof(UniquePtr<u8, void(*)(u8*)>) == sizeof(u8*) * 2);
+    static_assert(sizeof(UniquePtr<u8[]>) == sizeof(u8*) + sizeof(u64));
+}
+
+TEST_DEFINE("Common.UniquePtr", "MakeUnique")
+{
+    UniquePtr ptr = MakeUnique<Test::Object>(64);
+    TEST_TRUE(ptr);
+    TEST_TRUE(ptr->GetControlValue() == 64);
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1, sizeof(Test::Object)));
+
+    UniquePtr<Test::Object> ptrMoved = Move(ptr);
+    TEST_FALSE(ptr);
+    TEST_TRUE(ptrMoved->GetControlValue() == 64);
+
+    ptrMoved.Reset();
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1, sizeof(Test::Object)));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(1, 1, 0, 0));
+}
+
+TEST_DEFINE("Common.UniquePtr", "MakeUniqueAllocator")
+{
+    CountingTestAllocator::allocateCount = 0;
+    CountingTestAllocator::deallocateCount = 0;
+
+    {
+        UniquePtr ptrDerived = MakeUnique<Test::ObjectDerived, CountingTestAllocator>(64);
+        static_assert(sizeof(ptrDerived) == sizeof(Test::ObjectDerived*));
+        TEST_TRUE(CountingTestAllocator::allocateCount == 1);
+
+        // Deleter follows the pointer, so object is returned to the allocator it came from.
+        UniquePtr<Test::Object, Memory::AllocationDeleter<Test::Object, CountingTestAllocator>> ptrBase = Move(ptrDerived);
+        TEST_TRUE(ptrBase->IsDerived());
+        TEST_TRUE(CountingTestAllocator::deallocateCount == 0);
+    }
+
+    TEST_TRUE(CountingTestAllocator::deallocateCount == 1);
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(1, 1, 0, 0));
+}
+
+TEST_DEFINE("Common.UniquePtr", "Array")
+{
+    UniquePtr<Test::Object[]> array(Memory::NewArray<Test::Object>(4, 16), 4);
+    TEST_TRUE(array);
+    TEST_TRUE(array.GetSize() == 4);
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(1, sizeof(Test::Object) * 4));
+    TEST_TRUE(objectGuard.ValidateCurrentInstances(4));
+
+    u64 controlSum = 0;
+    for(const Test::Object& object : array)
+    {
+        controlSum += object.GetControlValue();
+    }
+
+    TEST_TRUE(controlSum == 64);
+    TEST_TRUE(array[3].GetControlValue() == 16);
+
+    UniquePtr<Test::Object[]> arrayMoved = Move(array);
+    TEST_FALSE(array);
+    TEST_TRUE(array.GetSize() == 0);
+    TEST_TRUE(arrayMoved.GetSize() == 4);
+
+    // All elements are destructed before memory is released.
+    arrayMoved.Reset();
+    TEST_FALSE(arrayMoved);
+    TEST_TRUE(objectGuard.ValidateCurrentInstances(0));
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1, sizeof(Test::Object) * 4));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(4, 4, 0, 0));
+}
+
+TEST_DEFINE("Common.UniquePtr", "MakeUniqueArray")
+{
+    CountingTestAllocator::allocateCount = 0;
+    CountingTestAllocator::deallocateCount = 0;
+
+    {
+        UniquePtr array = MakeUnique<u32[], CountingTestAllocator>(8);
+        static_assert(sizeof(array) == sizeof(u32*) + sizeof(u64));
+        TEST_TRUE(array.GetSize() == 8);
+        TEST_TRUE(CountingTestAllocator::allocateCount == 1);
+
+        for(u32 i = 0; i < array.GetSize(); ++i)
+        {
+            array[i] = i;
+        }
+
+        TEST_TRUE(array[7] == 7);
+    }
+
+    TEST_TRUE(CountingTestAllocator::deallocateCount == 1);
+
+    UniquePtr emptyArray = MakeUnique<Test::Object[]>(0);
+    TEST_FALSE(emptyArray);
+    TEST_TRUE(emptyArray.GetSize() == 0);
+
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1, sizeof(u32) * 8));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(0, 0, 0, 0));
+}
+
+TEST_DEFINE("Common.UniquePtr", "ArrayLambdaDeleter")
+{
+    u64 deletedCount = 0;
+    auto arrayDeleter = [&deletedCount](Test::Object* objects, const u64 count)
+    {
+        Memory::DeleteArray(objects, count);
+        deletedCount = count;
+    };
+
+    {
+        UniquePtr<Test::Object[], decltype(&arrayDeleter)> array(Memory::NewArray<Test::Object>(3), 3, &arrayDeleter);
+        TEST_TRUE(objectGuard.ValidateCurrentInstances(3));
+    }
+
+    TEST_TRUE(deletedCount == 3);
+    TEST_TRUE(memoryGuard.ValidateTotalAllocations(1, sizeof(Test::Object) * 3));
+    TEST_TRUE(objectGuard.ValidateTotalCounts(3, 3, 0, 0));
+}
+
 TEST_DEFINE("Common.UniquePtr", "LambdaDeleter")
 {
     auto objectDeleter = [](Test::ObjectDerived* pointer)
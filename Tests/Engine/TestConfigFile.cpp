@@ -0,0 +1,153 @@
+#include "Shared.hpp"
+#include "Engine/Config.hpp"
+#include "Engine/ConfigFile.hpp"
+#include "Platform/CommandLine.hpp"
+
+TEST_DEFINE("Engine.ConfigFile", "Values")
+{
+    const StringView text =
+        "# Comment before any section\r\n"
+        "headless = true\r\n"
+        "render.software = true\n"
+        "replay.playPath = 'Replays/Session.bin'\n"
+        "replay.recordPath = Replays/Bare Path.bin\n"
+        "\n"
+        "[window]\n"
+        "width = 1_920 ; Trailing comment\n"
+        "height=0x438\n"
+        "eventScriptPath = \"Scripts/Resize #1.txt\" # Hash inside string\n"
+        "eventTimeStep = 0.25\n"
+        "\n"
+        "[ logger ]\n"
+        "minimumSeverity = Warning\n"
+        "\n"
+        "[resources]\n"
+        "memoryBudget = 8589934592";
+
+    Config config;
+    TEST_TRUE(ConfigFile::Parse(text, config));
+    TEST_TRUE(config.headless);
+    TEST_TRUE(config.window.width == 1920);
+    TEST_TRUE(config.window.height == 1080);
+    TEST_TRUE(config.window.eventScriptPath == "Scripts/Resize #1.txt");
+    TEST_TRUE(config.window.eventTimeStep == 0.25f);
+    TEST_TRUE(config.logger.minimumSeverity == Logger::Severity::Warning);
+    TEST_TRUE(config.resources.memoryBudget == 8589934592ull);
+    TEST_TRUE(config.render.software);
+    TEST_TRUE(config.replay.playPath == "Replays/Session.bin");
+    TEST_TRUE(config.replay.recordPath == "Replays/Bare Path.bin");
+
+    // String values are copied out of parsed text and null terminated.
+    TEST_TRUE(config.replay.playPath.GetData() < text.GetBeginPtr() || config.replay.playPath.GetData() >= text.GetEndPtr());
+    TEST_TRUE(config.replay.playPath.IsNullTerminated());
+
+    // Fields missing from text keep their values.
+    TEST_TRUE(config.asyncIO.workerCount == Config().asyncIO.workerCount);
+    TEST_TRUE(ConfigFile::Parse("", config));
+}
+
+TEST_DEFINE("Engine.ConfigFile", "Errors")
+{
+    struct ErrorCase
+    {
+        const char* text;
+        u32 line;
+        const char* token;
+    };
+
+    const ErrorCase cases[] =
+    {
+        { "[window]\nsize = 10", 2, "size" },
+        { "[window]\n\nwidth = -1", 3, "-1" },
+        { "window.width = 4294967296", 1, "4294967296" },
+        { "window.width = 1__0", 1, "1__0" },
+        { "window.width = 0x", 1, "0x" },
+        { "window.width = \"10\"", 1, "10" },
+        { "headless = yes", 1, "yes" },
+        { "headless =", 1, "headless" },
+        { "headless true", 1, "headless" },
+        { "window.eventTimeStep = 1.0f", 1, "1.0f" },
+        { "logger.minimumSeverity = warning", 1, "warning" },
+        { "\n[window\nwidth = 1", 2, "window" },
+        { "[]", 1, "]" },
+        { "replay.playPath = \"Replay.bin", 1, "\"Replay.bin" },
+        { "replay.playPath = \"Replay.bin\" extra", 1, "extra" },
+        { "= 10", 1, "= 10" },
+    };
+
+    for(const ErrorCase& errorCase : cases)
+    {
+        Config config;
+        auto result = ConfigFile::Parse(errorCase.text, config);
+        TEST_FALSE(result);
+        TEST_TRUE(result.GetFailure().line == errorCase.line);
+        TEST_TRUE(result.GetFailure().token == errorCase.token);
+    }
+}
+
+TEST_DEFINE("Engine.ConfigFile", "Overrides")
+{
+    Config config;
+    TEST_TRUE(ConfigFile::Parse("[window]\nwidth = 800\nheight = 600\n", config));
+
+    const char* arguments[] =
+    {
+        "Tests",
+        "-window.width=1024",
+        "-render.software",
+        "-replay.timingsPath=\"Timings.txt\"",
+    };
+
+    Platform::CommandLine commandLine;
+    commandLine.Parse(4, arguments);
+    TEST_TRUE(ConfigFile::ApplyOverrides(commandLine, config));
+    TEST_TRUE(config.window.width == 1024);
+    TEST_TRUE(config.window.height == 600);
+    TEST_TRUE(config.render.software);
+    TEST_TRUE(config.replay.timingsPath == "Timings.txt");
+
+    const char* invalidArguments[] =
+    {
+        "Tests",
+        "-window.height",
+    };
+
+    Platform::CommandLine invalidCommandLine;
+    invalidCommandLine.Parse(2, invalidArguments);
+    auto result = ConfigFile::ApplyOverrides(invalidCommandLine, config);
+    TEST_FALSE(result);
+    TEST_TRUE(result.GetFailure().line == 0);
+    TEST_TRUE(result.GetFailure().token == "window.height");
+}
+
+TEST_DEFINE("Engine.ConfigFile", "LoadPath")
+{
+    const StringView configPath = "TestConfigLoad.ini";
+    const StringView scriptPath = "TestConfigLoadScript.txt";
+
+    SCOPE_GUARD
+    {
+        std::remove(*configPath);
+        std::remove(*scriptPath);
+    };
+
+    // Quoted path is followed by other characters in file, so it is not terminated there.
+    TEST_TRUE(WriteStringToFile(scriptPath, "Script contents"));
+    TEST_TRUE(WriteStringToFile(configPath, "[window]\neventScriptPath = \"TestConfigLoadScript.txt\" # Script\n"));
+
+    Config config;
+    TEST_TRUE(ConfigFile::Load(configPath, config));
+    TEST_TRUE(config.window.eventScriptPath == scriptPath);
+
+    // Paths outlive mapped config file and can be opened directly.
+    FILE* file = fopen(*config.window.eventScriptPath, "rb");
+    TEST_TRUE(file != nullptr);
+    if(file)
+    {
+        fclose(file);
+    }
+
+    String contents;
+    TEST_TRUE(ReadStringFromFile(config.window.eventScriptPath, contents));
+    TEST_TRUE(contents == "Script contents");
+}
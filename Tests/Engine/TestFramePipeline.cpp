@@ -0,0 +1,112 @@
+#include "Shared.hpp"
+#include "Engine/Config.hpp"
+#include "Engine/FramePipeline.hpp"
+
+TEST_DEFINE("Engine.FramePipeline", "Inline")
+{
+    u64 renderedCount = 0;
+    u8 renderedValue = 0;
+
+    FramePipeline pipeline;
+    TEST_TRUE(pipeline.Setup(FramePipelineConfig(), [&](const FramePacket& packet)
+    {
+        TEST_TRUE(packet.frameIndex == renderedCount);
+        renderedValue = packet.data[0];
+        ++renderedCount;
+    }));
+
+    TEST_TRUE(!pipeline.IsThreaded());
+    TEST_TRUE(pipeline.GetPacketCount() == 1);
+
+    for(u8 i = 0; i < 3; ++i)
+    {
+        FramePacket& packet = pipeline.AcquirePacket();
+        TEST_TRUE(packet.data.IsEmpty());
+        packet.data.Add(i);
+
+        // Packet is rendered on calling thread as soon as it is submitted.
+        pipeline.SubmitPacket();
+        TEST_TRUE(renderedCount == i + 1u);
+        TEST_TRUE(renderedValue == i);
+    }
+}
+
+TEST_DEFINE("Engine.FramePipeline", "Threaded")
+{
+    const u64 frameCount = 200;
+    HeapArray<u64> renderedFrames;
+    renderedFrames.Reserve(frameCount);
+
+    FramePipelineConfig config;
+    config.renderThread = true;
+    config.framePacketCount = 3;
+
+    FramePipeline pipeline;
+    TEST_TRUE(pipeline.Setup(config, [&renderedFrames](const FramePacket& packet)
+    {
+        // Render data must match frame it was written for.
+        u64 value;
+        std::memcpy(&value, packet.data.GetData(), sizeof(value));
+        renderedFrames.Add(value == packet.frameIndex * 3 ? packet.frameIndex : ~0ull);
+    }));
+
+    TEST_TRUE(pipeline.IsThreaded());
+    TEST_TRUE(pipeline.GetPacketCount() == 3);
+
+    for(u64 i = 0; i < frameCount; ++i)
+    {
+        FramePacket& packet = pipeline.AcquirePacket();
+        TEST_TRUE(packet.frameIndex == i);
+
+        const u64 value = i * 3;
+        packet.data.Resize(sizeof(value));
+        std::memcpy(packet.data.GetData(), &value, sizeof(value));
+        pipeline.SubmitPacket();
+    }
+
+    pipeline.Flush();
+    TEST_TRUE(renderedFrames.GetSize() == frameCount);
+    for(u64 i = 0; i < frameCount; ++i)
+    {
+        TEST_TRUE(renderedFrames[i] == i);
+    }
+}
+
+TEST_DEFINE("Engine.FramePipeline", "Overlap")
+{
+    // Render thread is blocked on first frame, while main thread can still
+    // prepare the next frame until it runs out of free frame packets.
+    Thread::Event renderEvent(true);
+    std::atomic<u64> renderedCount = 0;
+
+    FramePipelineConfig config;
+    config.renderThread = true;
+    config.framePacketCount = 2;
+
+    FramePipeline pipeline;
+    TEST_TRUE(pipeline.Setup(config, [&](const FramePacket&)
+    {
+        renderEvent.Wait();
+        ++renderedCount;
+    }));
+
+    pipeline.AcquirePacket();
+    pipeline.SubmitPacket();
+
+    pipeline.AcquirePacket();
+    pipeline.SubmitPacket();
+    TEST_TRUE(renderedCount == 0);
+
+    renderEvent.Signal();
+    pipeline.AcquirePacket();
+    pipeline.SubmitPacket();
+
+    pipeline.Flush();
+    TEST_TRUE(renderedCount == 3);
+
+    // Shutdown still renders packets that were submitted before it.
+    pipeline.AcquirePacket();
+    pipeline.SubmitPacket();
+    pipeline.Shutdown();
+    TEST_TRUE(renderedCount == 4);
+}
@@ -0,0 +1,131 @@
+#include "Shared.hpp"
+#include "Engine/Engine.hpp"
+
+namespace
+{
+    struct ReplayTestFrame
+    {
+        f32 deltaTime = 0.0f;
+        u32 width = 0;
+        i32 mouseX = 0;
+        bool keyDown = false;
+        bool keyPressed = false;
+    };
+
+    // Drives its own input and window while recording, and only observes them during playback.
+    class ReplayTestApplication final : public Application
+    {
+    public:
+        Engine* engine = nullptr;
+        bool recording = false;
+        HeapArray<ReplayTestFrame> frames;
+
+        Config GetConfig() override
+        {
+            return {};
+        }
+
+        void OnUpdate(const float deltaTime, const Input::State& input) override
+        {
+            const u32 frameIndex = static_cast<u32>(frames.GetSize());
+
+            ReplayTestFrame& frame = frames.Add();
+            frame.deltaTime = deltaTime;
+            frame.width = engine->GetWindow().GetWidth();
+            frame.mouseX = input.GetMouseX();
+            frame.keyDown = input.IsKeyDown(Input::Key::A);
+            frame.keyPressed = input.WasKeyPressed(Input::Key::A);
+
+            if(!recording)
+                return;
+
+            Input::System& inputSystem = engine->GetInput();
+            inputSystem.PushMouseMove(static_cast<i32>(frameIndex) * 10, 0);
+            if(frameIndex % 3 == 0)
+            {
+                inputSystem.PushKey(static_cast<u16>(Input::Key::A), frameIndex % 2 == 0);
+            }
+
+            if(frameIndex == 4)
+            {
+                engine->GetWindow().SetSize(640, 480);
+            }
+
+            if(frameIndex == 10)
+            {
+                engine->GetWindow().Close();
+            }
+        }
+    };
+}
+
+TEST_DEFINE("Engine.Replay", "RecordAndPlay")
+{
+    const StringView replayPath = "TestReplay.bin";
+    const StringView timingsPath = "TestReplayTimings.txt";
+
+    SCOPE_GUARD
+    {
+        std::remove(*replayPath);
+        std::remove(*timingsPath);
+    };
+
+    ReplayTestApplication recorded;
+    recorded.recording = true;
+    {
+        Config config;
+        config.headless = true;
+        config.replay.recordPath = StringView(replayPath);
+
+        Engine engine;
+        recorded.engine = &engine;
+        TEST_TRUE(engine.Setup(config));
+        TEST_TRUE(engine.GetReplay().IsRecording());
+        TEST_TRUE(engine.Run(recorded) == ExitCodes::Success);
+        TEST_TRUE(!engine.GetReplay().IsRecording());
+    }
+
+    // Input pushed during a frame is drained by the next one, and window closes after the last update.
+    TEST_TRUE(recorded.frames.GetSize() == 11);
+    TEST_TRUE(recorded.frames[1].keyPressed && recorded.frames[1].mouseX == 0);
+    TEST_TRUE(recorded.frames[5].width == 640);
+
+    ReplayTestApplication played;
+    {
+        Config config;
+        config.headless = true;
+        config.replay.playPath = StringView(replayPath);
+        config.replay.timingsPath = StringView(timingsPath);
+
+        Engine engine;
+        played.engine = &engine;
+        TEST_TRUE(engine.Setup(config));
+        TEST_TRUE(engine.GetReplay().IsPlaying());
+        TEST_TRUE(engine.Run(played) == ExitCodes::Success);
+    }
+
+    // Application sees exactly the same frames without producing any input on its own.
+    TEST_TRUE(played.frames.GetSize() == recorded.frames.GetSize());
+    for(u64 i = 0; i < recorded.frames.GetSize(); ++i)
+    {
+        const ReplayTestFrame& expected = recorded.frames[i];
+        const ReplayTestFrame& actual = played.frames[i];
+        TEST_TRUE(actual.deltaTime == expected.deltaTime);
+        TEST_TRUE(actual.width == expected.width);
+        TEST_TRUE(actual.mouseX == expected.mouseX);
+        TEST_TRUE(actual.keyDown == expected.keyDown);
+        TEST_TRUE(actual.keyPressed == expected.keyPressed);
+    }
+
+    // Measured time of every played frame is written on its own line.
+    String timings;
+    TEST_TRUE(ReadStringFromFile(timingsPath, timings));
+
+    u64 lineCount = 0;
+    for(const char character : timings)
+    {
+        lineCount += character == '\n';
+    }
+
+    TEST_TRUE(lineCount == recorded.frames.GetSize());
+}
@@ -0,0 +1,182 @@
+#include "Shared.hpp"
+#include "Graphics/CommandBuffer.hpp"
+#include "Graphics/RenderApi.hpp"
+#include "Platform/Thread.hpp"
+#include "Platform/Time.hpp"
+
+using namespace Graphics;
+
+TEST_DEFINE("Graphics.CommandBuffer", "Record")
+{
+    CommandBuffer buffer;
+    TEST_TRUE(buffer.GetCommandCount() == 0);
+
+    ClearCommand clear;
+    clear.color[1] = 0.5f;
+    buffer.Add(SortKey::Make(0), clear);
+
+    DrawCommand draw;
+    draw.mesh = 7;
+    draw.vertexCount = 3;
+    buffer.Add(SortKey::Make(1, 2, 3, 4), draw);
+
+    TEST_TRUE(buffer.GetCommandCount() == 2);
+    TEST_TRUE(buffer.GetMemorySize() == 16 + 24);
+
+    const CommandBuffer::Entry* entries = buffer.GetEntries();
+    TEST_TRUE(entries[0].type == CommandType::Clear);
+    TEST_TRUE(entries[1].type == CommandType::Draw);
+    TEST_TRUE(entries[1].sortKey == SortKey::Make(1, 2, 3, 4));
+    TEST_TRUE(static_cast<const ClearCommand*>(buffer.GetCommandData(entries[0]))->color[1] == 0.5f);
+    TEST_TRUE(static_cast<const DrawCommand*>(buffer.GetCommandData(entries[1]))->mesh == 7);
+
+    // Reset keeps memory for next recording.
+    buffer.Reset();
+    TEST_TRUE(buffer.GetCommandCount() == 0);
+    TEST_TRUE(buffer.GetMemorySize() == 0);
+}
+
+TEST_DEFINE("Graphics.CommandBuffer", "SortKey")
+{
+    TEST_TRUE(SortKey::Make(1) > SortKey::Make(0, 0xFFFF, 0xFFFF, SortKey::MaxDepth));
+    TEST_TRUE(SortKey::Make(0, 1) > SortKey::Make(0, 0, 0xFFFF, SortKey::MaxDepth));
+    TEST_TRUE(SortKey::Make(0, 0, 1) > SortKey::Make(0, 0, 0, SortKey::MaxDepth));
+    TEST_TRUE(SortKey::Make(0, 0, 0, SortKey::MaxDepth + 1) == SortKey::Make(0));
+    TEST_TRUE(SortKey::GetLayer(SortKey::Make(200, 1, 2, 3)) == 200);
+}
+
+TEST_DEFINE("Graphics.CommandBuffer", "Merge")
+{
+    CommandBuffer first;
+    CommandBuffer second;
+
+    DrawCommand draw;
+    draw.vertexCount = 3;
+
+    draw.mesh = 0;
+    first.Add(SortKey::Make(1, 5), draw);
+    draw.mesh = 1;
+    first.Add(SortKey::Make(1, 2), draw);
+    draw.mesh = 2;
+    second.Add(SortKey::Make(1, 2), draw);
+    draw.mesh = 3;
+    second.Add(SortKey::Make(0, 9), draw);
+    first.Add(SortKey::Make(0), ClearCommand());
+
+    const CommandBuffer* buffers[] = { &first, &second };
+    CommandList list;
+    list.Build(buffers, 2);
+    TEST_TRUE(list.GetCommandCount() == 5);
+
+    // Equal keys keep order of buffers and then of recording.
+    TEST_TRUE(list.GetCommand(0).type == CommandType::Clear);
+    TEST_TRUE(CommandList::Get<DrawCommand>(list.GetCommand(1)).mesh == 3);
+    TEST_TRUE(CommandList::Get<DrawCommand>(list.GetCommand(2)).mesh == 1);
+    TEST_TRUE(CommandList::Get<DrawCommand>(list.GetCommand(3)).mesh == 2);
+    TEST_TRUE(CommandList::Get<DrawCommand>(list.GetCommand(4)).mesh == 0);
+
+    // Rebuilding replaces previous commands.
+    list.Build(second);
+    TEST_TRUE(list.GetCommandCount() == 2);
+}
+
+TEST_DEFINE("Graphics.CommandBuffer", "ParallelRecord")
+{
+    const u32 threadCount = 4;
+    const u32 drawCount = 10000;
+
+    CommandBuffer buffers[threadCount];
+    Thread::Handle threads[threadCount];
+
+    const u64 startTick = Time::GetCurrentTick();
+    for(u32 i = 0; i < threadCount; ++i)
+    {
+        threads[i] = Thread::Create(Thread::Config(), [&buffer = buffers[i], i, drawCount]()
+        {
+            DrawCommand draw;
+            draw.vertexCount = 3;
+            for(u32 j = 0; j < drawCount; ++j)
+            {
+                draw.mesh = i * drawCount + j;
+                const u16 pipeline = static_cast<u16>((j * 7 + i) % 16);
+                const u16 material = static_cast<u16>(j % 64);
+                buffer.Add(SortKey::Make(1, pipeline, material, drawCount - j), draw);
+            }
+        });
+    }
+
+    for(Thread::Handle& thread : threads)
+    {
+        thread.Join();
+    }
+
+    const u64 recordTick = Time::GetCurrentTick();
+    const CommandBuffer* bufferPointers[threadCount] = { &buffers[0], &buffers[1], &buffers[2], &buffers[3] };
+    CommandList list;
+    list.Build(bufferPointers, threadCount);
+    const u64 mergeTick = Time::GetCurrentTick();
+
+    TEST_TRUE(list.GetCommandCount() == threadCount * drawCount);
+
+    bool sorted = true;
+    for(u64 i = 1; i < list.GetCommandCount(); ++i)
+    {
+        sorted &= list.GetCommand(i - 1).sortKey <= list.GetCommand(i).sortKey;
+    }
+    TEST_TRUE(sorted);
+
+#if defined(GRAPHICS_NULL)
+    Detail::RenderApi renderApi;
+    renderApi.Submit(list);
+
+    const Detail::SubmitStats& stats = renderApi.GetSubmitStats();
+    TEST_TRUE(stats.submitCount == 1);
+    TEST_TRUE(stats.commandCount == threadCount * drawCount);
+    TEST_TRUE(stats.invalidCount == 0);
+    TEST_TRUE(stats.typeCounts[static_cast<u64>(CommandType::Draw)] == threadCount * drawCount);
+#endif
+
+    LOG_INFO("Command buffer recording: %.2f ms, merge and sort: %.2f ms for %u commands",
+        Time::ConvertTicksToSeconds(recordTick - startTick) * 1000.0f,
+        Time::ConvertTicksToSeconds(mergeTick - recordTick) * 1000.0f,
+        threadCount * drawCount);
+}
+
+#if defined(GRAPHICS_NULL)
+TEST_DEFINE("Graphics.CommandBuffer", "NullValidation")
+{
+    SetViewportCommand viewport;
+    DrawCommand draw;
+
+    TEST_TRUE(!Detail::RenderApi::ValidateCommand({ 0, &viewport, CommandType::SetViewport }));
+    TEST_TRUE(!Detail::RenderApi::ValidateCommand({ 0, &draw, CommandType::Draw }));
+    TEST_TRUE(!Detail::RenderApi::ValidateCommand({ 0, nullptr, CommandType::Clear }));
+    TEST_TRUE(!Detail::RenderApi::ValidateCommand({ 0, &draw, CommandType::Count }));
+
+    viewport.width = 640;
+    viewport.height = 480;
+    draw.vertexCount = 3;
+    TEST_TRUE(Detail::RenderApi::ValidateCommand({ 0, &viewport, CommandType::SetViewport }));
+    TEST_TRUE(Detail::RenderApi::ValidateCommand({ 0, &draw, CommandType::Draw }));
+
+    CommandBuffer buffer;
+    buffer.Add(SortKey::Make(0), ClearCommand());
+    buffer.Add(SortKey::Make(0, 1), viewport);
+    buffer.Add(SortKey::Make(1), draw);
+    buffer.Add(SortKey::Make(1), draw);
+
+    CommandList list;
+    list.Build(buffer);
+
+    Detail::RenderApi renderApi;
+    renderApi.Submit(list);
+    renderApi.Submit(list);
+
+    const Detail::SubmitStats& stats = renderApi.GetSubmitStats();
+    TEST_TRUE(stats.submitCount == 2);
+    TEST_TRUE(stats.commandCount == 8);
+    TEST_TRUE(stats.typeCounts[static_cast<u64>(CommandType::Clear)] == 2);
+    TEST_TRUE(stats.typeCounts[static_cast<u64>(CommandType::SetViewport)] == 2);
+    TEST_TRUE(stats.typeCounts[static_cast<u64>(CommandType::Draw)] == 4);
+}
+#endif
@@ -0,0 +1,302 @@
+#include "Shared.hpp"
+#include "Graphics/Config.hpp"
+#include "Graphics/RenderApi.hpp"
+#include "Graphics/Software/Framebuffer.hpp"
+#include "Graphics/Software/Rasterizer.hpp"
+#include "Platform/Time.hpp"
+#include "Platform/Utility.hpp"
+
+using namespace Graphics;
+
+namespace
+{
+    const u32 Red = Software::PackColor(255, 0, 0);
+    const u32 Green = Software::PackColor(0, 255, 0);
+    const u32 Black = Software::PackColor(0, 0, 0);
+
+    u64 CountPixels(const Software::Framebuffer& framebuffer, const u32 color)
+    {
+        u64 count = 0;
+        for(u32 y = 0; y < framebuffer.GetHeight(); ++y)
+        {
+            for(u32 x = 0; x < framebuffer.GetWidth(); ++x)
+            {
+                count += framebuffer.GetPixel(x, y) == color;
+            }
+        }
+
+        return count;
+    }
+
+    void AddQuad(HeapArray<Software::Vertex>& vertices, const f32 x0, const f32 y0, const f32 x1, const f32 y1, const u32 color)
+    {
+        vertices.Add(Software::Vertex{ x0, y0, color });
+        vertices.Add(Software::Vertex{ x1, y0, color });
+        vertices.Add(Software::Vertex{ x1, y1, color });
+        vertices.Add(Software::Vertex{ x0, y0, color });
+        vertices.Add(Software::Vertex{ x1, y1, color });
+        vertices.Add(Software::Vertex{ x0, y1, color });
+    }
+
+    // Deterministic pseudo random triangles spread over whole framebuffer.
+    void AddRandomTriangles(HeapArray<Software::Vertex>& vertices, const u32 count, const f32 width, const f32 height, const f32 size)
+    {
+        u32 state = 12345;
+        const auto Next = [&state]()
+        {
+            state = state * 1664525u + 1013904223u;
+            return static_cast<f32>(state >> 8) / static_cast<f32>(1 << 24);
+        };
+
+        for(u32 i = 0; i < count; ++i)
+        {
+            const f32 x = Next() * width;
+            const f32 y = Next() * height;
+            const u32 color = Software::PackColor(static_cast<u8>(i), static_cast<u8>(i >> 8), static_cast<u8>(i * 7));
+            vertices.Add(Software::Vertex{ x, y, color });
+            vertices.Add(Software::Vertex{ x + (Next() - 0.5f) * size, y + (Next() - 0.5f) * size, color });
+            vertices.Add(Software::Vertex{ x + (Next() - 0.5f) * size, y + (Next() - 0.5f) * size, color });
+        }
+    }
+}
+
+TEST_DEFINE("Graphics.Rasterizer", "Coverage")
+{
+    Software::Framebuffer framebuffer;
+    framebuffer.Resize(64, 48);
+    framebuffer.Clear(Black);
+
+    Software::RasterizerConfig config;
+    config.threadCount = 2;
+
+    Software::Rasterizer rasterizer;
+    TEST_TRUE(rasterizer.Setup(config));
+    TEST_TRUE(rasterizer.GetThreadCount() == 2);
+    rasterizer.SetTarget(&framebuffer);
+
+    // Quad crosses tile boundary, and its two triangles share a diagonal edge
+    // which must be covered exactly once without any gaps.
+    HeapArray<Software::Vertex> vertices;
+    AddQuad(vertices, 24.0f, 8.0f, 40.0f, 24.0f, Red);
+    rasterizer.DrawTriangles(vertices.GetData(), vertices.GetSize());
+    rasterizer.Flush();
+
+    TEST_TRUE(rasterizer.GetPixelCount() == 16 * 16);
+    TEST_TRUE(CountPixels(framebuffer, Red) == 16 * 16);
+    TEST_TRUE(framebuffer.GetPixel(24, 8) == Red);
+    TEST_TRUE(framebuffer.GetPixel(39, 23) == Red);
+    TEST_TRUE(framebuffer.GetPixel(23, 8) == Black);
+    TEST_TRUE(framebuffer.GetPixel(40, 23) == Black);
+    TEST_TRUE(framebuffer.GetPixel(39, 24) == Black);
+
+    // Triangle fan around center point shares every edge with its neighbours.
+    framebuffer.Clear(Black);
+    vertices.Clear();
+    const f32 fan[][2] = { { 2.5f, 3.0f }, { 20.0f, 1.25f }, { 30.0f, 17.5f }, { 11.75f, 29.0f }, { 1.0f, 20.0f } };
+    for(u32 i = 0; i < 5; ++i)
+    {
+        vertices.Add(Software::Vertex{ 15.3f, 15.7f, Green });
+        vertices.Add(Software::Vertex{ fan[i][0], fan[i][1], Green });
+        vertices.Add(Software::Vertex{ fan[(i + 1) % 5][0], fan[(i + 1) % 5][1], Green });
+    }
+
+    const u64 pixelCount = rasterizer.GetPixelCount();
+    rasterizer.DrawTriangles(vertices.GetData(), vertices.GetSize());
+    rasterizer.Flush();
+    TEST_TRUE(rasterizer.GetPixelCount() - pixelCount == CountPixels(framebuffer, Green));
+}
+
+TEST_DEFINE("Graphics.Rasterizer", "ViewportAndWinding")
+{
+    Software::Framebuffer framebuffer;
+    framebuffer.Resize(32, 32);
+
+    Software::RasterizerConfig config;
+    config.threadCount = 1;
+
+    Software::Rasterizer rasterizer;
+    TEST_TRUE(rasterizer.Setup(config));
+    rasterizer.SetTarget(&framebuffer);
+    rasterizer.Clear(Black);
+
+    // Reversed winding is still drawn, and positions are offset by viewport origin.
+    // Diagonal edge is shifted from pixel centers, so it does not depend on fill rule.
+    const Software::Vertex reversed[] =
+    {
+        { 0.0f, 0.25f, Red },
+        { 0.0f, 4.25f, Red },
+        { 4.0f, 4.25f, Red },
+    };
+
+    rasterizer.SetViewport(10, 12, 8, 8);
+    rasterizer.DrawTriangles(reversed, 3);
+    rasterizer.Flush();
+    TEST_TRUE(framebuffer.GetPixel(10, 15) == Red);
+    TEST_TRUE(framebuffer.GetPixel(12, 15) == Red);
+    TEST_TRUE(framebuffer.GetPixel(13, 15) == Black);
+    TEST_TRUE(framebuffer.GetPixel(10, 12) == Black);
+    TEST_TRUE(CountPixels(framebuffer, Red) == 6);
+
+    // Viewport clips triangles that extend past it, and degenerate or
+    // non-finite triangles, or ones outside guard band, are dropped.
+    rasterizer.Clear(Black);
+    HeapArray<Software::Vertex> vertices;
+    AddQuad(vertices, -100.0f, -100.0f, 100.0f, 100.0f, Green);
+    vertices.Add(Software::Vertex{ 0.0f, 0.0f, Red });
+    vertices.Add(Software::Vertex{ 4.0f, 4.0f, Red });
+    vertices.Add(Software::Vertex{ 8.0f, 8.0f, Red });
+    vertices.Add(Software::Vertex{ 0.0f, 0.0f, Red });
+    vertices.Add(Software::Vertex{ 4.0f, 0.0f, Red });
+    vertices.Add(Software::Vertex{ 0.0f, Software::Rasterizer::GuardBand * 2.0f, Red });
+    vertices.Add(Software::Vertex{ 0.0f, 0.0f, Red });
+    vertices.Add(Software::Vertex{ 4.0f, 0.0f, Red });
+    vertices.Add(Software::Vertex{ 0.0f, std::numeric_limits<f32>::quiet_NaN(), Red });
+
+    rasterizer.SetViewport(4, 4, 8, 8);
+    rasterizer.DrawTriangles(vertices.GetData(), vertices.GetSize());
+    rasterizer.Flush();
+    TEST_TRUE(CountPixels(framebuffer, Green) == 64);
+    TEST_TRUE(CountPixels(framebuffer, Red) == 0);
+    TEST_TRUE(framebuffer.GetPixel(4, 4) == Green);
+    TEST_TRUE(framebuffer.GetPixel(11, 11) == Green);
+    TEST_TRUE(framebuffer.GetPixel(12, 11) == Black);
+}
+
+TEST_DEFINE("Graphics.Rasterizer", "Deterministic")
+{
+    // Output must not depend on how binning and tiles are spread across threads.
+    HeapArray<Software::Vertex> vertices;
+    AddRandomTriangles(vertices, 2000, 200.0f, 150.0f, 60.0f);
+
+    Software::Framebuffer framebuffers[2];
+    const u32 threadCounts[2] = { 1, 4 };
+    for(u32 i = 0; i < 2; ++i)
+    {
+        Software::RasterizerConfig config;
+        config.threadCount = threadCounts[i];
+
+        Software::Rasterizer rasterizer;
+        TEST_TRUE(rasterizer.Setup(config));
+
+        framebuffers[i].Resize(200, 150);
+        rasterizer.SetTarget(&framebuffers[i]);
+        rasterizer.Clear(Black);
+        rasterizer.DrawTriangles(vertices.GetData(), vertices.GetSize());
+        rasterizer.Flush();
+    }
+
+    bool identical = true;
+    for(u32 y = 0; y < 150; ++y)
+    {
+        identical &= std::memcmp(framebuffers[0].GetRow(y), framebuffers[1].GetRow(y), 200 * sizeof(u32)) == 0;
+    }
+
+    TEST_TRUE(identical);
+    TEST_TRUE(CountPixels(framebuffers[0], Black) < 200 * 150 / 10);
+}
+
+TEST_DEFINE("Graphics.Rasterizer", "SavePPM")
+{
+    const StringView filePath = "TestRasterizerSavePPM.ppm";
+    SCOPE_GUARD
+    {
+        std::remove(*filePath);
+    };
+
+    Software::Framebuffer framebuffer;
+    framebuffer.Resize(2, 1);
+    framebuffer.Clear(Software::PackColor(1, 2, 3));
+    framebuffer.GetRow(0)[1] = Software::PackColor(250, 128, 0, 0);
+    TEST_TRUE(framebuffer.SavePPM(filePath));
+
+    String contents;
+    TEST_TRUE(ReadStringFromFile(filePath, contents));
+    TEST_TRUE(contents.GetLength() == 11 + 6);
+    TEST_TRUE(StringView(contents.GetData(), 11) == "P6\n2 1\n255\n");
+
+    const u8* pixels = reinterpret_cast<const u8*>(contents.GetData() + 11);
+    TEST_TRUE(pixels[0] == 1 && pixels[1] == 2 && pixels[2] == 3);
+    TEST_TRUE(pixels[3] == 250 && pixels[4] == 128 && pixels[5] == 0);
+}
+
+#if defined(GRAPHICS_NULL)
+TEST_DEFINE("Graphics.Rasterizer", "NullSoftware")
+{
+    RenderConfig config;
+    config.software = true;
+    config.softwareThreadCount = 2;
+
+    Detail::RenderApi renderApi;
+    TEST_TRUE(renderApi.Setup(nullptr, config));
+    TEST_TRUE(renderApi.IsSoftware());
+    renderApi.Resize(32, 32);
+
+    HeapArray<Software::Vertex> vertices;
+    AddQuad(vertices, 0.0f, 0.0f, 8.0f, 8.0f, Red);
+    AddQuad(vertices, 0.0f, 0.0f, 8.0f, 8.0f, Green);
+    const u32 mesh = renderApi.CreateSoftwareMesh(vertices.GetData(), static_cast<u32>(vertices.GetSize()));
+
+    // Commands are executed in sort key order rather than recording order.
+    CommandBuffer buffer;
+    DrawCommand draw;
+    draw.mesh = mesh;
+    draw.vertexCount = 6;
+    buffer.Add(SortKey::Make(2), draw);
+    draw.vertexOffset = 6;
+    draw.instanceCount = 2;
+    buffer.Add(SortKey::Make(1), draw);
+
+    SetViewportCommand viewport;
+    viewport.x = 16;
+    viewport.y = 8;
+    viewport.width = 16;
+    viewport.height = 16;
+    buffer.Add(SortKey::Make(0, 1), viewport);
+
+    ClearCommand clear;
+    clear.color[0] = 0.0f;
+    clear.color[3] = 1.0f;
+    buffer.Add(SortKey::Make(0), clear);
+
+    CommandList list;
+    list.Build(buffer);
+
+    renderApi.BeginFrame(32, 32);
+    renderApi.Submit(list);
+    renderApi.EndFrame();
+
+    const Software::Framebuffer& framebuffer = renderApi.GetFramebuffer();
+    TEST_TRUE(framebuffer.GetWidth() == 32);
+    TEST_TRUE(CountPixels(framebuffer, Red) == 64);
+    TEST_TRUE(CountPixels(framebuffer, Black) == 32 * 32 - 64);
+    TEST_TRUE(framebuffer.GetPixel(16, 8) == Red);
+    TEST_TRUE(renderApi.GetSubmitStats().commandCount == 4);
+}
+#endif
+
+TEST_DEFINE("Graphics.Rasterizer", "Throughput")
+{
+    const u32 width = 1280;
+    const u32 height = 720;
+    const u32 triangleCount = 50000;
+
+    HeapArray<Software::Vertex> vertices;
+    AddRandomTriangles(vertices, triangleCount, static_cast<f32>(width), static_cast<f32>(height), 40.0f);
+
+    Software::Framebuffer framebuffer;
+    framebuffer.Resize(width, height);
+
+    Software::Rasterizer rasterizer;
+    TEST_TRUE(rasterizer.Setup(Software::RasterizerConfig()));
+    rasterizer.SetTarget(&framebuffer);
+    rasterizer.Clear(Black);
+
+    const u64 startTick = Time::GetCurrentTick();
+    rasterizer.DrawTriangles(vertices.GetData(), vertices.GetSize());
+    rasterizer.Flush();
+    const f32 seconds = std::max(Time::ConvertTicksToSeconds(Time::GetCurrentTick() - startTick), 0.000001f);
+
+    TEST_TRUE(rasterizer.GetPixelCount() > 0);
+    LOG_INFO("Software rasterizer throughput with %u threads: %.2f million triangles and %.2f million pixels per second",
+        rasterizer.GetThreadCount(), triangleCount / seconds / 1000000.0f, rasterizer.GetPixelCount() / seconds / 1000000.0f);
+}
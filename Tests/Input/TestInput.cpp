@@ -0,0 +1,203 @@
+#include "Shared.hpp"
+#include "Input/System.hpp"
+#include "Platform/Thread.hpp"
+
+TEST_DEFINE("Input.System", "Keys")
+{
+    Input::System input;
+    const Input::State& state = input.GetState();
+
+    input.PushKey(static_cast<u16>(Input::Key::A), true);
+    input.PushKey(static_cast<u16>(Input::Key::A), true);
+    input.PushKey(static_cast<u16>(Input::Key::Space), true);
+    input.PushKey(static_cast<u16>(Input::Key::Space), false);
+    TEST_TRUE(state.GetEventCount() == 0);
+
+    input.Update();
+    TEST_TRUE(state.GetEventCount() == 4);
+    TEST_TRUE(state.IsKeyDown(Input::Key::A));
+    TEST_TRUE(state.WasKeyPressed(Input::Key::A));
+    TEST_TRUE(!state.WasKeyReleased(Input::Key::A));
+
+    // Key tapped within a single frame is both pressed and released, but not down.
+    TEST_TRUE(!state.IsKeyDown(Input::Key::Space));
+    TEST_TRUE(state.WasKeyPressed(Input::Key::Space));
+    TEST_TRUE(state.WasKeyReleased(Input::Key::Space));
+
+    // Held key stays down without being pressed again, and repeats are not new presses.
+    input.PushKey(static_cast<u16>(Input::Key::A), true);
+    input.Update();
+    TEST_TRUE(state.IsKeyDown(Input::Key::A));
+    TEST_TRUE(!state.WasKeyPressed(Input::Key::A));
+    TEST_TRUE(!state.WasKeyPressed(Input::Key::Space));
+
+    input.PushKey(static_cast<u16>(Input::Key::A), false);
+    input.Update();
+    TEST_TRUE(!state.IsKeyDown(Input::Key::A));
+    TEST_TRUE(state.WasKeyReleased(Input::Key::A));
+
+    // Codes outside of key range are ignored.
+    input.PushKey(1000, true);
+    input.Update();
+    TEST_TRUE(state.GetEventCount() == 1);
+}
+
+TEST_DEFINE("Input.System", "MouseAndGamepad")
+{
+    Input::System input;
+    const Input::State& state = input.GetState();
+
+    input.PushMouseMove(10, 20);
+    input.PushMouseButton(Input::MouseButton::Right, true);
+    input.PushMouseWheel(120);
+    input.PushGamepadButton(1, Input::GamepadButton::Start, true);
+    input.PushGamepadAxis(1, Input::GamepadAxis::LeftX, -0.5f);
+    input.Update();
+
+    // First position is not treated as movement.
+    TEST_TRUE(state.GetMouseX() == 10 && state.GetMouseY() == 20);
+    TEST_TRUE(state.GetMouseDeltaX() == 0 && state.GetMouseDeltaY() == 0);
+    TEST_TRUE(state.IsMouseButtonDown(Input::MouseButton::Right));
+    TEST_TRUE(state.WasMouseButtonPressed(Input::MouseButton::Right));
+    TEST_TRUE(!state.IsMouseButtonDown(Input::MouseButton::Left));
+    TEST_TRUE(state.GetMouseWheel() == 120);
+    TEST_TRUE(state.IsGamepadButtonDown(1, Input::GamepadButton::Start));
+    TEST_TRUE(!state.IsGamepadButtonDown(0, Input::GamepadButton::Start));
+    TEST_TRUE(state.GetGamepadAxis(1, Input::GamepadAxis::LeftX) == -0.5f);
+
+    // Movement within a frame accumulates, while per frame values are reset.
+    input.PushMouseMove(15, 18);
+    input.PushMouseMove(20, 30);
+    input.PushMouseButton(Input::MouseButton::Right, false);
+    input.Update();
+    TEST_TRUE(state.GetMouseDeltaX() == 10 && state.GetMouseDeltaY() == 10);
+    TEST_TRUE(state.WasMouseButtonReleased(Input::MouseButton::Right));
+    TEST_TRUE(state.GetMouseWheel() == 0);
+    TEST_TRUE(!state.WasGamepadButtonPressed(1, Input::GamepadButton::Start));
+    TEST_TRUE(state.GetGamepadAxis(1, Input::GamepadAxis::LeftX) == -0.5f);
+}
+
+TEST_DEFINE("Input.System", "Timestamps")
+{
+    Input::System input;
+
+    Input::Event event;
+    event.tick = 1234;
+    event.type = Input::EventType::Key;
+    event.code = static_cast<u16>(Input::Key::Escape);
+    event.x = 1;
+    TEST_TRUE(input.Push(event));
+
+    const u64 beforeTick = Time::GetCurrentTick();
+    input.PushKey(static_cast<u16>(Input::Key::Enter), true);
+
+    // Drained events are seen in collection order with their own timestamps.
+    u64 ticks[2] = {};
+    u32 count = 0;
+    input.Update([&ticks, &count](const Input::Event& drained)
+    {
+        ticks[count++] = drained.tick;
+    });
+
+    TEST_TRUE(count == 2);
+    TEST_TRUE(ticks[0] == 1234);
+    TEST_TRUE(ticks[1] >= beforeTick);
+    TEST_TRUE(input.GetState().WasKeyPressed(Input::Key::Escape));
+    TEST_TRUE(input.GetLatency() > 0.0f);
+}
+
+TEST_DEFINE("Input.System", "Overflow")
+{
+    Input::System input;
+    for(u64 i = 0; i < Input::System::QueueCapacity; ++i)
+    {
+        TEST_TRUE(input.PushMouseWheel(1));
+    }
+
+    TEST_TRUE(!input.PushMouseWheel(1));
+    TEST_TRUE(input.GetDroppedCount() == 1);
+
+    input.Update();
+    TEST_TRUE(input.GetState().GetMouseWheel() == static_cast<i32>(Input::System::QueueCapacity));
+    TEST_TRUE(input.PushMouseWheel(1));
+}
+
+TEST_DEFINE("Input.System", "UpdateLimit")
+{
+    // Every drained event pushes another, which would never let update finish without limit.
+    Input::System input;
+    TEST_TRUE(input.PushMouseWheel(1));
+
+    u64 drainedCount = 0;
+    input.Update([&](const Input::Event&)
+    {
+        input.PushMouseWheel(1);
+        ++drainedCount;
+    });
+
+    TEST_TRUE(drainedCount == Input::System::QueueCapacity);
+    TEST_TRUE(input.GetState().GetMouseWheel() == static_cast<i32>(Input::System::QueueCapacity));
+
+    drainedCount = 0;
+    input.Update([&](const Input::Event&)
+    {
+        ++drainedCount;
+    });
+
+    TEST_TRUE(drainedCount == 1);
+}
+
+TEST_DEFINE("Input.System", "ConcurrentProducers")
+{
+    // Producers push while main thread keeps draining once per frame.
+    const u32 producerCount = 3;
+    const u32 eventCount = 20000;
+
+    Input::System input;
+    std::atomic<u32> finishedCount = 0;
+    Thread::Handle producers[producerCount];
+    for(u32 i = 0; i < producerCount; ++i)
+    {
+        producers[i] = Thread::Create(Thread::Config(), [&input, &finishedCount, i, eventCount]()
+        {
+            for(u32 j = 0; j < eventCount; ++j)
+            {
+                while(!input.PushGamepadAxis(i, Input::GamepadAxis::LeftX, static_cast<f32>(j)))
+                {
+                    Thread::Yield();
+                }
+            }
+
+            finishedCount.fetch_add(1);
+        });
+    }
+
+    // Every producer must be seen in its own order.
+    f32 lastValues[producerCount] = { -1.0f, -1.0f, -1.0f };
+    u64 drainedCount = 0;
+    bool ordered = true;
+    while(true)
+    {
+        const bool finished = finishedCount.load() == producerCount;
+        input.Update([&](const Input::Event& event)
+        {
+            ordered &= event.value > lastValues[event.device];
+            lastValues[event.device] = event.value;
+            ++drainedCount;
+        });
+
+        if(finished)
+            break;
+
+        Thread::Yield();
+    }
+
+    for(Thread::Handle& producer : producers)
+    {
+        producer.Join();
+    }
+
+    TEST_TRUE(ordered);
+    TEST_TRUE(drainedCount == producerCount * eventCount);
+    TEST_TRUE(input.GetState().GetGamepadAxis(2, Input::GamepadAxis::LeftX) == eventCount - 1);
+}
@@ -57,3 +57,20 @@ TEST_DEFINE("Memory.InlineAllocator", "EmptyHeapArray")
     TEST_TRUE(array.GetCapacity() == 0);
     TEST_TRUE(memoryGuard.ValidateTotalAllocations(0, 0));
 }
+
+TEST_DEFINE("Memory.InlineAllocator", "ArraySpill")
+{
+    InlineArray<String, 2> array;
+    array.Add("Hello");
+    array.Add("World");
+    array.Add("Spilled to secondary allocation");
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(2));
+
+    array.RemoveAt(2);
+    array.ShrinkToFit();
+    TEST_TRUE(memoryGuard.ValidateCurrentAllocations(0));
+
+    TEST_TRUE(array.GetSize() == 2);
+    TEST_TRUE(array[0] == "Hello");
+    TEST_TRUE(array[1] == "World");
+}
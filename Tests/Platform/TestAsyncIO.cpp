@@ -0,0 +1,185 @@
+#include "Shared.hpp"
+#include "Platform/AsyncIO.hpp"
+#include "Platform/Config.hpp"
+
+namespace
+{
+    void TestAsyncRead(const Platform::AsyncIOConfig& config, const StringView& filePath)
+    {
+        const StringView contents = "0123456789abcdefghijklmnopqrstuvwxyz";
+        TEST_TRUE(WriteStringToFile(filePath, contents));
+
+        SCOPE_GUARD
+        {
+            std::remove(*filePath);
+        };
+
+        Platform::AsyncIO asyncIO;
+        TEST_TRUE(asyncIO.Setup(config));
+
+        Platform::AsyncFile file;
+        TEST_TRUE(file.Open(filePath, Platform::AsyncIOOperation::Read));
+        TEST_TRUE(file.GetSize() == contents.GetLength());
+
+        // Last request reads past end of file and receives fewer bytes.
+        const u64 chunkSize = 10;
+        char buffers[4][chunkSize] = {};
+        Platform::AsyncIORequest requests[4];
+        Platform::AsyncIORequest* batch[4];
+        u32 callbackCount = 0;
+
+        for(u64 i = 0; i < 4; ++i)
+        {
+            requests[i].file = &file;
+            requests[i].buffer = buffers[i];
+            requests[i].offset = i * chunkSize;
+            requests[i].size = chunkSize;
+            requests[i].priority = static_cast<Platform::AsyncIOPriority>(i % 3);
+            requests[i].callback = [&callbackCount](Platform::AsyncIORequest& request)
+            {
+                TEST_TRUE(request.IsSucceeded());
+                ++callbackCount;
+            };
+
+            TEST_TRUE(requests[i].GetStatus() == Platform::AsyncIOStatus::Idle);
+            batch[i] = &requests[i];
+        }
+
+        asyncIO.Submit(batch, 4);
+
+        for(u64 i = 0; i < 4; ++i)
+        {
+            asyncIO.Wait(requests[i]);
+            TEST_TRUE(requests[i].IsSucceeded());
+
+            const u64 expectedSize = std::min(chunkSize, contents.GetLength() - i * chunkSize);
+            TEST_TRUE(requests[i].GetTransferredBytes() == expectedSize);
+            TEST_TRUE(StringView(buffers[i], expectedSize) == contents.SubString(i * chunkSize, i * chunkSize + expectedSize));
+        }
+
+        TEST_TRUE(callbackCount == 0);
+        TEST_TRUE(asyncIO.ProcessCompletions() == 4);
+        TEST_TRUE(callbackCount == 4);
+        TEST_TRUE(asyncIO.ProcessCompletions() == 0);
+    }
+}
+
+TEST_DEFINE("Platform.AsyncIO", "WorkerRead")
+{
+    Platform::AsyncIOConfig config;
+    config.allowKernelQueue = false;
+    TestAsyncRead(config, "TestAsyncIOWorkerRead.txt");
+}
+
+TEST_DEFINE("Platform.AsyncIO", "SubmittingThreadRead")
+{
+    Platform::AsyncIOConfig config;
+    config.allowKernelQueue = false;
+    config.workerCount = 0;
+    TestAsyncRead(config, "TestAsyncIOSubmittingThreadRead.txt");
+}
+
+TEST_DEFINE("Platform.AsyncIO", "KernelQueueRead")
+{
+    // Falls back to worker threads when kernel queue is not available.
+    Platform::AsyncIOConfig config;
+    config.queueDepth = 2;
+    TestAsyncRead(config, "TestAsyncIOKernelQueueRead.txt");
+}
+
+TEST_DEFINE("Platform.AsyncIO", "Write")
+{
+    const StringView filePath = "TestAsyncIOWrite.txt";
+    const StringView contents = "Hello async world!";
+
+    SCOPE_GUARD
+    {
+        std::remove(*filePath);
+    };
+
+    {
+        Platform::AsyncIO asyncIO;
+        TEST_TRUE(asyncIO.Setup(Platform::AsyncIOConfig()));
+
+        Platform::AsyncFile file;
+        TEST_TRUE(file.Open(filePath, Platform::AsyncIOOperation::Write));
+
+        // Chunks are written out of order at explicit offsets.
+        Platform::AsyncIORequest second;
+        second.file = &file;
+        second.operation = Platform::AsyncIOOperation::Write;
+        second.buffer = const_cast<char*>(contents.GetData() + 6);
+        second.offset = 6;
+        second.size = contents.GetLength() - 6;
+        asyncIO.Submit(second);
+
+        Platform::AsyncIORequest first;
+        first.file = &file;
+        first.operation = Platform::AsyncIOOperation::Write;
+        first.buffer = const_cast<char*>(contents.GetData());
+        first.size = 6;
+        asyncIO.Submit(first);
+
+        asyncIO.Wait(second);
+        asyncIO.Wait(first);
+        TEST_TRUE(first.IsSucceeded());
+        TEST_TRUE(second.IsSucceeded());
+        TEST_TRUE(first.GetTransferredBytes() + second.GetTransferredBytes() == contents.GetLength());
+        TEST_TRUE(file.GetSize() == contents.GetLength());
+    }
+
+    String writtenContents;
+    TEST_TRUE(ReadStringFromFile(filePath, writtenContents));
+    TEST_TRUE(writtenContents == contents);
+}
+
+TEST_DEFINE("Platform.AsyncIO", "Priority")
+{
+    const StringView filePath = "TestAsyncIOPriority.txt";
+    TEST_TRUE(WriteStringToFile(filePath, "LNH"));
+
+    SCOPE_GUARD
+    {
+        std::remove(*filePath);
+    };
+
+    // Single worker receives whole batch at once and picks highest priority first.
+    Platform::AsyncIOConfig config;
+    config.allowKernelQueue = false;
+    config.workerCount = 1;
+
+    Platform::AsyncIO asyncIO;
+    TEST_TRUE(asyncIO.Setup(config));
+
+    Platform::AsyncFile file;
+    TEST_TRUE(file.Open(filePath, Platform::AsyncIOOperation::Read));
+
+    char buffer[3] = {};
+    InlineString<4> order;
+    Platform::AsyncIORequest requests[3];
+    Platform::AsyncIORequest* batch[3];
+
+    for(u64 i = 0; i < 3; ++i)
+    {
+        requests[i].file = &file;
+        requests[i].buffer = &buffer[i];
+        requests[i].offset = i;
+        requests[i].size = 1;
+        requests[i].priority = static_cast<Platform::AsyncIOPriority>(i);
+        requests[i].callback = [&order](Platform::AsyncIORequest& request)
+        {
+            order.Append("%c", *static_cast<const char*>(request.buffer));
+        };
+
+        batch[i] = &requests[i];
+    }
+
+    asyncIO.Submit(batch, 3);
+    for(const Platform::AsyncIORequest& request : requests)
+    {
+        asyncIO.Wait(request);
+    }
+
+    TEST_TRUE(asyncIO.ProcessCompletions() == 3);
+    TEST_TRUE(order == "HNL");
+}
@@ -0,0 +1,107 @@
+#include "Shared.hpp"
+#include "Platform/CommandLine.hpp"
+
+TEST_DEFINE("Platform.CommandLine", "Lookup")
+{
+    const char* arguments[] =
+    {
+        "Tests",
+        "-Flag",
+        "--Name=First",
+        "Positional",
+        "-Name=Second",
+        "-Quoted=\"Value\"",
+    };
+
+    Platform::CommandLine commandLine;
+    commandLine.Parse(6, arguments);
+    commandLine.Print();
+
+    TEST_TRUE(commandLine.HasArgument("Flag"));
+    TEST_TRUE(commandLine.HasArgument("Name"));
+    TEST_FALSE(commandLine.HasArgument("Positional"));
+    TEST_FALSE(commandLine.HasArgument("Missing"));
+    TEST_FALSE(commandLine.HasArgument("Nam"));
+    TEST_FALSE(commandLine.GetArgumentValue("Flag"));
+    TEST_TRUE(commandLine.GetArgumentValue("Name").GetValue() == "First");
+    TEST_TRUE(commandLine.GetArgumentValue("Quoted").GetValue() == "Value");
+
+    // Index is rebuilt when parsed again.
+    const char* otherArguments[] = { "Tests", "-Other" };
+    commandLine.Parse(2, otherArguments);
+    TEST_TRUE(commandLine.HasArgument("Other"));
+    TEST_FALSE(commandLine.HasArgument("Name"));
+
+    // Many arguments that collide in small table can all be found.
+    HeapArray<HeapString> names;
+    HeapArray<const char*> manyArguments;
+    manyArguments.Add("Tests");
+    for(u32 i = 0; i < 100; ++i)
+    {
+        names.Add(HeapString::Format("-Argument%u=%u", i, i * 3));
+    }
+
+    for(const HeapString& name : names)
+    {
+        manyArguments.Add(*name);
+    }
+
+    commandLine.Parse(static_cast<u32>(manyArguments.GetSize()), manyArguments.GetData());
+    for(u32 i = 0; i < 100; ++i)
+    {
+        const HeapString name = HeapString::Format("Argument%u", i);
+        TEST_TRUE(commandLine.GetInt(name).GetSuccess() == i * 3);
+    }
+}
+
+TEST_DEFINE("Platform.CommandLine", "TypedGetters")
+{
+    using ArgumentError = Platform::CommandLine::ArgumentError;
+
+    const char* arguments[] =
+    {
+        "Tests",
+        "-Count=42",
+        "-Offset=-9223372036854775808",
+        "-Overflow=9223372036854775808",
+        "-Scale=0.125",
+        "-Exponent=-2.5e3",
+        "-Flag",
+        "-Enabled=false",
+        "-Number=1",
+        "-Paths=First,Second,,Third",
+        "-Empty=",
+        "-Text=abc",
+    };
+
+    Platform::CommandLine commandLine;
+    commandLine.Parse(12, arguments);
+
+    TEST_TRUE(commandLine.GetInt("Count").GetSuccess() == 42);
+    TEST_TRUE(commandLine.GetInt("Offset").GetSuccess() == std::numeric_limits<i64>::min());
+    TEST_TRUE(commandLine.GetInt("Overflow").GetFailure() == ArgumentError::InvalidValue);
+    TEST_TRUE(commandLine.GetInt("Scale").GetFailure() == ArgumentError::InvalidValue);
+    TEST_TRUE(commandLine.GetInt("Empty").GetFailure() == ArgumentError::InvalidValue);
+    TEST_TRUE(commandLine.GetInt("Flag").GetFailure() == ArgumentError::MissingValue);
+    TEST_TRUE(commandLine.GetInt("Missing").GetFailure() == ArgumentError::Missing);
+
+    TEST_TRUE(commandLine.GetFloat("Scale").GetSuccess() == 0.125);
+    TEST_TRUE(commandLine.GetFloat("Exponent").GetSuccess() == -2500.0);
+    TEST_TRUE(commandLine.GetFloat("Count").GetSuccess() == 42.0);
+    TEST_TRUE(commandLine.GetFloat("Text").GetFailure() == ArgumentError::InvalidValue);
+
+    TEST_TRUE(commandLine.GetBool("Flag").GetSuccess());
+    TEST_FALSE(commandLine.GetBool("Enabled").GetSuccess());
+    TEST_TRUE(commandLine.GetBool("Number").GetSuccess());
+    TEST_TRUE(commandLine.GetBool("Text").GetFailure() == ArgumentError::InvalidValue);
+    TEST_TRUE(commandLine.GetBool("Missing").GetFailure() == ArgumentError::Missing);
+
+    const auto paths = commandLine.GetList("Paths");
+    TEST_TRUE(paths.GetSuccess().GetSize() == 4);
+    TEST_TRUE(paths.GetSuccess()[0] == "First");
+    TEST_TRUE(paths.GetSuccess()[2].IsEmpty());
+    TEST_TRUE(paths.GetSuccess()[3] == "Third");
+    TEST_TRUE(commandLine.GetList("Empty").GetSuccess().IsEmpty());
+    TEST_TRUE(commandLine.GetList("Count").GetSuccess().GetSize() == 1);
+    TEST_TRUE(commandLine.GetList("Flag").GetFailure() == ArgumentError::MissingValue);
+}
@@ -0,0 +1,111 @@
+#include "Shared.hpp"
+
+TEST_DEFINE("Platform.FileUtility", "CheckFileEqualsString")
+{
+    const StringView filePath = "TestFileEquals.txt";
+    TEST_TRUE(WriteStringToFile(filePath, "Hello world!"));
+
+    SCOPE_GUARD
+    {
+        std::remove(*filePath);
+    };
+
+    TEST_TRUE(CheckFileEqualsString(filePath, "Hello world!"));
+    TEST_FALSE(CheckFileEqualsString(filePath, "Hello world?"));
+    TEST_FALSE(CheckFileEqualsString(filePath, "Hello world"));
+    TEST_FALSE(CheckFileEqualsString(filePath, "Hello world!!"));
+    TEST_FALSE(CheckFileEqualsString("TestFileEqualsMissing.txt", ""));
+}
+
+TEST_DEFINE("Platform.FileUtility", "WriteStringToFileIfDifferent")
+{
+    const StringView filePath = "TestFileIfDifferent.txt";
+    const StringView userPath = "TestFileIfDifferent.txt.tmp";
+
+    SCOPE_GUARD
+    {
+        std::remove(*filePath);
+        std::remove(*userPath);
+    };
+
+    // File that happens to be named like temporary file is not touched.
+    TEST_TRUE(WriteStringToFile(userPath, "User"));
+
+    TEST_TRUE(WriteStringToFileIfDifferent(filePath, "First"));
+    TEST_TRUE(CheckFileEqualsString(filePath, "First"));
+
+    struct stat originalStats;
+    TEST_TRUE(stat(*filePath, &originalStats) == 0);
+
+    // Unchanged file is left alone, while changed file is replaced with a new one.
+    struct stat unchangedStats;
+    TEST_TRUE(WriteStringToFileIfDifferent(filePath, "First"));
+    TEST_TRUE(stat(*filePath, &unchangedStats) == 0);
+    TEST_TRUE(CheckFileEqualsString(filePath, "First"));
+
+    TEST_TRUE(WriteStringToFileIfDifferent(filePath, "Other"));
+    TEST_TRUE(CheckFileEqualsString(filePath, "Other"));
+    TEST_TRUE(CheckFileEqualsString(userPath, "User"));
+
+#if defined(PLATFORM_LINUX)
+    struct stat changedStats;
+    TEST_TRUE(stat(*filePath, &changedStats) == 0);
+    TEST_TRUE(unchangedStats.st_ino == originalStats.st_ino);
+    TEST_TRUE(changedStats.st_ino != originalStats.st_ino);
+#endif
+}
+
+TEST_DEFINE("Platform.FileUtility", "WriteFilesIfDifferent")
+{
+    const FileContents files[] =
+    {
+        { "TestFilesUnchanged.txt", "Unchanged" },
+        { "TestFilesChanged.txt", "Changed" },
+        { "TestFilesCreated.txt", "Created" },
+    };
+
+    SCOPE_GUARD
+    {
+        for(const FileContents& file : files)
+        {
+            std::remove(*file.path);
+        }
+    };
+
+    TEST_TRUE(WriteStringToFile(files[0].path, files[0].contents));
+    TEST_TRUE(WriteStringToFile(files[1].path, "Original"));
+
+    TEST_TRUE(WriteFilesIfDifferent(files, ArraySize(files)));
+    for(const FileContents& file : files)
+    {
+        TEST_TRUE(CheckFileEqualsString(file.path, file.contents));
+    }
+
+    TEST_TRUE(WriteStringToFileAtomic(files[2].path, "Replaced"));
+    TEST_TRUE(CheckFileEqualsString(files[2].path, "Replaced"));
+
+    // Temporary files of concurrent writers to the same path do not collide.
+    std::atomic<u32> failures = 0;
+    std::thread writers[4];
+    for(std::thread& writer : writers)
+    {
+        writer = std::thread([&files, &failures]()
+        {
+            for(u32 i = 0; i < 20; ++i)
+            {
+                if(!WriteStringToFileAtomic(files[0].path, i % 2 ? "Odd" : "Even"))
+                {
+                    ++failures;
+                }
+            }
+        });
+    }
+
+    for(std::thread& writer : writers)
+    {
+        writer.join();
+    }
+
+    TEST_TRUE(failures == 0);
+    TEST_TRUE(CheckFileEqualsString(files[0].path, "Odd"));
+}
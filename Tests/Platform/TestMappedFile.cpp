@@ -0,0 +1,80 @@
+#include "Shared.hpp"
+#include "Platform/MappedFile.hpp"
+
+TEST_DEFINE("Platform.MappedFile", "Empty")
+{
+    Platform::MappedFile file;
+    TEST_FALSE(file.IsOpen());
+    TEST_FALSE(file.IsMapped());
+    TEST_TRUE(file.GetData() == nullptr);
+    TEST_TRUE(file.GetSize() == 0);
+    TEST_TRUE(file.GetStringView().IsEmpty());
+}
+
+TEST_DEFINE("Platform.MappedFile", "Mapped")
+{
+    const StringView filePath = "TestMappedFile.txt";
+    const StringView contents = "Hello mapped world!";
+    TEST_TRUE(WriteStringToFile(filePath, contents));
+
+    SCOPE_GUARD
+    {
+        std::remove(*filePath);
+    };
+
+    Platform::MappedFile file;
+    TEST_TRUE(file.Open(filePath));
+    TEST_TRUE(file.IsOpen());
+    TEST_TRUE(file.IsMapped());
+    TEST_TRUE(file.GetSize() == contents.GetLength());
+    TEST_TRUE(file.GetStringView() == contents);
+
+    Platform::MappedFile movedFile(Move(file));
+    TEST_FALSE(file.IsOpen());
+    TEST_TRUE(movedFile.IsMapped());
+    TEST_TRUE(movedFile.GetStringView() == contents);
+
+    movedFile.Close();
+    TEST_FALSE(movedFile.IsOpen());
+    TEST_TRUE(movedFile.GetData() == nullptr);
+
+    String readContents;
+    TEST_TRUE(ReadStringFromFile(filePath, readContents));
+    TEST_TRUE(readContents == contents);
+}
+
+TEST_DEFINE("Platform.MappedFile", "EmptyFile")
+{
+    const StringView filePath = "TestMappedFileEmpty.txt";
+    TEST_TRUE(WriteStringToFile(filePath, ""));
+
+    SCOPE_GUARD
+    {
+        std::remove(*filePath);
+    };
+
+    Platform::MappedFile file;
+    TEST_TRUE(file.Open(filePath));
+    TEST_TRUE(file.IsOpen());
+    TEST_FALSE(file.IsMapped());
+    TEST_TRUE(file.GetSize() == 0);
+    TEST_TRUE(file.GetStringView().IsEmpty());
+}
+
+#if defined(PLATFORM_LINUX)
+TEST_DEFINE("Platform.MappedFile", "Streamed")
+{
+    // Procfs files report zero size, so they must be streamed instead of mapped.
+    Platform::MappedFile file;
+    TEST_TRUE(file.Open("/proc/self/status"));
+    TEST_TRUE(file.IsOpen());
+    TEST_FALSE(file.IsMapped());
+    TEST_TRUE(file.GetSize() > 0);
+    TEST_TRUE(file.GetStringView().GetLength() == file.GetSize());
+
+    Platform::MappedFile movedFile;
+    movedFile = Move(file);
+    TEST_FALSE(file.IsOpen());
+    TEST_TRUE(movedFile.GetSize() > 0);
+}
+#endif
@@ -0,0 +1,241 @@
+#include "Shared.hpp"
+#include "Platform/ThreadStats.hpp"
+
+namespace
+{
+    template<typename LockType>
+    void TestLockContention()
+    {
+        // Unsynchronized increments would lose updates if lock did not provide mutual exclusion.
+        const u32 threadCount = 4;
+        const u32 incrementCount = 20000;
+
+        LockType lock;
+        u64 counter = 0;
+
+        InlineArray<Thread::Handle, threadCount> threads;
+        for(u32 i = 0; i < threadCount; ++i)
+        {
+            threads.Add(Thread::Create(Thread::Config(), [&lock, &counter]()
+            {
+                for(u32 j = 0; j < incrementCount; ++j)
+                {
+                    Thread::ScopedLock scopedLock(lock);
+                    ++counter;
+                }
+            }));
+        }
+
+        for(Thread::Handle& thread : threads)
+        {
+            thread.Join();
+        }
+
+        TEST_TRUE(counter == threadCount * incrementCount);
+        TEST_TRUE(lock.TryLock());
+        TEST_TRUE(!lock.TryLock());
+        lock.Unlock();
+    }
+}
+
+TEST_DEFINE("Platform.Synchronization", "Mutex")
+{
+    Thread::Mutex mutex;
+    TEST_TRUE(mutex.TryLock());
+    TEST_TRUE(!mutex.TryLock());
+    mutex.Unlock();
+    TEST_TRUE(mutex.GetContentionCount() == 0);
+
+    TestLockContention<Thread::Mutex>();
+}
+
+TEST_DEFINE("Platform.Synchronization", "SpinLock")
+{
+    Thread::SpinLock spinLock;
+    TEST_TRUE(spinLock.TryLock());
+    TEST_TRUE(!spinLock.TryLock());
+    spinLock.Unlock();
+    TEST_TRUE(spinLock.GetContentionCount() == 0);
+
+    TestLockContention<Thread::SpinLock>();
+}
+
+TEST_DEFINE("Platform.Synchronization", "ConditionVariable")
+{
+    // Ping-pong between two threads requires every notification to be received.
+    const u32 roundCount = 1000;
+
+    Thread::Mutex mutex;
+    Thread::ConditionVariable condition;
+    u32 turn = 0;
+
+    Thread::Handle thread = Thread::Create(Thread::Config(), [&]()
+    {
+        for(u32 i = 0; i < roundCount; ++i)
+        {
+            Thread::ScopedLock lock(mutex);
+            condition.Wait(mutex, [&turn, i]()
+            {
+                return turn == i * 2 + 1;
+            });
+
+            ++turn;
+            condition.NotifyAll();
+        }
+    });
+
+    for(u32 i = 0; i < roundCount; ++i)
+    {
+        Thread::ScopedLock lock(mutex);
+        ++turn;
+        condition.NotifyOne();
+
+        condition.Wait(mutex, [&turn, i]()
+        {
+            return turn == i * 2 + 2;
+        });
+    }
+
+    thread.Join();
+    TEST_TRUE(turn == roundCount * 2);
+}
+
+TEST_DEFINE("Platform.Synchronization", "Semaphore")
+{
+    Thread::Semaphore semaphore(2);
+    TEST_TRUE(semaphore.TryAcquire());
+    TEST_TRUE(semaphore.TryAcquire());
+    TEST_TRUE(!semaphore.TryAcquire());
+
+    // Every released unit is acquired by exactly one consumer.
+    const u32 consumerCount = 4;
+    const u32 itemsPerConsumer = 1000;
+    std::atomic<u32> acquiredCount = 0;
+
+    InlineArray<Thread::Handle, consumerCount> consumers;
+    for(u32 i = 0; i < consumerCount; ++i)
+    {
+        consumers.Add(Thread::Create(Thread::Config(), [&semaphore, &acquiredCount]()
+        {
+            for(u32 j = 0; j < itemsPerConsumer; ++j)
+            {
+                semaphore.Acquire();
+                ++acquiredCount;
+            }
+        }));
+    }
+
+    // Units are released both in batches that wake all waiters and one by one.
+    for(u32 i = 0; i < consumerCount * itemsPerConsumer; i += 10)
+    {
+        if(i % 20 == 0)
+        {
+            semaphore.Release(10);
+        }
+        else
+        {
+            for(u32 j = 0; j < 10; ++j)
+            {
+                semaphore.Release();
+            }
+        }
+    }
+
+    for(Thread::Handle& consumer : consumers)
+    {
+        consumer.Join();
+    }
+
+    TEST_TRUE(acquiredCount == consumerCount * itemsPerConsumer);
+    TEST_TRUE(semaphore.GetCount() == 0);
+}
+
+TEST_DEFINE("Platform.Synchronization", "Event")
+{
+    Thread::Event manualEvent(true);
+    TEST_TRUE(!manualEvent.IsSignaled());
+    manualEvent.Signal();
+    manualEvent.Wait();
+    manualEvent.Wait();
+    TEST_TRUE(manualEvent.IsSignaled());
+    manualEvent.Reset();
+    TEST_TRUE(!manualEvent.IsSignaled());
+
+    Thread::Event autoEvent(false, true);
+    autoEvent.Wait();
+    TEST_TRUE(!autoEvent.IsSignaled());
+
+    // Each automatic reset signal releases one waiter, so signals
+    // are only sent back once previous one has been consumed.
+    const u32 roundCount = 1000;
+    Thread::Event requestEvent;
+    Thread::Event responseEvent;
+    u32 counter = 0;
+
+    Thread::Handle thread = Thread::Create(Thread::Config(), [&]()
+    {
+        for(u32 i = 0; i < roundCount; ++i)
+        {
+            requestEvent.Wait();
+            ++counter;
+            responseEvent.Signal();
+        }
+    });
+
+    for(u32 i = 0; i < roundCount; ++i)
+    {
+        requestEvent.Signal();
+        responseEvent.Wait();
+    }
+
+    thread.Join();
+    TEST_TRUE(counter == roundCount);
+
+    // Manual reset signal releases all waiters at once.
+    std::atomic<u32> releasedCount = 0;
+    Thread::Event startEvent(true);
+    InlineArray<Thread::Handle, 4> waiters;
+    for(u32 i = 0; i < 4; ++i)
+    {
+        waiters.Add(Thread::Create(Thread::Config(), [&startEvent, &releasedCount]()
+        {
+            startEvent.Wait();
+            ++releasedCount;
+        }));
+    }
+
+    startEvent.Signal();
+    for(Thread::Handle& waiter : waiters)
+    {
+        waiter.Join();
+    }
+
+    TEST_TRUE(releasedCount == 4);
+}
+
+TEST_DEFINE("Platform.Synchronization", "Stats")
+{
+#if ENABLE_THREAD_STATS
+    // Lock held by this thread forces other thread to contend and eventually sleep.
+    const u64 contendedCount = Thread::Stats::Get().GetMutexContendedCount();
+
+    Thread::Mutex mutex;
+    mutex.Lock();
+
+    Thread::Handle thread = Thread::Create(Thread::Config(), [&mutex]()
+    {
+        Thread::ScopedLock lock(mutex);
+    });
+
+    while(mutex.GetContentionCount() == 0)
+    {
+        Thread::Yield();
+    }
+
+    mutex.Unlock();
+    thread.Join();
+
+    TEST_TRUE(mutex.GetContentionCount() == 1);
+    TEST_TRUE(Thread::Stats::Get().GetMutexContendedCount() > contendedCount);
+#endif
+}
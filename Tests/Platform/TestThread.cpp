@@ -0,0 +1,46 @@
+#include "Shared.hpp"
+
+TEST_DEFINE("Platform.Thread", "Create")
+{
+    std::atomic<u32> value = 0;
+
+    Thread::Config config;
+    config.name = "Test Thread With Long Name";
+    config.affinityMask = 1;
+    config.priority = Thread::Priority::Low;
+
+    Thread::Handle thread = Thread::Create(config, [&value]()
+    {
+        value = 42;
+    });
+
+    TEST_TRUE(thread.IsJoinable());
+    thread.Join();
+    TEST_TRUE(!thread.IsJoinable());
+    TEST_TRUE(value == 42);
+}
+
+TEST_DEFINE("Platform.Thread", "Move")
+{
+    std::atomic<u32> counter = 0;
+    HeapArray<Thread::Handle> threads;
+    for(u32 i = 0; i < 4; ++i)
+    {
+        threads.Add(Thread::Create(Thread::Config(), [&counter]()
+        {
+            ++counter;
+        }));
+    }
+
+    Thread::Handle moved = Move(threads[0]);
+    TEST_TRUE(!threads[0].IsJoinable());
+    TEST_TRUE(moved.IsJoinable());
+    moved.Join();
+
+    for(u32 i = 1; i < 4; ++i)
+    {
+        threads[i].Join();
+    }
+
+    TEST_TRUE(counter == 4);
+}
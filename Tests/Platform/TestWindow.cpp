@@ -0,0 +1,134 @@
+#include "Shared.hpp"
+#include "Platform/Config.hpp"
+#include "Platform/Window.hpp"
+#include "Platform/WindowEventScript.hpp"
+#include "Input/System.hpp"
+
+TEST_DEFINE("Platform.Window", "ParseEventScript")
+{
+    const StringView text =
+        "# Comment line\n"
+        "0.5 key 65 1 # Trailing comment\n"
+        "\n"
+        "  0.25\tresize 800 600\r\n"
+        "0.5 mouse_move -10 20\n"
+        "1 mouse_button 2 0\n"
+        "2.0 close";
+
+    Platform::WindowEventScript script;
+    TEST_TRUE(script.Parse(text));
+    TEST_TRUE(script.GetEventCount() == 5);
+
+    // Events are ordered by time, and equal times keep order of lines.
+    const Platform::WindowEvent& resize = script.GetEvent(0);
+    TEST_TRUE(resize.type == Platform::WindowEventType::Resize);
+    TEST_TRUE(resize.time == 0.25f);
+    TEST_TRUE(resize.x == 800 && resize.y == 600);
+
+    const Platform::WindowEvent& key = script.GetEvent(1);
+    TEST_TRUE(key.type == Platform::WindowEventType::Key);
+    TEST_TRUE(key.code == 65 && key.x == 1);
+
+    const Platform::WindowEvent& mouseMove = script.GetEvent(2);
+    TEST_TRUE(mouseMove.type == Platform::WindowEventType::MouseMove);
+    TEST_TRUE(mouseMove.x == -10 && mouseMove.y == 20);
+
+    TEST_TRUE(script.GetEvent(3).type == Platform::WindowEventType::MouseButton);
+    TEST_TRUE(script.GetEvent(3).code == 2 && script.GetEvent(3).x == 0);
+    TEST_TRUE(script.GetEvent(4).type == Platform::WindowEventType::Close);
+    TEST_TRUE(script.GetEvent(4).time == 2.0f);
+}
+
+TEST_DEFINE("Platform.Window", "LoadEventScript")
+{
+    const StringView filePath = "TestWindowLoadEventScript.txt";
+    TEST_TRUE(WriteStringToFile(filePath, "0 resize 320 240\n0.1 close\n"));
+
+    SCOPE_GUARD
+    {
+        std::remove(*filePath);
+    };
+
+    Platform::WindowEventScript script;
+    TEST_TRUE(script.Load(filePath));
+    TEST_TRUE(script.GetEventCount() == 2);
+    TEST_TRUE(script.GetEvent(1).type == Platform::WindowEventType::Close);
+}
+
+TEST_DEFINE("Platform.Window", "FixedStepPlayback")
+{
+    Platform::WindowEventScript script;
+    script.Add({ 0.3f, Platform::WindowEventType::Key, 1, 1 });
+    script.Add({ 0.1f, Platform::WindowEventType::Key, 2, 1 });
+    script.Add({ 0.3f, Platform::WindowEventType::Key, 3, 0 });
+    script.Add({ 1.0f, Platform::WindowEventType::Close });
+    TEST_TRUE(!script.IsPlaying());
+
+    // Events land on the frame whose time matches, without drifting over many frames.
+    script.Start(0.1f);
+    u32 frameEvents[12] = {};
+    u32 deliveredCodes[4] = {};
+    u32 deliveredCount = 0;
+    for(u32 frame = 1; frame <= 12; ++frame)
+    {
+        script.Advance();
+
+        Platform::WindowEvent event;
+        while(script.PopEvent(event))
+        {
+            ++frameEvents[frame - 1];
+            deliveredCodes[deliveredCount++] = event.code;
+        }
+    }
+
+    TEST_TRUE(frameEvents[0] == 1);
+    TEST_TRUE(frameEvents[2] == 2);
+    TEST_TRUE(frameEvents[9] == 1);
+    TEST_TRUE(deliveredCount == 4);
+    TEST_TRUE(deliveredCodes[0] == 2 && deliveredCodes[1] == 1 && deliveredCodes[2] == 3);
+    TEST_TRUE(script.IsFinished());
+}
+
+#if defined(PLATFORM_LINUX)
+TEST_DEFINE("Platform.Window", "HeadlessEvents")
+{
+    Platform::WindowConfig config;
+    config.width = 640;
+    config.height = 480;
+
+    Platform::Window window;
+    TEST_TRUE(window.Setup(config));
+    TEST_TRUE(window.GetWidth() == 640 && window.GetHeight() == 480);
+
+    u32 resizeCount = 0;
+    window.GetResizeDelegate().Add([&resizeCount](u32 width, u32 height)
+    {
+        ++resizeCount;
+    });
+
+    Input::System input;
+    window.SetInputSystem(&input);
+
+    Platform::WindowEventScript script;
+    TEST_TRUE(script.Parse("0.5 resize 800 600\n1.0 key 32 1\n1.5 close\n"));
+    window.PlayEventScript(Move(script), 0.5f);
+
+    window.ProcessEvents();
+    input.Update();
+    TEST_TRUE(window.GetWidth() == 800 && window.GetHeight() == 600);
+    TEST_TRUE(resizeCount == 1);
+    TEST_TRUE(!input.GetState().IsKeyDown(Input::Key::Space));
+
+    window.ProcessEvents();
+    input.Update();
+    TEST_TRUE(input.GetState().WasKeyPressed(Input::Key::Space));
+    TEST_TRUE(!window.IsClosing());
+
+    // Size set directly on headless window is reported on next processing.
+    window.SetSize(1024, 768);
+    window.ProcessEvents();
+    TEST_TRUE(window.GetWidth() == 1024);
+    TEST_TRUE(resizeCount == 2);
+    TEST_TRUE(window.IsClosing());
+}
+#endif
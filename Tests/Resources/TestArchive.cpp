@@ -0,0 +1,240 @@
+#include "Shared.hpp"
+#include "Resources/Archive.hpp"
+#include "Resources/ArchiveWriter.hpp"
+#include "Resources/Manager.hpp"
+#include "Resources/Config.hpp"
+#include "Common/Utility/Compression.hpp"
+
+namespace
+{
+    class ArchiveTextResource final : public Resources::Resource
+    {
+    public:
+        HeapString text;
+
+        bool Load(const u8* data, const u64 size) override
+        {
+            text = StringView(reinterpret_cast<const char*>(data), size);
+            return true;
+        }
+
+        u64 GetMemorySize() const override
+        {
+            return text.GetLength();
+        }
+    };
+
+    HeapString CreateRepeatedText(const StringView& line, const u32 count)
+    {
+        HeapString text;
+        for(u32 i = 0; i < count; ++i)
+        {
+            text += line;
+        }
+
+        return text;
+    }
+}
+
+TEST_DEFINE("Resources.Archive", "WriteAndRead")
+{
+    const StringView archivePath = "TestArchiveWriteAndRead.pak";
+    SCOPE_GUARD
+    {
+        std::remove(*archivePath);
+    };
+
+    const HeapString repeated = CreateRepeatedText("Compressible line of text\n", 100);
+
+    {
+        Resources::ArchiveWriter writer;
+        TEST_TRUE(writer.AddFile("Data/First.txt", "First", true));
+        TEST_TRUE(writer.AddFile("Data/Second.txt", "Second file", false));
+        TEST_TRUE(writer.AddFile("Data/Repeated.txt", repeated, true));
+        TEST_TRUE(writer.AddFile("Data/Empty.txt", "", true));
+        TEST_TRUE(writer.GetFileCount() == 4);
+
+        // Short contents that do not get smaller are stored uncompressed.
+        TEST_TRUE(writer.GetCompressedCount() == 1);
+        TEST_TRUE(writer.GetStoredSize() < writer.GetSize());
+        TEST_TRUE(writer.Write(archivePath));
+    }
+
+    Resources::Archive archive;
+    TEST_TRUE(archive.Open(archivePath));
+    TEST_TRUE(archive.IsOpen());
+    TEST_TRUE(archive.GetEntryCount() == 4);
+
+    for(u64 i = 0; i < archive.GetEntryCount(); ++i)
+    {
+        const Resources::ArchiveEntry& entry = archive.GetEntries()[i];
+        TEST_TRUE(entry.offset % Resources::ArchiveHeader::DataAlignment == 0);
+        TEST_TRUE(i == 0 || archive.GetEntries()[i - 1].hash < entry.hash);
+        TEST_TRUE(entry.hash == StringId::Compute(archive.GetName(entry)).GetHash());
+    }
+
+    HeapArray<u8> buffer;
+    Optional<StringView> first = archive.Read("Data/First.txt", buffer);
+    TEST_TRUE(first && *first == "First");
+
+    // Uncompressed data is returned in place from mapped archive.
+    const Resources::ArchiveEntry* second = archive.FindEntry("Data/Second.txt");
+    TEST_TRUE(second != nullptr);
+    TEST_FALSE(second->IsCompressed());
+    Optional<StringView> secondData = archive.Read(*second, buffer);
+    TEST_TRUE(secondData && *secondData == "Second file");
+    TEST_TRUE(secondData->GetData() == archive.GetStoredData(*second).GetData());
+
+    const Resources::ArchiveEntry* repeatedEntry = archive.FindEntry("Data/Repeated.txt");
+    TEST_TRUE(repeatedEntry != nullptr);
+    TEST_TRUE(repeatedEntry->IsCompressed());
+    TEST_TRUE(repeatedEntry->storedSize < repeatedEntry->size);
+    Optional<StringView> repeatedData = archive.Read(*repeatedEntry, buffer);
+    TEST_TRUE(repeatedData && *repeatedData == repeated);
+
+    Optional<StringView> empty = archive.Read("Data/Empty.txt", buffer);
+    TEST_TRUE(empty && empty->IsEmpty());
+
+    TEST_TRUE(archive.FindEntry("Data/Missing.txt") == nullptr);
+    TEST_FALSE(archive.Read("Data/Missing.txt", buffer));
+    TEST_TRUE(archive.FindEntry("Data/First.tx") == nullptr);
+
+    archive.Close();
+    TEST_FALSE(archive.IsOpen());
+}
+
+TEST_DEFINE("Resources.Archive", "ManyEntries")
+{
+    const StringView archivePath = "TestArchiveManyEntries.pak";
+    SCOPE_GUARD
+    {
+        std::remove(*archivePath);
+    };
+
+    const u32 entryCount = 500;
+    {
+        Resources::ArchiveWriter writer;
+        for(u32 i = 0; i < entryCount; ++i)
+        {
+            const auto path = InlineString<64>::Format("Entries/%u.txt", i);
+            TEST_TRUE(writer.AddFile(path, path, i % 2 == 0));
+        }
+
+        TEST_TRUE(writer.Write(archivePath));
+    }
+
+    Resources::Archive archive;
+    TEST_TRUE(archive.Open(archivePath));
+    TEST_TRUE(archive.GetEntryCount() == entryCount);
+
+    HeapArray<u8> buffer;
+    for(u32 i = 0; i < entryCount; ++i)
+    {
+        const auto path = InlineString<64>::Format("Entries/%u.txt", i);
+        Optional<StringView> data = archive.Read(path, buffer);
+        TEST_TRUE(data && *data == path);
+    }
+}
+
+TEST_DEFINE("Resources.Archive", "DuplicatePath")
+{
+    LOG_MINIMUM_SEVERITY_SCOPE(Logger::Severity::Fatal);
+
+    const StringView archivePath = "TestArchiveDuplicatePath.pak";
+    SCOPE_GUARD
+    {
+        std::remove(*archivePath);
+    };
+
+    // Duplicates are only detected once entries are sorted for writing.
+    Resources::ArchiveWriter writer;
+    TEST_TRUE(writer.AddFile("Data/First.txt", "First", false));
+    TEST_TRUE(writer.AddFile("Data/Second.txt", "Second", false));
+    TEST_TRUE(writer.AddFile("Data/First.txt", "Again", false));
+    TEST_FALSE(writer.Write(archivePath));
+    TEST_FALSE(CheckFileExists(archivePath));
+}
+
+TEST_DEFINE("Resources.Archive", "CorruptedSize")
+{
+    const StringView archivePath = "TestArchiveCorruptedSize.pak";
+    SCOPE_GUARD
+    {
+        std::remove(*archivePath);
+    };
+
+    {
+        Resources::ArchiveWriter writer;
+        TEST_TRUE(writer.AddFile("Data/Repeated.txt", CreateRepeatedText("Compressible line of text\n", 100), true));
+        TEST_TRUE(writer.Write(archivePath));
+    }
+
+    String contents;
+    TEST_TRUE(ReadStringFromFile(archivePath, contents));
+
+    Resources::ArchiveEntry entry;
+    const u64 entryOffset = sizeof(Resources::ArchiveHeader);
+    std::memcpy(&entry, contents.GetData() + entryOffset, sizeof(entry));
+    TEST_TRUE(entry.IsCompressed());
+
+    // Sizes that compressed data could never decompress into are rejected on open.
+    const u64 corruptedSizes[] =
+    {
+        Compression::GetDecompressedBound(entry.storedSize) + 1,
+        Resources::ArchiveHeader::MaxEntrySize + 1,
+        ~0ull,
+    };
+
+    for(const u64 size : corruptedSizes)
+    {
+        Resources::ArchiveEntry corrupted = entry;
+        corrupted.size = size;
+        String corruptedContents = contents;
+        std::memcpy(corruptedContents.GetData() + entryOffset, &corrupted, sizeof(corrupted));
+        TEST_TRUE(WriteStringToFile(archivePath, corruptedContents));
+
+        // Expected errors are not counted as test failures.
+        LOG_MINIMUM_SEVERITY_SCOPE(Logger::Severity::Fatal);
+        Resources::Archive archive;
+        TEST_FALSE(archive.Open(archivePath));
+    }
+
+    TEST_TRUE(WriteStringToFile(archivePath, contents));
+    Resources::Archive archive;
+    TEST_TRUE(archive.Open(archivePath));
+}
+
+TEST_DEFINE("Resources.Archive", "MountedByManager")
+{
+    const StringView archivePath = "TestArchiveMounted.pak";
+    SCOPE_GUARD
+    {
+        std::remove(*archivePath);
+    };
+
+    const HeapString repeated = CreateRepeatedText("Packed resource\n", 50);
+    {
+        Resources::ArchiveWriter writer;
+        TEST_TRUE(writer.AddFile("Packed/Plain.txt", "Plain", false));
+        TEST_TRUE(writer.AddFile("Packed/Compressed.txt", repeated, true));
+        TEST_TRUE(writer.Write(archivePath));
+    }
+
+    Resources::Archive archive;
+    TEST_TRUE(archive.Open(archivePath));
+
+    Resources::Manager manager;
+    TEST_TRUE(manager.Setup(Resources::ManagerConfig()));
+    manager.MountArchive(&archive);
+
+    // Paths are resolved from archive, without any loose files present.
+    Resources::Handle<ArchiveTextResource> plain = manager.Load<ArchiveTextResource>("Packed/Plain.txt");
+    Resources::Handle<ArchiveTextResource> compressed = manager.Load<ArchiveTextResource>("Packed/Compressed.txt");
+    manager.WaitAll();
+
+    TEST_TRUE(plain.IsLoaded());
+    TEST_TRUE(plain->text == "Plain");
+    TEST_TRUE(compressed.IsLoaded());
+    TEST_TRUE(compressed->text == repeated);
+    TEST_TRUE(manager.GetStats().loadCount == 2);
+}
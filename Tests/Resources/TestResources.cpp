@@ -0,0 +1,276 @@
+#include "Shared.hpp"
+#include "Resources/Manager.hpp"
+#include "Resources/Config.hpp"
+
+namespace
+{
+    class TextResource final : public Resources::Resource
+    {
+    public:
+        HeapString text;
+
+        bool Load(const u8* data, const u64 size) override
+        {
+            text = StringView(reinterpret_cast<const char*>(data), size);
+            return true;
+        }
+
+        u64 GetMemorySize() const override
+        {
+            return text.GetLength();
+        }
+    };
+
+    // Dummy resource files removed again once test scope ends.
+    class TextResourceFiles final : NonCopyable
+    {
+        HeapArray<HeapString> m_paths;
+
+    public:
+        ~TextResourceFiles()
+        {
+            for(const HeapString& path : m_paths)
+            {
+                std::remove(*path);
+            }
+        }
+
+        bool Add(const StringView& path, const StringView& contents)
+        {
+            m_paths.Add(HeapString(path));
+            return WriteStringToFile(path, contents);
+        }
+    };
+
+    Resources::ManagerConfig CreateConfig(const u64 memoryBudget)
+    {
+        Resources::ManagerConfig config;
+        config.memoryBudget = memoryBudget;
+        config.workerCount = 2;
+        return config;
+    }
+}
+
+TEST_DEFINE("Resources.Manager", "LoadAndWait")
+{
+    TextResourceFiles files;
+    const StringView path = "TestResourcesLoadAndWait.txt";
+    TEST_TRUE(files.Add(path, "Hello resources"));
+
+    Resources::Manager manager;
+    TEST_TRUE(manager.Setup(CreateConfig(1024)));
+
+    Resources::Handle<TextResource> handle = manager.Load<TextResource>(path);
+    TEST_TRUE(handle.IsValid());
+    TEST_TRUE(handle.GetId() == StringId::Compute(path));
+
+    manager.Wait(handle);
+    TEST_TRUE(handle.IsLoaded());
+    TEST_TRUE(handle.GetStatus() == Resources::Status::Loaded);
+    TEST_TRUE(handle->text == "Hello resources");
+    TEST_TRUE(manager.GetMemoryUsage() == 15);
+    TEST_TRUE(manager.GetEntryCount() == 1);
+
+    const Resources::Stats& stats = manager.GetStats();
+    TEST_TRUE(stats.requestCount == 1);
+    TEST_TRUE(stats.loadCount == 1);
+    TEST_TRUE(stats.hitCount == 0);
+    TEST_TRUE(stats.failCount == 0);
+    TEST_TRUE(stats.GetAverageLatency() >= 0.0f);
+    TEST_TRUE(stats.maxLatency >= stats.GetAverageLatency());
+
+    handle.Reset();
+    TEST_FALSE(handle.IsValid());
+    TEST_TRUE(manager.IsCached(StringId::Compute(path)));
+}
+
+TEST_DEFINE("Resources.Manager", "Deduplication")
+{
+    TextResourceFiles files;
+    const StringView path = "TestResourcesDeduplication.txt";
+    TEST_TRUE(files.Add(path, "Shared"));
+
+    Resources::Manager manager;
+    TEST_TRUE(manager.Setup(CreateConfig(1024)));
+
+    // Requests made before completed loads are finished share the load in flight.
+    Resources::Handle<TextResource> first = manager.Load<TextResource>(path);
+    Resources::Handle<TextResource> second = manager.Load<TextResource>(path);
+    TEST_TRUE(first == second);
+    TEST_TRUE(first.GetStatus() == Resources::Status::Loading);
+    TEST_TRUE(first.Get() == nullptr);
+
+    manager.WaitAll();
+    TEST_TRUE(first.IsLoaded());
+    TEST_TRUE(first.Get() == second.Get());
+
+    Resources::Handle<TextResource> third = manager.Load<TextResource>(path);
+    TEST_TRUE(third.IsLoaded());
+    TEST_TRUE(third.Get() == first.Get());
+
+    const Resources::Stats& stats = manager.GetStats();
+    TEST_TRUE(stats.requestCount == 3);
+    TEST_TRUE(stats.dedupCount == 1);
+    TEST_TRUE(stats.hitCount == 1);
+    TEST_TRUE(stats.loadCount == 1);
+    TEST_TRUE(stats.GetHitRate() > 0.66f && stats.GetHitRate() < 0.67f);
+    TEST_TRUE(manager.GetEntryCount() == 1);
+}
+
+TEST_DEFINE("Resources.Manager", "NoWorkers")
+{
+    TextResourceFiles files;
+    const StringView path = "TestResourcesNoWorkers.txt";
+    TEST_TRUE(files.Add(path, "Main thread"));
+
+    Resources::ManagerConfig config = CreateConfig(1024);
+    config.workerCount = 0;
+
+    Resources::Manager manager;
+    TEST_TRUE(manager.Setup(config));
+
+    // Resource is loaded right away, but only finished during update.
+    Resources::Handle<TextResource> handle = manager.Load<TextResource>(path);
+    TEST_TRUE(handle.GetStatus() == Resources::Status::Loading);
+
+    manager.Update();
+    TEST_TRUE(handle.IsLoaded());
+    TEST_TRUE(handle->text == "Main thread");
+    TEST_TRUE(manager.GetStats().loadCount == 1);
+}
+
+TEST_DEFINE("Resources.Manager", "FailedLoad")
+{
+    LOG_MINIMUM_SEVERITY_SCOPE(Logger::Severity::Fatal);
+
+    TextResourceFiles files;
+    const StringView path = "TestResourcesFailedLoad.txt";
+
+    Resources::Manager manager;
+    TEST_TRUE(manager.Setup(CreateConfig(1024)));
+
+    // Failed entry is shared while it has handles.
+    Resources::Handle<TextResource> first = manager.Load<TextResource>(path);
+    manager.Wait(first);
+    TEST_TRUE(first.GetStatus() == Resources::Status::Failed);
+    TEST_TRUE(first.Get() == nullptr);
+
+    Resources::Handle<TextResource> second = manager.Load<TextResource>(path);
+    TEST_TRUE(second == first);
+    TEST_TRUE(manager.GetStats().failCount == 1);
+
+    // Failed entry is dropped with its last handle, so path is loaded again on next request.
+    first.Reset();
+    second.Reset();
+    TEST_FALSE(manager.IsCached(StringId::Compute(path)));
+    TEST_TRUE(manager.GetEntryCount() == 0);
+
+    TEST_TRUE(files.Add(path, "Retried"));
+    Resources::Handle<TextResource> third = manager.Load<TextResource>(path);
+    manager.Wait(third);
+    TEST_TRUE(third.IsLoaded());
+    TEST_TRUE(third->text == "Retried");
+    TEST_TRUE(manager.GetStats().loadCount == 1);
+
+    // Failed load without any handles left is dropped once finished.
+    third.Reset();
+    {
+        Resources::Handle<TextResource> missing = manager.Load<TextResource>("TestResourcesFailedLoadMissing.txt");
+    }
+
+    manager.WaitAll();
+    TEST_FALSE(manager.IsCached(StringId::Compute("TestResourcesFailedLoadMissing.txt")));
+    TEST_TRUE(manager.GetEntryCount() == 1);
+}
+
+TEST_DEFINE("Resources.Manager", "Eviction")
+{
+    TextResourceFiles files;
+    const StringView pathA = "TestResourcesEvictionA.txt";
+    TEST_TRUE(files.Add(pathA, "0123456789"));
+    const StringView pathB = "TestResourcesEvictionB.txt";
+    TEST_TRUE(files.Add(pathB, "0123456789"));
+    const StringView pathC = "TestResourcesEvictionC.txt";
+    TEST_TRUE(files.Add(pathC, "0123456789"));
+
+    Resources::Manager manager;
+    TEST_TRUE(manager.Setup(CreateConfig(25)));
+
+    {
+        Resources::Handle<TextResource> a = manager.Load<TextResource>(pathA);
+        Resources::Handle<TextResource> b = manager.Load<TextResource>(pathB);
+        manager.WaitAll();
+    }
+
+    // Both resources are unused but cached, with first one used least recently.
+    TEST_TRUE(manager.GetEntryCount() == 2);
+    TEST_TRUE(manager.GetMemoryUsage() == 20);
+
+    // Referenced resource is never evicted, even if budget is exceeded.
+    Resources::Handle<TextResource> a = manager.Load<TextResource>(pathA);
+    Resources::Handle<TextResource> c = manager.Load<TextResource>(pathC);
+    manager.WaitAll();
+
+    TEST_TRUE(manager.GetEntryCount() == 2);
+    TEST_TRUE(manager.GetMemoryUsage() == 20);
+    TEST_TRUE(manager.IsCached(StringId::Compute(pathA)));
+    TEST_FALSE(manager.IsCached(StringId::Compute(pathB)));
+    TEST_TRUE(manager.IsCached(StringId::Compute(pathC)));
+    TEST_TRUE(manager.GetStats().evictCount == 1);
+
+    manager.SetMemoryBudget(0);
+    TEST_TRUE(manager.GetEntryCount() == 2);
+
+    a.Reset();
+    c.Reset();
+    manager.Update();
+    TEST_TRUE(manager.GetEntryCount() == 0);
+    TEST_TRUE(manager.GetMemoryUsage() == 0);
+    TEST_TRUE(manager.GetStats().evictCount == 3);
+}
+
+TEST_DEFINE("Resources.Manager", "ManyResources")
+{
+    // Enough entries to grow hash table and shift entries back on removal.
+    const u32 resourceCount = 200;
+    TextResourceFiles files;
+    HeapArray<HeapString> paths;
+    for(u32 i = 0; i < resourceCount; ++i)
+    {
+        const HeapString& path = paths.Add(HeapString::Format("TestResourcesMany%u.txt", i));
+        TEST_TRUE(files.Add(path, path));
+    }
+
+    Resources::Manager manager;
+    TEST_TRUE(manager.Setup(CreateConfig(1024 * 1024)));
+
+    {
+        HeapArray<Resources::Handle<TextResource>> handles;
+        for(const HeapString& path : paths)
+        {
+            handles.Add(manager.Load<TextResource>(path));
+        }
+
+        manager.WaitAll();
+        for(u32 i = 0; i < resourceCount; ++i)
+        {
+            TEST_TRUE(handles[i].IsLoaded());
+            TEST_TRUE(handles[i]->text == paths[i]);
+        }
+    }
+
+    TEST_TRUE(manager.GetEntryCount() == resourceCount);
+    TEST_TRUE(manager.GetStats().loadCount == resourceCount);
+
+    // Half of resources are evicted, while the rest stays reachable.
+    manager.SetMemoryBudget(manager.GetMemoryUsage() / 2);
+    TEST_TRUE(manager.GetEntryCount() < resourceCount);
+
+    for(u32 i = 0; i < resourceCount; ++i)
+    {
+        const bool cached = manager.IsCached(StringId::Compute(paths[i]));
+        TEST_TRUE(cached == (i >= resourceCount - manager.GetEntryCount()));
+    }
+
+    TEST_TRUE(manager.GetStats().evictCount + manager.GetEntryCount() == resourceCount);
+}
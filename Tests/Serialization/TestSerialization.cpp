@@ -0,0 +1,280 @@
+#include "Shared.hpp"
+#include "Serialization/Writer.hpp"
+#include "Serialization/Reader.hpp"
+
+namespace
+{
+    enum class TestItemKind : u8
+    {
+        Weapon,
+        Potion,
+    };
+
+    struct TestItem
+    {
+        TestItemKind kind = TestItemKind::Weapon;
+        i32 count = 0;
+        HeapString name;
+
+        SERIALIZATION_FIELDS()
+        {
+            SERIALIZATION_FIELD(kind);
+            SERIALIZATION_FIELD(count);
+            SERIALIZATION_FIELD(name);
+        }
+    };
+
+    struct TestSave
+    {
+        static constexpr u32 Magic = 0x45564153; // "SAVE"
+
+        u64 seed = 0;
+        i16 offset = 0;
+        f32 health = 0.0f;
+        bool hardcore = false;
+        HeapArray<TestItem> items;
+        HeapArray<f32> positions;
+        u32 score = 0; // Added in second version
+
+        SERIALIZATION_FIELDS()
+        {
+            SERIALIZATION_FIELD(seed);
+            SERIALIZATION_FIELD(offset);
+            SERIALIZATION_FIELD(health);
+            SERIALIZATION_FIELD(hardcore);
+            SERIALIZATION_FIELD(items);
+            SERIALIZATION_FIELD(positions);
+            SERIALIZATION_FIELD_SINCE(score, 2);
+        }
+    };
+
+    // Zero-copy view of serialized data, pointing into source buffer.
+    struct TestSnapshot
+    {
+        StringView name;
+        Span<const u32> values;
+
+        SERIALIZATION_FIELDS()
+        {
+            SERIALIZATION_FIELD(name);
+            SERIALIZATION_FIELD(values);
+        }
+    };
+
+    struct FieldNameVisitor
+    {
+        HeapArray<StringView> names;
+
+        template<typename Type>
+        void Field(const char* name, Type&, u32)
+        {
+            names.Add(StringView(name));
+        }
+    };
+
+    TestSave CreateTestSave()
+    {
+        TestSave save;
+        save.seed = 0x123456789ABCDEF0;
+        save.offset = -300;
+        save.health = 0.75f;
+        save.hardcore = true;
+        save.items.Add(TestItem{ TestItemKind::Weapon, 1, "Sword" });
+        save.items.Add(TestItem{ TestItemKind::Potion, -5, "Elixir" });
+        save.positions = { 1.0f, 2.5f, -3.0f };
+        save.score = 9000;
+        return save;
+    }
+}
+
+TEST_DEFINE("Serialization", "VarInt")
+{
+    const u64 unsignedValues[] = { 0, 1, 127, 128, 300, 16383, 16384, 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF };
+    const i64 signedValues[] = { 0, -1, 1, -64, 64, -65, std::numeric_limits<i64>::min(), std::numeric_limits<i64>::max() };
+
+    HeapArray<u8> buffer;
+    Serialization::Writer writer(buffer);
+    for(const u64 value : unsignedValues)
+    {
+        writer.WriteVarUInt(value);
+    }
+
+    for(const i64 value : signedValues)
+    {
+        writer.WriteVarInt(value);
+    }
+
+    // Small values of either sign take a single byte.
+    HeapArray<u8> small;
+    Serialization::Writer smallWriter(small);
+    smallWriter.WriteVarUInt(127);
+    smallWriter.WriteVarInt(-64);
+    smallWriter.WriteVarInt(63);
+    TEST_TRUE(small.GetSize() == 3);
+
+    Serialization::Reader reader(buffer);
+    for(const u64 value : unsignedValues)
+    {
+        TEST_TRUE(reader.ReadVarUInt() == value);
+    }
+
+    for(const i64 value : signedValues)
+    {
+        TEST_TRUE(reader.ReadVarInt() == value);
+    }
+
+    TEST_TRUE(reader.IsFinished());
+
+    // Overlong encoding that does not fit 64 bits is rejected.
+    const u8 overlong[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02 };
+    Serialization::Reader overlongReader(overlong, sizeof(overlong));
+    TEST_TRUE(overlongReader.ReadVarUInt() == 0);
+    TEST_TRUE(overlongReader.IsFailed());
+}
+
+TEST_DEFINE("Serialization", "Fields")
+{
+    const TestSave save = CreateTestSave();
+
+    HeapArray<u8> buffer;
+    Serialization::Writer writer(buffer);
+    writer.WriteHeader(TestSave::Magic, 2);
+    writer.Write(save);
+    TEST_TRUE(writer.GetSize() == buffer.GetSize());
+
+    TestSave loaded;
+    Serialization::Reader reader(buffer);
+    TEST_TRUE(reader.ReadHeader(TestSave::Magic, 2));
+    TEST_TRUE(reader.GetVersion() == 2);
+    reader.Read(loaded);
+    TEST_TRUE(reader.IsFinished());
+
+    TEST_TRUE(loaded.seed == save.seed);
+    TEST_TRUE(loaded.offset == save.offset);
+    TEST_TRUE(loaded.health == save.health);
+    TEST_TRUE(loaded.hardcore == save.hardcore);
+    TEST_TRUE(loaded.items.GetSize() == 2);
+    TEST_TRUE(loaded.items[0].kind == TestItemKind::Weapon);
+    TEST_TRUE(loaded.items[1].kind == TestItemKind::Potion);
+    TEST_TRUE(loaded.items[1].count == -5);
+    TEST_TRUE(loaded.items[1].name == "Elixir");
+    TEST_TRUE(loaded.positions.GetSize() == 3);
+    TEST_TRUE(loaded.positions[1] == 2.5f);
+    TEST_TRUE(loaded.score == 9000);
+
+    // Field names are available to any visitor.
+    FieldNameVisitor visitor;
+    TestSave::VisitFields(loaded, visitor);
+    TEST_TRUE(visitor.names.GetSize() == 7);
+    TEST_TRUE(visitor.names[0] == "seed");
+    TEST_TRUE(visitor.names[6] == "score");
+}
+
+TEST_DEFINE("Serialization", "Versioning")
+{
+    const TestSave save = CreateTestSave();
+
+    // Older version is written without fields added later.
+    HeapArray<u8> buffer;
+    Serialization::Writer writer(buffer);
+    writer.WriteHeader(TestSave::Magic, 1);
+    writer.Write(save);
+
+    TestSave loaded;
+    loaded.score = 42;
+    Serialization::Reader reader(buffer);
+    TEST_TRUE(reader.ReadHeader(TestSave::Magic, 2));
+    TEST_TRUE(reader.GetVersion() == 1);
+    reader.Read(loaded);
+    TEST_TRUE(reader.IsFinished());
+    TEST_TRUE(loaded.seed == save.seed);
+    TEST_TRUE(loaded.score == 42);
+
+    // Newer version than supported and unrelated data are rejected.
+    Serialization::Reader olderReader(buffer);
+    TEST_FALSE(olderReader.ReadHeader(TestSave::Magic, 0));
+    TEST_TRUE(olderReader.IsFailed());
+
+    Serialization::Reader otherReader(buffer);
+    TEST_FALSE(otherReader.ReadHeader(0x12345678, 2));
+}
+
+TEST_DEFINE("Serialization", "ZeroCopy")
+{
+    const u32 values[] = { 10, 20, 30, 40 };
+
+    HeapArray<u8> buffer;
+    Serialization::Writer writer(buffer);
+    writer.Write(u8(7)); // Misaligns following span, which gets padded
+    writer.Write(TestSnapshot{ "Snapshot", Span<const u32>(values, 4) });
+    writer.WriteSpan<u32>(nullptr, 0);
+
+    Serialization::Reader reader(buffer);
+    u8 prefix = 0;
+    reader.Read(prefix);
+    TEST_TRUE(prefix == 7);
+
+    TestSnapshot snapshot;
+    reader.Read(snapshot);
+    TEST_TRUE(snapshot.name == "Snapshot");
+    TEST_TRUE(snapshot.values.GetSize() == 4);
+    TEST_TRUE(snapshot.values[3] == 40);
+
+    // Views point directly into source buffer.
+    const u8* begin = buffer.GetBeginPtr();
+    const u8* end = buffer.GetEndPtr();
+    TEST_TRUE(reinterpret_cast<const u8*>(snapshot.name.GetData()) >= begin);
+    TEST_TRUE(reinterpret_cast<const u8*>(snapshot.values.GetData()) < end);
+    TEST_TRUE(reinterpret_cast<uintptr_t>(snapshot.values.GetData()) % alignof(u32) == 0);
+
+    TEST_TRUE(reader.ReadSpan<u32>().IsEmpty());
+    TEST_TRUE(reader.IsFinished());
+}
+
+TEST_DEFINE("Serialization", "Malformed")
+{
+    const TestSave save = CreateTestSave();
+
+    HeapArray<u8> buffer;
+    Serialization::Writer writer(buffer);
+    writer.WriteHeader(TestSave::Magic, 2);
+    writer.Write(save);
+
+    // Every truncation fails without reading out of bounds.
+    for(u64 size = 0; size < buffer.GetSize(); ++size)
+    {
+        TestSave loaded;
+        Serialization::Reader reader(buffer.GetData(), size);
+        reader.ReadHeader(TestSave::Magic, 2);
+        reader.Read(loaded);
+        TEST_TRUE(reader.IsFailed());
+        TEST_FALSE(reader.IsFinished());
+    }
+
+    // Values out of range of their type are rejected.
+    HeapArray<u8> wide;
+    Serialization::Writer wideWriter(wide);
+    wideWriter.WriteVarUInt(70000);
+    wideWriter.WriteFixed<u8>(2);
+
+    u16 narrow = 0;
+    Serialization::Reader narrowReader(wide);
+    narrowReader.Read(narrow);
+    TEST_TRUE(narrowReader.IsFailed());
+
+    bool flag = false;
+    Serialization::Reader flagReader(wide.GetData() + wide.GetSize() - 1, 1);
+    flagReader.Read(flag);
+    TEST_TRUE(flagReader.IsFailed());
+
+    // Huge element count is rejected before anything is allocated.
+    HeapArray<u8> huge;
+    Serialization::Writer hugeWriter(huge);
+    hugeWriter.WriteVarUInt(0xFFFFFFFFFFFF);
+
+    HeapArray<TestItem> items;
+    Serialization::Reader hugeReader(huge);
+    hugeReader.Read(items);
+    TEST_TRUE(hugeReader.IsFailed());
+    TEST_TRUE(items.IsEmpty());
+}
@@ -146,3 +146,13 @@ namespace Test
         }
     };
 }
+
+namespace Memory
+{
+    // Test objects do not depend on their address, so containers can relocate them without moves.
+    template<>
+    constexpr bool IsTriviallyRelocatable<Test::Object> = true;
+
+    template<>
+    constexpr bool IsTriviallyRelocatable<Test::ObjectDerived> = true;
+}
@@ -29,16 +29,19 @@ void Test::Registry::Register(const StringView& group, const StringView& name, c
 {
     m_groups.AddUnique(group);
 
+    const StringId path(InlineString<128>::Format("%.*s.%.*s",
+        STRING_VIEW_PRINTF_ARG(group), STRING_VIEW_PRINTF_ARG(name)));
+
     bool exists = m_tests.ContainsPredicate(
-        [&group, &name](const Test::Entry& entry)
+        [&path](const Test::Entry& entry)
         {
-            return entry.group == group && entry.name == name;
+            return entry.path == path;
         });
 
     ASSERT_ALWAYS(!exists, "Test with path \"%.*s.%.*s\" is already registered!",
         STRING_VIEW_PRINTF_ARG(group), STRING_VIEW_PRINTF_ARG(name));
 
-    m_tests.Add(group, name, runner);
+    m_tests.Add(group, name, path, runner);
 }
 
 Test::Registrar::Registrar(const StringView& group, const StringView& name, const RunnerPtr runner)
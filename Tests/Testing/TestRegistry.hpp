@@ -14,6 +14,7 @@ namespace Test
     {
         StringView group;
         StringView name;
+        StringId path;
         RunnerPtr runner = nullptr;
 
         Result Run() const;
@@ -26,6 +26,11 @@ Config TestsApplication::GetConfig()
     Config config;
     config.logger.minimumSeverity = Logger::Severity::Warning;
     config.headless = true;
+
+    // Tests set up their own async IO and resource manager when needed.
+    config.asyncIO.allowKernelQueue = false;
+    config.asyncIO.workerCount = 0;
+    config.resources.workerCount = 0;
     return config;
 }
 
@@ -85,7 +90,7 @@ ExitCodes TestsApplication::DiscoverTests(const String& outputPath)
     LOG_INFO("Writing %llu discovered test(s) from %llu group(s)...",
         testRegistry.GetTests().GetSize(), testRegistry.GetTests().GetSize());
 
-    HeapString builder;
+    StringBuilder builder;
     for (const Test::Entry& testEntry : testRegistry.GetTests())
     {
         builder.Append("add_test(\"%.*s.%.*s\" Tests [==[-RunTest=%.*s.%.*s]==])\n",
@@ -93,7 +98,7 @@ ExitCodes TestsApplication::DiscoverTests(const String& outputPath)
             STRING_VIEW_PRINTF_ARG(testEntry.group), STRING_VIEW_PRINTF_ARG(testEntry.name));
     }
 
-    if(!WriteStringToFileIfDifferent(outputPath, builder))
+    if(!WriteStringBuilderToFileIfDifferent(outputPath, builder))
     {
         LOG_ERROR("Failed to write discovered tests");
         return ExitCodes::DiscoverTestsFailed;
@@ -105,13 +110,11 @@ ExitCodes TestsApplication::DiscoverTests(const String& outputPath)
 
 ExitCodes TestsApplication::RunTest(const StringView& testPath)
 {
+    const StringId testId = StringId::Compute(testPath);
     const Test::Entry* testEntry = Test::Registry::Get().GetTests().FindPredicate(
-        [&testPath](const Test::Entry& entry)
+        [&testId](const Test::Entry& entry)
         {
-            // #todo: Replace need to concatenate test path, have a method for that.
-            auto fullTestName = InlineString<128>::Format("%.*s.%.*s",
-                STRING_VIEW_PRINTF_ARG(entry.group), STRING_VIEW_PRINTF_ARG(entry.name));
-            return fullTestName == testPath;
+            return entry.path == testId;
         });
 
     if (!testEntry)
@@ -133,10 +136,7 @@ ExitCodes TestsApplication::RunTests(const StringView& testQuery)
     Array<const Test::Entry*> foundTests;
     for(const Test::Entry& testEntry : Test::Registry::Get().GetTests())
     {
-        auto fullTestName = InlineString<128>::Format("%.*s.%.*s",
-            STRING_VIEW_PRINTF_ARG(testEntry.group), STRING_VIEW_PRINTF_ARG(testEntry.name));
-
-        if(fullTestName.StartsWith(testQuery))
+        if(testEntry.path.GetString().StartsWith(testQuery))
         {
             foundTests.Add(&testEntry);
         }
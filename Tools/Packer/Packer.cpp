@@ -0,0 +1,116 @@
+#include "Shared.hpp"
+#include "Engine/Engine.hpp"
+#include "Engine/Resources/ArchiveWriter.hpp"
+#include "Engine/Platform/CommandLine.hpp"
+#include "Engine/Platform/MappedFile.hpp"
+
+// Packs files listed in manifest into a single archive for resource manager to mount:
+//   Packer -Manifest=Files.txt -Output=Data.pak [-Root=Assets] [-Compression=LZ4]
+// Manifest lists one path per line, which is both the path inside archive and the path
+// of file to pack relative to root directory. Empty lines and lines starting with # are skipped.
+class PackerApplication final : public Application
+{
+public:
+    Config GetConfig() override;
+    Optional<ExitCodes> OnRun() override;
+
+private:
+    bool AddFiles(Resources::ArchiveWriter& writer, const StringView& manifestPath,
+        const StringView& rootPath, bool compress);
+};
+
+DEFINE_PRIMARY_APPLICATION("Bourne Engine Packer", PackerApplication);
+
+Config PackerApplication::GetConfig()
+{
+    Config config;
+    config.headless = true;
+    config.asyncIO.allowKernelQueue = false;
+    config.asyncIO.workerCount = 0;
+    config.resources.workerCount = 0;
+    return config;
+}
+
+Optional<ExitCodes> PackerApplication::OnRun()
+{
+    const auto& commandLine = Platform::CommandLine::Get();
+    const Optional<StringView> manifestPath = commandLine.GetArgumentValue("Manifest");
+    const Optional<StringView> outputPath = commandLine.GetArgumentValue("Output");
+    const Optional<StringView> rootPath = commandLine.GetArgumentValue("Root");
+    const Optional<StringView> compression = commandLine.GetArgumentValue("Compression");
+
+    if(!manifestPath || !outputPath)
+    {
+        LOG_ERROR("Usage: Packer -Manifest=<file> -Output=<file> [-Root=<directory>] [-Compression=None|LZ4]");
+        return ExitCodes::PackArchiveFailed;
+    }
+
+    const bool compress = compression && *compression == "LZ4";
+    if(compression && !compress && *compression != "None")
+    {
+        LOG_ERROR("Unknown compression: %.*s", STRING_VIEW_PRINTF_ARG((*compression)));
+        return ExitCodes::PackArchiveFailed;
+    }
+
+    Resources::ArchiveWriter writer;
+    if(!AddFiles(writer, *manifestPath, rootPath ? *rootPath : StringView("."), compress))
+        return ExitCodes::PackArchiveFailed;
+
+    if(!writer.Write(*outputPath))
+        return ExitCodes::PackArchiveFailed;
+
+    LOG_SUCCESS("Packed %llu file(s) with %llu compressed into %.*s (%llu bytes stored from %llu bytes)",
+        writer.GetFileCount(), writer.GetCompressedCount(), STRING_VIEW_PRINTF_ARG((*outputPath)),
+        writer.GetStoredSize(), writer.GetSize());
+
+    return ExitCodes::Success;
+}
+
+bool PackerApplication::AddFiles(Resources::ArchiveWriter& writer, const StringView& manifestPath,
+    const StringView& rootPath, const bool compress)
+{
+    Platform::MappedFile manifest;
+    if(!manifest.Open(manifestPath))
+    {
+        LOG_ERROR("Failed to open manifest: %.*s", STRING_VIEW_PRINTF_ARG(manifestPath));
+        return false;
+    }
+
+    const StringView contents = manifest.GetStringView();
+    u64 lineStart = 0;
+    while(lineStart < contents.GetLength())
+    {
+        u64 lineEnd = lineStart;
+        while(lineEnd < contents.GetLength() && contents.GetData()[lineEnd] != '\n')
+        {
+            ++lineEnd;
+        }
+
+        u64 pathEnd = lineEnd;
+        while(pathEnd > lineStart && (contents.GetData()[pathEnd - 1] == '\r' || contents.GetData()[pathEnd - 1] == ' '))
+        {
+            --pathEnd;
+        }
+
+        const StringView path = contents.SubString(lineStart, pathEnd);
+        lineStart = lineEnd + 1;
+
+        if(path.IsEmpty() || path.GetData()[0] == '#')
+            continue;
+
+        const auto filePath = HeapString::Format("%.*s/%.*s",
+            STRING_VIEW_PRINTF_ARG(rootPath), STRING_VIEW_PRINTF_ARG(path));
+
+        Platform::MappedFile file;
+        if(!file.Open(filePath))
+        {
+            LOG_ERROR("Failed to open file listed in manifest: %s", *filePath);
+            return false;
+        }
+
+        if(!writer.AddFile(path, file.GetStringView(), compress))
+            return false;
+    }
+
+    return true;
+}